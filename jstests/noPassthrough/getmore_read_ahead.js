@@ -0,0 +1,69 @@
+/**
+ * Tests that with 'cursorReadAheadMaxBytes' set, getMore batches of find cursors are produced in
+ * the background ahead of the request, and that the results are returned complete and in order.
+ */
+(function() {
+"use strict";
+
+const conn = MongoRunner.runMongod({setParameter: {cursorReadAheadMaxBytes: 1024 * 1024}});
+const db = conn.getDB("test");
+const coll = db.getmore_read_ahead;
+
+const kNumDocs = 1000;
+const bulk = coll.initializeUnorderedBulkOp();
+for (let i = 0; i < kNumDocs; i++) {
+    bulk.insert({_id: i, padding: "x".repeat(100)});
+}
+assert.commandWorked(bulk.execute());
+
+function readAheadMetrics() {
+    return db.serverStatus().metrics.cursor.readAhead;
+}
+
+// Drain a sorted cursor in small batches, pausing between getMores so that the read-ahead has
+// time to run, and check that no document is lost, duplicated or reordered.
+let res = assert.commandWorked(
+    db.runCommand({find: coll.getName(), sort: {_id: 1}, hint: {_id: 1}, batchSize: 10}));
+let cursorId = res.cursor.id;
+let expectedId = 0;
+res.cursor.firstBatch.forEach(doc => assert.eq(doc._id, expectedId++));
+
+while (cursorId != 0) {
+    sleep(10);
+    res = assert.commandWorked(
+        db.runCommand({getMore: cursorId, collection: coll.getName(), batchSize: 50}));
+    res.cursor.nextBatch.forEach(doc => assert.eq(doc._id, expectedId++));
+    cursorId = res.cursor.id;
+}
+assert.eq(expectedId, kNumDocs);
+
+assert.soon(() => readAheadMetrics().docsServed > 0, () => tojson(readAheadMetrics()));
+const metrics = readAheadMetrics();
+assert.gte(metrics.batches, 1, tojson(metrics));
+assert.gte(metrics.docs, metrics.docsServed, tojson(metrics));
+
+// A cursor which has been read ahead reports it in $currentOp.
+res = assert.commandWorked(db.runCommand({find: coll.getName(), batchSize: 10}));
+cursorId = res.cursor.id;
+assert.commandWorked(db.runCommand({getMore: cursorId, collection: coll.getName(), batchSize: 10}));
+assert.soon(() => {
+    const idle = db.getSiblingDB("admin")
+                     .aggregate([
+                         {$currentOp: {idleCursors: true}},
+                         {$match: {type: "idleCursor", "cursor.cursorId": cursorId}}
+                     ])
+                     .toArray();
+    return idle.length === 1 && idle[0].cursor.nReadAheadBatches >= 1;
+});
+assert.commandWorked(db.runCommand({killCursors: coll.getName(), cursors: [cursorId]}));
+
+// Killing a cursor discards whatever was read ahead for it.
+res = assert.commandWorked(db.runCommand({find: coll.getName(), batchSize: 10}));
+cursorId = res.cursor.id;
+assert.commandWorked(db.runCommand({getMore: cursorId, collection: coll.getName(), batchSize: 10}));
+assert.commandWorked(db.runCommand({killCursors: coll.getName(), cursors: [cursorId]}));
+assert.commandFailedWithCode(
+    db.runCommand({getMore: cursorId, collection: coll.getName()}), ErrorCodes.CursorNotFound);
+
+MongoRunner.stopMongod(conn);
+}());
@@ -0,0 +1,81 @@
+/**
+ * Tests that the TTL monitor removes the expired documents of a clustered collection without
+ * secondary indexes by truncating their range of RecordIds when 'featureFlagTruncateRange' and
+ * 'ttlMonitorTruncateClusteredCollections' are enabled, that the truncation is replicated as a
+ * single 'truncateRange' oplog entry, and that the counts of the collection stay accurate on every
+ * node.
+ *
+ * @tags: [
+ *   featureFlagTruncateRange,
+ *   requires_fcv_62,
+ *   requires_replication,
+ * ]
+ */
+(function() {
+"use strict";
+load("jstests/libs/clustered_collections/clustered_collection_util.js");
+
+const rst = new ReplSetTest({
+    nodes: 2,
+    nodeOptions: {
+        setParameter: {ttlMonitorSleepSecs: 1, ttlMonitorTruncateClusteredCollections: true},
+    },
+});
+rst.startSet();
+rst.initiate();
+
+const primary = rst.getPrimary();
+const db = primary.getDB(jsTestName());
+const coll = db.coll;
+const numDocs = 100;
+const expireAfterSeconds = 60 * 60 * 24;
+
+assert.commandWorked(db.createCollection(
+    coll.getName(), {clusteredIndex: {key: {_id: 1}, unique: true}, expireAfterSeconds}));
+
+const now = new Date();
+const expired = new Date(now - 10 * expireAfterSeconds * 1000);
+let docs = [];
+for (let i = 0; i < numDocs; ++i) {
+    docs.push({_id: new Date(expired - i), info: "expired"});
+    docs.push({_id: new Date(now - i), info: "unexpired"});
+    // Documents with _id values of other types are outside the range of expired dates.
+    docs.push({_id: i, info: "unexpired"});
+}
+assert.commandWorked(coll.insertMany(docs, {ordered: false}));
+
+ClusteredCollectionUtil.waitForTTL(db);
+
+assert.eq(0, coll.find({info: "expired"}).itcount());
+assert.eq(2 * numDocs, coll.find({info: "unexpired"}).itcount());
+assert.eq(2 * numDocs, coll.count());
+
+const oplog = primary.getDB("local").oplog.rs;
+assert.eq(0, oplog.find({op: "d", ns: coll.getFullName()}).itcount());
+const truncateEntries = oplog.find({op: "c", "o.truncateRange": coll.getName()}).toArray();
+assert.gte(truncateEntries.length, 1, truncateEntries);
+assert.eq(numDocs,
+          truncateEntries.reduce((total, entry) => total + entry.o.docsDeleted, 0),
+          truncateEntries);
+
+rst.awaitReplication();
+const secondaryColl = rst.getSecondary().getDB(jsTestName()).coll;
+assert.eq(0, secondaryColl.find({info: "expired"}).itcount());
+assert.eq(2 * numDocs, secondaryColl.find({info: "unexpired"}).itcount());
+assert.eq(2 * numDocs, secondaryColl.count());
+
+// A secondary index requires the documents to be deleted one at a time.
+assert.commandWorked(coll.createIndex({info: 1}));
+docs = [];
+for (let i = 0; i < numDocs; ++i) {
+    docs.push({_id: new Date(expired - i), info: "expired"});
+}
+assert.commandWorked(coll.insertMany(docs, {ordered: false}));
+
+ClusteredCollectionUtil.waitForTTL(db);
+
+assert.eq(0, coll.find({info: "expired"}).itcount());
+assert.eq(numDocs, oplog.find({op: "d", ns: coll.getFullName()}).itcount());
+
+rst.stopSet();
+})();
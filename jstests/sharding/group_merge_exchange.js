@@ -0,0 +1,83 @@
+/**
+ * Tests that a $group whose partial groups are merged on every shard through a hashed exchange
+ * ('internalQueryPartitionGroupMergeAcrossShards') returns the same groups as a single merger, and
+ * that pipelines which need a single merger after the $group keep using one.
+ *
+ * @tags: [
+ *   requires_fcv_62,
+ * ]
+ */
+(function() {
+'use strict';
+
+const st = new ShardingTest({shards: 3, mongos: 1});
+
+const dbName = "test";
+const coll = st.s.getDB(dbName).coll;
+const numDocs = 3000;
+
+assert.commandWorked(st.s.adminCommand({enableSharding: dbName}));
+st.ensurePrimaryShard(dbName, st.shard0.shardName);
+assert.commandWorked(st.s.adminCommand({shardCollection: coll.getFullName(), key: {_id: 1}}));
+assert.commandWorked(st.s.adminCommand({split: coll.getFullName(), middle: {_id: 1000}}));
+assert.commandWorked(st.s.adminCommand({split: coll.getFullName(), middle: {_id: 2000}}));
+assert.commandWorked(st.s.adminCommand(
+    {moveChunk: coll.getFullName(), find: {_id: 1000}, to: st.shard1.shardName}));
+assert.commandWorked(st.s.adminCommand(
+    {moveChunk: coll.getFullName(), find: {_id: 2000}, to: st.shard2.shardName}));
+
+const bulk = coll.initializeUnorderedBulkOp();
+for (let i = 0; i < numDocs; ++i) {
+    // Keys of different numeric types which compare equal must land in the same group.
+    const key = (i % 3 === 0) ? NumberLong(i % 250) : (i % 250);
+    bulk.insert({_id: i, key: key, sub: {a: i % 7}, val: i});
+}
+assert.commandWorked(bulk.execute());
+
+const partitioned = [
+    [{$group: {_id: "$key", total: {$sum: "$val"}, count: {$sum: 1}}}],
+    [
+        {$group: {_id: {k: "$key", a: "$sub.a"}, vals: {$addToSet: "$sub.a"}}},
+        {$match: {"_id.a": 3}},
+    ],
+    [{$group: {_id: "$sub", max: {$max: "$val"}}}, {$project: {max: 1}}],
+];
+const notPartitioned = [
+    [{$group: {_id: "$key", count: {$sum: 1}}}, {$sort: {_id: 1}}],
+    [{$group: {_id: "$key", count: {$sum: 1}}}, {$limit: 5}, {$project: {count: 1, _id: 0}}],
+];
+
+function setPartitionGroupMerge(enabled) {
+    assert.commandWorked(st.s.adminCommand(
+        {setParameter: 1, internalQueryPartitionGroupMergeAcrossShards: enabled}));
+}
+
+function mergeType(pipeline) {
+    return coll.explain().aggregate(pipeline).mergeType;
+}
+
+setPartitionGroupMerge(false);
+const expected = partitioned.map((pipeline) => coll.aggregate(pipeline).toArray());
+const expectedSorted = coll.aggregate(notPartitioned[0]).toArray();
+assert.eq(250, expected[0].length);
+
+setPartitionGroupMerge(true);
+for (let i = 0; i < partitioned.length; ++i) {
+    assert.eq("exchange", mergeType(partitioned[i]), partitioned[i]);
+    assert.sameMembers(expected[i], coll.aggregate(partitioned[i]).toArray(), partitioned[i]);
+}
+for (let pipeline of notPartitioned) {
+    assert.neq("exchange", mergeType(pipeline), pipeline);
+}
+assert.eq(expectedSorted, coll.aggregate(notPartitioned[0]).toArray());
+assert.eq(5, coll.aggregate(notPartitioned[1]).itcount());
+
+// A collation makes the group keys compare differently from their hashes.
+assert.neq("exchange",
+           coll.explain()
+               .aggregate(partitioned[0], {collation: {locale: "en_US", strength: 2}})
+               .mergeType);
+
+setPartitionGroupMerge(false);
+st.stop();
+})();
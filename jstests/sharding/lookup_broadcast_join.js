@@ -0,0 +1,97 @@
+/**
+ * Tests that a $lookup against a sharded foreign collection returns the same results whether the
+ * shards join it in memory ('internalQueryLookupBroadcastJoinMaxBytes') or query it for each input
+ * document, including when the foreign collection is too large to be broadcast.
+ *
+ * @tags: [
+ *   requires_fcv_62,
+ * ]
+ */
+(function() {
+'use strict';
+
+const st = new ShardingTest({shards: 2, mongos: 1});
+
+const dbName = "test";
+const db = st.s.getDB(dbName);
+const local = db.local;
+const foreign = db.foreign;
+
+assert.commandWorked(st.s.adminCommand({enableSharding: dbName}));
+st.ensurePrimaryShard(dbName, st.shard0.shardName);
+for (let coll of [local, foreign]) {
+    assert.commandWorked(st.s.adminCommand({shardCollection: coll.getFullName(), key: {_id: 1}}));
+    assert.commandWorked(st.s.adminCommand({split: coll.getFullName(), middle: {_id: 50}}));
+    assert.commandWorked(st.s.adminCommand(
+        {moveChunk: coll.getFullName(), find: {_id: 50}, to: st.shard1.shardName}));
+}
+
+let localDocs = [];
+let foreignDocs = [];
+for (let i = 0; i < 100; ++i) {
+    localDocs.push({_id: i, key: i % 10, keys: [i % 7, i % 3], name: "a" + (i % 5)});
+    foreignDocs.push({_id: i, key: i % 20, nested: [{key: i % 7}], name: "A" + (i % 5)});
+}
+localDocs.push({_id: 100});
+foreignDocs.push({_id: 100, key: null});
+assert.commandWorked(local.insert(localDocs));
+assert.commandWorked(foreign.insert(foreignDocs));
+
+const pipelines = [
+    [{$lookup: {from: "foreign", localField: "key", foreignField: "key", as: "out"}}],
+    [{$lookup: {from: "foreign", localField: "keys", foreignField: "nested.key", as: "out"}}],
+    [
+        {$lookup: {from: "foreign", localField: "key", foreignField: "key", as: "out"}},
+        {$unwind: "$out"},
+        {$match: {"out._id": {$lt: 30}}},
+    ],
+];
+const caseInsensitive = {locale: "en_US", strength: 2};
+
+function setMaxBytes(maxBytes) {
+    for (let rs of [st.rs0, st.rs1]) {
+        assert.commandWorked(rs.getPrimary().adminCommand(
+            {setParameter: 1, internalQueryLookupBroadcastJoinMaxBytes: maxBytes}));
+    }
+}
+
+function runAll() {
+    let results = pipelines.map((pipeline) => local.aggregate(pipeline).toArray());
+    results.push(local
+                     .aggregate([{
+                                    $lookup: {
+                                        from: "foreign",
+                                        localField: "name",
+                                        foreignField: "name",
+                                        as: "out"
+                                    }
+                                }],
+                                {collation: caseInsensitive})
+                     .toArray());
+    return results.map((result) => result.map((doc) => {
+        if (Array.isArray(doc.out)) {
+            doc.out.sort((a, b) => a._id - b._id);
+        }
+        return doc;
+    }));
+}
+
+function assertSameResults(expected, actual) {
+    assert.eq(expected.length, actual.length);
+    for (let i = 0; i < expected.length; ++i) {
+        assert.sameMembers(expected[i], actual[i]);
+    }
+}
+
+setMaxBytes(0);
+const expected = runAll();
+
+setMaxBytes(16 * 1024 * 1024);
+assertSameResults(expected, runAll());
+
+// A foreign collection larger than the limit falls back to querying it for each document.
+setMaxBytes(100);
+assertSameResults(expected, runAll());
+
+st.stop();
+})();
@@ -0,0 +1,71 @@
+/**
+ * Tests that mongos returns the same results when it retrieves the batches of shard cursors
+ * through exhaust getMores ('internalQueryMergerExhaustBatches'), for both unsorted and sorted
+ * merges, and that closing a cursor in the middle of a stream closes the shard cursors.
+ *
+ * @tags: [
+ *   requires_fcv_62,
+ * ]
+ */
+(function() {
+'use strict';
+
+const st = new ShardingTest({
+    shards: 2,
+    mongos: 1,
+    other: {mongosOptions: {setParameter: {internalQueryMergerExhaustBatches: 4}}},
+});
+
+const dbName = "test";
+const coll = st.s.getDB(dbName).coll;
+const numDocs = 2000;
+
+assert.commandWorked(st.s.adminCommand({enableSharding: dbName}));
+st.ensurePrimaryShard(dbName, st.shard0.shardName);
+assert.commandWorked(st.s.adminCommand({shardCollection: coll.getFullName(), key: {_id: 1}}));
+assert.commandWorked(st.s.adminCommand({split: coll.getFullName(), middle: {_id: numDocs / 2}}));
+assert.commandWorked(st.s.adminCommand({
+    moveChunk: coll.getFullName(),
+    find: {_id: numDocs / 2},
+    to: st.shard1.shardName,
+    _waitForDelete: true,
+}));
+
+const bulk = coll.initializeUnorderedBulkOp();
+for (let i = 0; i < numDocs; ++i) {
+    bulk.insert({_id: i, x: numDocs - i});
+}
+assert.commandWorked(bulk.execute());
+
+// Small batches make each shard cursor stream many batches.
+assert.eq(numDocs, coll.find().batchSize(10).itcount());
+
+const sorted = coll.find().sort({x: 1}).batchSize(10).toArray();
+assert.eq(numDocs, sorted.length);
+for (let i = 0; i < numDocs; ++i) {
+    assert.eq(i + 1, sorted[i].x, sorted[i]);
+}
+
+assert.eq(numDocs,
+          coll.aggregate([{$match: {x: {$gt: 0}}}], {cursor: {batchSize: 10}}).itcount());
+
+// Closing the cursor while its shard cursors are streaming closes them.
+const cursor = coll.find().sort({x: 1}).batchSize(10);
+for (let i = 0; i < 100; ++i) {
+    assert(cursor.hasNext());
+    cursor.next();
+}
+cursor.close();
+assert.soon(() => {
+    return [st.rs0, st.rs1].every(
+        (rs) => rs.getPrimary()
+                    .getDB("admin")
+                    .aggregate([
+                        {$currentOp: {idleCursors: true}},
+                        {$match: {type: "idleCursor", ns: coll.getFullName()}}
+                    ])
+                    .itcount() === 0);
+});
+
+st.stop();
+})();
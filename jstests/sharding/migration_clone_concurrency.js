@@ -0,0 +1,55 @@
+/**
+ * Tests that a chunk migration whose recipient clones through several concurrent streams
+ * ('migrateCloneConcurrency') transfers every document of the chunk exactly once. The chunk spans
+ * several _migrateClone batches, so that the streams clone it concurrently.
+ *
+ * @tags: [
+ *   featureFlagConcurrentMigrationClone,
+ *   requires_fcv_62,
+ * ]
+ */
+(function() {
+'use strict';
+
+const st = new ShardingTest({
+    shards: 2,
+    mongos: 1,
+    other: {
+        rsOptions: {
+            setParameter: {
+                migrateCloneConcurrency: 4,
+                migrateCloneInsertionBatchSize: 10,
+            },
+        },
+    },
+});
+
+const dbName = "test";
+const coll = st.s.getDB(dbName).coll;
+const numDocs = 4000;
+
+assert.commandWorked(st.s.adminCommand({enableSharding: dbName}));
+st.ensurePrimaryShard(dbName, st.shard0.shardName);
+assert.commandWorked(st.s.adminCommand({shardCollection: coll.getFullName(), key: {_id: 1}}));
+
+const bulk = coll.initializeUnorderedBulkOp();
+for (let i = 0; i < numDocs; ++i) {
+    bulk.insert({_id: i, padding: "x".repeat(10 * 1024)});
+}
+assert.commandWorked(bulk.execute());
+
+assert.commandWorked(st.s.adminCommand({
+    moveChunk: coll.getFullName(),
+    find: {_id: 0},
+    to: st.shard1.shardName,
+    _waitForDelete: true,
+}));
+
+const recipientColl = st.rs1.getPrimary().getDB(dbName).coll;
+assert.eq(numDocs, recipientColl.countDocuments({}));
+assert.eq(numDocs, recipientColl.aggregate([{$group: {_id: "$_id"}}]).itcount());
+assert.eq(0, st.rs0.getPrimary().getDB(dbName).coll.countDocuments({}));
+assert.eq(numDocs, coll.find().itcount());
+
+st.stop();
+})();
@@ -0,0 +1,123 @@
+/**
+ * Tests that mongos serves repeated finds on namespaces listed in
+ * 'clusterQueryResultCacheNamespaces' from its result cache, and that writes routed through mongos
+ * and routing changes invalidate the cached results.
+ *
+ * @tags: [
+ *   requires_fcv_62,
+ * ]
+ */
+(function() {
+'use strict';
+
+const st = new ShardingTest({
+    shards: 2,
+    mongos: 1,
+    other: {
+        mongosOptions: {
+            setParameter: {
+                clusterQueryResultCacheNamespaces: "test.reference",
+                clusterQueryResultCacheTTLMillis: 60 * 60 * 1000,
+            },
+        },
+    },
+});
+const mongos = st.s;
+const testDb = mongos.getDB("test");
+
+assert.commandWorked(mongos.adminCommand({enableSharding: "test"}));
+st.ensurePrimaryShard("test", st.shard0.shardName);
+
+assert.commandWorked(testDb.reference.insert([{_id: 0, v: "a"}, {_id: 1, v: "b"}]));
+assert.commandWorked(testDb.other.insert([{_id: 0, v: "a"}]));
+
+function cacheMetrics() {
+    return testDb.serverStatus().metrics.query.routerResultCache;
+}
+
+function runFind(collName, filter) {
+    const res = assert.commandWorked(testDb.runCommand({find: collName, filter: filter}));
+    assert.eq(0, res.cursor.id);
+    return res.cursor.firstBatch;
+}
+
+// The first find populates the cache and the second one is served from it.
+let before = cacheMetrics();
+assert.eq([{_id: 1, v: "b"}], runFind("reference", {v: "b"}));
+assert.eq([{_id: 1, v: "b"}], runFind("reference", {v: "b"}));
+let after = cacheMetrics();
+assert.eq(before.inserts + 1, after.inserts, tojson(after));
+assert.eq(before.hits + 1, after.hits, tojson(after));
+
+// Logically identical filters share an entry.
+before = cacheMetrics();
+assert.eq(1, runFind("reference", {v: {$in: ["b"]}, _id: {$gte: 0}}).length);
+assert.eq(1, runFind("reference", {_id: {$gte: 0}, v: {$in: ["b"]}}).length);
+after = cacheMetrics();
+assert.eq(before.inserts + 1, after.inserts, tojson(after));
+assert.eq(before.hits + 1, after.hits, tojson(after));
+
+// A write routed through mongos invalidates the cached results of its namespace.
+assert.commandWorked(testDb.reference.insert({_id: 2, v: "b"}));
+assert.eq([{_id: 1, v: "b"}, {_id: 2, v: "b"}], runFind("reference", {v: "b"}));
+
+// So does a change to the routing information of the collection.
+before = cacheMetrics();
+assert.eq(2, runFind("reference", {v: "b"}).length);
+assert.commandWorked(mongos.adminCommand({shardCollection: "test.reference", key: {_id: 1}}));
+assert.eq(2, runFind("reference", {v: "b"}).length);
+after = cacheMetrics();
+assert.eq(before.hits + 1, after.hits, tojson(after));
+
+// A hit reports the operationTime of the reads which filled the entry.
+assert.commandWorked(testDb.reference.insert({_id: 3, v: "c"}));
+const fillRes = assert.commandWorked(testDb.runCommand({find: "reference", filter: {v: "c"}}));
+assert.commandWorked(testDb.other.insert({_id: 2, v: "c"}));
+before = cacheMetrics();
+const hitRes = assert.commandWorked(testDb.runCommand({find: "reference", filter: {v: "c"}}));
+after = cacheMetrics();
+assert.eq(before.hits + 1, after.hits, tojson(after));
+assert.eq(fillRes.operationTime, hitRes.operationTime, tojson(hitRes));
+
+// Queries whose result may differ between runs against the same data bypass the cache.
+before = cacheMetrics();
+for (let i = 0; i < 2; ++i) {
+    runFind("reference", {$expr: {$lt: [{$rand: {}}, 2]}});
+    runFind("reference", {$sampleRate: 1});
+    runFind("reference", {$expr: {$lt: ["$_id", {$year: "$$NOW"}]}});
+    runFind("reference", {$expr: {$gt: ["$$CLUSTER_TIME", Timestamp(0, 0)]}});
+    assert.commandWorked(testDb.runCommand({
+        find: "reference",
+        filter: {$expr: {$lt: ["$_id", "$$year"]}},
+        let : {year: {$year: "$$NOW"}},
+    }));
+    assert.commandWorked(
+        testDb.runCommand({find: "reference", filter: {}, projection: {now: "$$NOW"}}));
+}
+after = cacheMetrics();
+assert.eq(before.hits, after.hits, tojson(after));
+assert.eq(before.inserts, after.inserts, tojson(after));
+
+// Namespaces which are not listed, transactions, and causally consistent reads bypass the cache.
+before = cacheMetrics();
+runFind("other", {v: "a"});
+runFind("other", {v: "a"});
+
+const session = mongos.startSession({causalConsistency: true});
+const sessionColl = session.getDatabase("test").reference;
+// Establish an operationTime for the session, so that its reads carry an afterClusterTime.
+assert.commandWorked(session.getDatabase("test").other.insert({_id: 1, v: "b"}));
+assert.eq(2, sessionColl.find({v: "b"}).itcount());
+assert.eq(2, sessionColl.find({v: "b"}).itcount());
+
+session.startTransaction();
+assert.eq(2, sessionColl.find({v: "b"}).itcount());
+assert.commandWorked(session.commitTransaction_forTesting());
+session.endSession();
+
+after = cacheMetrics();
+assert.eq(before.hits, after.hits, tojson(after));
+assert.eq(before.misses, after.misses, tojson(after));
+
+st.stop();
+})();
@@ -0,0 +1,79 @@
+/**
+ * Tests that a resharding operation whose recipients clone the collection through several
+ * concurrent _id ranges ('reshardingCollectionClonerConcurrency') and build its indexes in bulk
+ * once cloning is done ('reshardingRecipientBuildIndexesAfterCloning') clones every document
+ * exactly once and ends up with all of the collection's indexes, including the index on the new
+ * shard key.
+ *
+ * @tags: [
+ *   requires_fcv_62,
+ *   uses_atclustertime,
+ * ]
+ */
+(function() {
+"use strict";
+
+load("jstests/libs/discover_topology.js");
+load("jstests/sharding/libs/resharding_test_fixture.js");
+
+const reshardingTest = new ReshardingTest({numDonors: 2, numRecipients: 2, reshardInPlace: true});
+
+reshardingTest.setup();
+
+const donorShardNames = reshardingTest.donorShardNames;
+const inputCollection = reshardingTest.createShardedCollection({
+    ns: "reshardingDb.coll",
+    shardKeyPattern: {oldKey: 1},
+    chunks: [
+        {min: {oldKey: MinKey}, max: {oldKey: 0}, shard: donorShardNames[0]},
+        {min: {oldKey: 0}, max: {oldKey: MaxKey}, shard: donorShardNames[1]},
+    ],
+});
+
+assert.commandWorked(inputCollection.createIndex({extra: 1}));
+
+const numDocs = 2000;
+const bulk = inputCollection.initializeUnorderedBulkOp();
+for (let i = 0; i < numDocs; ++i) {
+    bulk.insert({_id: i, oldKey: i % 2 ? i : -i, newKey: i % 3 - 1, extra: i % 7});
+}
+assert.commandWorked(bulk.execute());
+
+const mongos = inputCollection.getMongo();
+const topology = DiscoverTopology.findConnectedNodes(mongos);
+const recipientShardNames = reshardingTest.recipientShardNames;
+const recipients = recipientShardNames.map(
+    shardName => new Mongo(topology.shards[shardName].primary));
+
+for (const recipient of recipients) {
+    assert.commandWorked(recipient.adminCommand({
+        setParameter: 1,
+        reshardingCollectionClonerConcurrency: 4,
+        reshardingRecipientBuildIndexesAfterCloning: true,
+    }));
+}
+
+reshardingTest.withReshardingInBackground({
+    newShardKeyPattern: {newKey: 1},
+    newChunks: [
+        {min: {newKey: MinKey}, max: {newKey: 0}, shard: recipientShardNames[0]},
+        {min: {newKey: 0}, max: {newKey: MaxKey}, shard: recipientShardNames[1]},
+    ],
+});
+
+let numClonedDocs = 0;
+for (const recipient of recipients) {
+    const coll = recipient.getCollection(inputCollection.getFullName());
+    const numDocsOnRecipient = coll.countDocuments({});
+    assert.eq(numDocsOnRecipient, coll.aggregate([{$group: {_id: "$_id"}}]).itcount());
+    numClonedDocs += numDocsOnRecipient;
+
+    const indexNames = coll.getIndexes().map(index => index.name).sort();
+    assert.eq(["_id_", "extra_1", "newKey_1", "oldKey_1"], indexNames, tojson(indexNames));
+}
+
+assert.eq(numDocs, numClonedDocs);
+assert.eq(numDocs, inputCollection.find().itcount());
+
+reshardingTest.teardown();
+})();
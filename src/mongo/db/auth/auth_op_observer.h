@@ -113,7 +113,7 @@ public:
                             const CollectionOptions& options,
                             const BSONObj& idIndex,
                             const OplogSlot& createOpTime,
-                            bool fromMigrate) final;
+                            bool fromMigrate) final {}
 
     void onCollMod(OperationContext* opCtx,
                    const NamespaceString& nss,
@@ -179,6 +179,15 @@ public:
                        const NamespaceString& collectionName,
                        const UUID& uuid) final;
 
+    void onTruncateRange(OperationContext* opCtx,
+                         const NamespaceString& collectionName,
+                         const UUID& uuid,
+                         const RecordId& minRecordId,
+                         const RecordId& maxRecordId,
+                         int64_t bytesDeleted,
+                         int64_t docsDeleted,
+                         bool fromMigrate) final {}
+
     void onUnpreparedTransactionCommit(OperationContext* opCtx,
                                        std::vector<repl::ReplOperation>* statements,
                                        size_t numberOfPrePostImagesToWrite) final {}
@@ -0,0 +1,106 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/batched_delete_pacer.h"
+
+#include <algorithm>
+
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/kv/kv_engine.h"
+#include "mongo/db/storage/storage_engine.h"
+#include "mongo/util/concurrency/ticketholder.h"
+
+namespace mongo {
+namespace {
+
+bool isMajorityCommitPointLagging(OperationContext* opCtx, Seconds maxLag) {
+    if (maxLag == Seconds(0)) {
+        return false;
+    }
+
+    const auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    if (!replCoord->isReplEnabled()) {
+        return false;
+    }
+
+    const auto lastApplied = replCoord->getMyLastAppliedOpTimeAndWallTime().wallTime;
+    const auto lastCommitted = replCoord->getLastCommittedOpTimeAndWallTime().wallTime;
+    if (lastApplied == Date_t() || lastCommitted == Date_t()) {
+        return false;
+    }
+
+    return lastApplied - lastCommitted > maxLag;
+}
+
+bool isCacheDirty(OperationContext* opCtx, int maxDirtyPercent) {
+    if (maxDirtyPercent == 0) {
+        return false;
+    }
+
+    auto storageEngine = opCtx->getServiceContext()->getStorageEngine();
+    if (!storageEngine) {
+        return false;
+    }
+
+    auto dirtyRatio = storageEngine->getEngine()->getCacheDirtyRatio();
+    return dirtyRatio && *dirtyRatio * 100 > maxDirtyPercent;
+}
+
+bool areOperationsQueuedForTickets(OperationContext* opCtx) {
+    auto ticketHolder = TicketHolder::get(opCtx->getServiceContext());
+    return ticketHolder && ticketHolder->queued() > 0;
+}
+
+}  // namespace
+
+bool BatchedDeletePacer::isUnderPressure(OperationContext* opCtx, const Options& options) {
+    return isMajorityCommitPointLagging(opCtx, options.maxReplicationLag) ||
+        isCacheDirty(opCtx, options.maxDirtyCachePercent) ||
+        (options.checkTicketQueue && areOperationsQueuedForTickets(opCtx));
+}
+
+Milliseconds BatchedDeletePacer::delayAfterBatch(Milliseconds batchTime,
+                                                 bool underPressure,
+                                                 const Options& options) {
+    _backoff = underPressure ? std::min(_backoff * 2, kMaxBackoff) : std::max(_backoff / 2, 1);
+
+    const int dutyCyclePercent = options.dutyCyclePercent;
+    auto delay =
+        std::max(batchTime * (100 - dutyCyclePercent) / dutyCyclePercent, options.minDelay);
+    if (_backoff > 1) {
+        // Back off by multiples of the batch time even when the duty cycle alone would not wait,
+        // and by at least a millisecond per step for batches which complete faster than that.
+        delay = std::max({delay, batchTime, Milliseconds(1)}) * _backoff;
+    }
+    return std::min(delay, options.maxDelay);
+}
+
+}  // namespace mongo
@@ -0,0 +1,106 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+class OperationContext;
+
+/**
+ * Paces a background task which deletes documents in batches, such as the range deleter, so that
+ * it leaves room for foreground operations.
+ *
+ * After each batch, the task waits long enough to keep the time it spends deleting within a duty
+ * cycle. The wait doubles, up to kMaxBackoff times, after each batch which ends while the node is
+ * under pressure, and halves after each batch which does not.
+ */
+class BatchedDeletePacer {
+public:
+    static constexpr int kMaxBackoff = 64;
+
+    struct Options {
+        // The percentage of the elapsed time the task may spend deleting, between 1 and 100.
+        int dutyCyclePercent = 100;
+
+        // The shortest wait between two batches.
+        Milliseconds minDelay{0};
+
+        // The longest wait between two batches.
+        Milliseconds maxDelay = Milliseconds::max();
+
+        // The majority commit point lag above which the node is under pressure. 0 disables the
+        // check.
+        Seconds maxReplicationLag{0};
+
+        // The percentage of the storage engine cache holding dirty data above which the node is
+        // under pressure. 0 disables the check.
+        int maxDirtyCachePercent = 0;
+
+        // Whether operations waiting for execution tickets put the node under pressure.
+        bool checkTicketQueue = false;
+    };
+
+    /**
+     * Returns whether the node is under any of the kinds of pressure enabled in 'options'.
+     */
+    static bool isUnderPressure(OperationContext* opCtx, const Options& options);
+
+    /**
+     * Returns how long to wait after a batch which took 'batchTime', checking whether the node is
+     * under pressure through 'opCtx'.
+     */
+    Milliseconds delayAfterBatch(OperationContext* opCtx,
+                                 Milliseconds batchTime,
+                                 const Options& options) {
+        return delayAfterBatch(batchTime, isUnderPressure(opCtx, options), options);
+    }
+
+    /**
+     * Returns how long to wait after a batch which took 'batchTime', given whether the node is
+     * under pressure.
+     */
+    Milliseconds delayAfterBatch(Milliseconds batchTime,
+                                 bool underPressure,
+                                 const Options& options);
+
+    /**
+     * Returns the current multiplier of the waits.
+     */
+    int getBackoff() const {
+        return _backoff;
+    }
+
+private:
+    int _backoff = 1;
+};
+
+}  // namespace mongo
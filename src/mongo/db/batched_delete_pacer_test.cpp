@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/batched_delete_pacer.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(BatchedDeletePacerTest, WaitsToStayWithinDutyCycle) {
+    BatchedDeletePacer pacer;
+    BatchedDeletePacer::Options options;
+
+    options.dutyCyclePercent = 100;
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), false, options), Milliseconds(0));
+
+    options.dutyCyclePercent = 50;
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), false, options), Milliseconds(100));
+
+    options.dutyCyclePercent = 20;
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), false, options), Milliseconds(400));
+
+    options.minDelay = Milliseconds(500);
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), false, options), Milliseconds(500));
+    ASSERT_EQ(pacer.getBackoff(), 1);
+}
+
+TEST(BatchedDeletePacerTest, BacksOffUnderPressure) {
+    BatchedDeletePacer pacer;
+    BatchedDeletePacer::Options options;
+    options.dutyCyclePercent = 50;
+
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), true, options), Milliseconds(200));
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), true, options), Milliseconds(400));
+    for (int i = 0; i < 10; ++i) {
+        pacer.delayAfterBatch(Milliseconds(100), true, options);
+    }
+    ASSERT_EQ(pacer.getBackoff(), BatchedDeletePacer::kMaxBackoff);
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), true, options),
+              Milliseconds(100) * BatchedDeletePacer::kMaxBackoff);
+
+    // The backoff halves once the pressure is gone.
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), false, options),
+              Milliseconds(100) * BatchedDeletePacer::kMaxBackoff / 2);
+    while (pacer.getBackoff() > 1) {
+        pacer.delayAfterBatch(Milliseconds(100), false, options);
+    }
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), false, options), Milliseconds(100));
+}
+
+TEST(BatchedDeletePacerTest, BacksOffByBatchTimeWithFullDutyCycle) {
+    BatchedDeletePacer pacer;
+    BatchedDeletePacer::Options options;
+    options.dutyCyclePercent = 100;
+    options.maxDelay = Milliseconds(300);
+
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), true, options), Milliseconds(200));
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(100), true, options), Milliseconds(300));
+}
+
+TEST(BatchedDeletePacerTest, BacksOffFromBatchesFasterThanAMillisecond) {
+    BatchedDeletePacer pacer;
+    BatchedDeletePacer::Options options;
+    options.dutyCyclePercent = 100;
+
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(0), true, options), Milliseconds(2));
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(0), true, options), Milliseconds(4));
+
+    while (pacer.getBackoff() > 1) {
+        pacer.delayAfterBatch(Milliseconds(0), false, options);
+    }
+    ASSERT_EQ(pacer.delayAfterBatch(Milliseconds(0), false, options), Milliseconds(0));
+}
+
+}  // namespace
+}  // namespace mongo
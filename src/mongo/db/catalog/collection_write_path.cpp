@@ -32,9 +32,12 @@
 #include "mongo/crypto/fle_crypto.h"
 #include "mongo/db/catalog/capped_collection_maintenance.h"
 #include "mongo/db/catalog/document_validation.h"
+#include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/catalog/local_oplog_info.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/op_observer/op_observer.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/fail_point.h"
 
@@ -178,6 +181,16 @@ Status insertDocumentsImpl(OperationContext* opCtx,
     return Status::OK();
 }
 
+bool isTruncatableCollection(OperationContext* opCtx, const CollectionPtr& collection) {
+    // A truncate neither unindexes the documents it removes nor reports them individually to the
+    // op observers, so nothing may depend on seeing each of them. The bucket catalog of time-series
+    // collections, for one, is only notified of deleted buckets by the op observers.
+    return collection->isClustered() && !collection->getTimeseriesOptions() &&
+        collection->getIndexCatalog()->numIndexesTotal(opCtx) == 0 &&
+        !collection->getRecordPreImages() && !collection->isChangeStreamPreAndPostImagesEnabled() &&
+        !opCtx->inMultiDocumentTransaction();
+}
+
 }  // namespace
 
 Status insertDocumentForBulkLoader(OperationContext* opCtx,
@@ -345,6 +358,68 @@ Status insertDocument(OperationContext* opCtx,
     return insertDocuments(opCtx, collection, docs.begin(), docs.end(), opDebug, fromMigrate);
 }
 
+bool canTruncateRange(OperationContext* opCtx, const CollectionPtr& collection) {
+    // Nodes of an earlier version cannot apply 'truncateRange' oplog entries.
+    return feature_flags::gTruncateRange.isEnabled(serverGlobalParams.featureCompatibility) &&
+        isTruncatableCollection(opCtx, collection);
+}
+
+long long truncateRange(OperationContext* opCtx,
+                        const CollectionPtr& collection,
+                        const RecordId& minRecordId,
+                        const RecordId& maxRecordId,
+                        bool includeMax,
+                        long long maxDocs,
+                        bool fromMigrate) {
+    invariant(opCtx->lockState()->inAWriteUnitOfWork());
+    dassert(opCtx->lockState()->isCollectionLockedForMode(collection->ns(), MODE_IX));
+    dassert(isTruncatableCollection(opCtx, collection));
+
+    // The record store only takes the size changes as hints, so count the documents in the range
+    // to keep the size information and the oplog entry accurate.
+    RecordId firstRecordId;
+    RecordId lastRecordId;
+    long long docsDeleted = 0;
+    int64_t bytesDeleted = 0;
+    {
+        auto cursor = collection->getCursor(opCtx);
+        auto record = cursor->seekNear(minRecordId);
+        // 'seekNear' positions the cursor on the record preceding 'minRecordId' if it does not
+        // exist.
+        if (record && record->id < minRecordId) {
+            record = cursor->next();
+        }
+        for (; record; record = cursor->next()) {
+            if (record->id > maxRecordId || (!includeMax && record->id == maxRecordId) ||
+                (maxDocs > 0 && docsDeleted == maxDocs)) {
+                break;
+            }
+            if (docsDeleted == 0) {
+                firstRecordId = record->id;
+            }
+            lastRecordId = record->id;
+            ++docsDeleted;
+            bytesDeleted += record->data.size();
+        }
+    }
+
+    if (docsDeleted == 0) {
+        return 0;
+    }
+
+    uassertStatusOK(collection->getRecordStore()->rangeTruncate(
+        opCtx, firstRecordId, lastRecordId, -bytesDeleted, -docsDeleted));
+    opCtx->getServiceContext()->getOpObserver()->onTruncateRange(opCtx,
+                                                                 collection->ns(),
+                                                                 collection->uuid(),
+                                                                 firstRecordId,
+                                                                 lastRecordId,
+                                                                 bytesDeleted,
+                                                                 docsDeleted,
+                                                                 fromMigrate);
+    return docsDeleted;
+}
+
 Status checkFailCollectionInsertsFailPoint(const NamespaceString& ns, const BSONObj& firstDoc) {
     Status s = Status::OK();
     failCollectionInserts.executeIf(
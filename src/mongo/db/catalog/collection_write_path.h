@@ -78,6 +78,33 @@ Status insertDocument(OperationContext* opCtx,
                       OpDebug* opDebug,
                       bool fromMigrate = false);
 
+/**
+ * Returns whether documents of 'collection' may be removed in bulk with 'truncateRange'. This
+ * requires 'featureFlagTruncateRange' to be enabled, and a clustered collection that is not a
+ * time-series buckets collection, has no secondary indexes and records neither pre-images nor
+ * change stream pre- and post-images, outside of a multi-document transaction. Callers fall back to
+ * deleting the documents one at a time otherwise.
+ */
+bool canTruncateRange(OperationContext* opCtx, const CollectionPtr& collection);
+
+/**
+ * Removes the documents of 'collection' with RecordIds in ['minRecordId', 'maxRecordId'], or in
+ * ['minRecordId', 'maxRecordId') if 'includeMax' is false, stopping after 'maxDocs' documents when
+ * it is positive. The documents are counted with a cursor but are removed with a single truncate of
+ * the record store, and are replicated as a single 'truncateRange' oplog entry rather than one
+ * delete per document. Returns the number of documents removed.
+ *
+ * Must be called in a WriteUnitOfWork on a collection for which 'canTruncateRange' is true, except
+ * when applying a 'truncateRange' oplog entry, which does not depend on the feature flag.
+ */
+long long truncateRange(OperationContext* opCtx,
+                        const CollectionPtr& collection,
+                        const RecordId& minRecordId,
+                        const RecordId& maxRecordId,
+                        bool includeMax,
+                        long long maxDocs,
+                        bool fromMigrate);
+
 /**
  * Checks the 'failCollectionInserts' fail point at the beginning of an insert operation to see if
  * the insert should fail. Returns Status::OK if The function should proceed with the insertion.
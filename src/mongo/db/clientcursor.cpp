@@ -154,6 +154,11 @@ GenericCursor ClientCursor::toGenericCursor() const {
         gc.setOperationUsingCursorId(opCtx->getOpID());
     }
     gc.setLastKnownCommittedOpTime(_lastKnownCommittedOpTime);
+    if (_readAheadBuffer.nBatches > 0) {
+        gc.setNReadAheadBatches(_readAheadBuffer.nBatches);
+        gc.setNReadAheadDocs(_readAheadBuffer.nDocs);
+        gc.setNDocsServedFromReadAhead(_readAheadBuffer.nDocsServed);
+    }
     return gc;
 }
 
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <deque>
 #include <functional>
 
 #include "mongo/client/read_preference.h"
@@ -299,6 +300,28 @@ public:
         _stashedRecoveryUnit = std::move(ru);
     }
 
+    /**
+     * Results which were produced by a background read-ahead of this cursor's executor after the
+     * last getMore returned (see commands/cursor_read_ahead.h). The next getMore serves these
+     * before asking the executor for more. May only be accessed while the cursor is pinned.
+     */
+    struct ReadAheadBuffer {
+        std::deque<BSONObj> docs;
+        std::size_t bytes = 0;
+
+        // The batchSize of the most recent getMore, used to size the next read-ahead.
+        std::size_t batchSize = 0;
+
+        // Diagnostics reported in $currentOp.
+        std::uint64_t nBatches = 0;
+        std::uint64_t nDocs = 0;
+        std::uint64_t nDocsServed = 0;
+    };
+
+    ReadAheadBuffer& getReadAheadBuffer() {
+        return _readAheadBuffer;
+    }
+
 private:
     friend class CursorManager;
     friend class ClientCursorPin;
@@ -439,6 +462,9 @@ private:
 
     // The client OperationKey associated with this cursor.
     boost::optional<OperationKey> _opKey;
+
+    // Results produced ahead of the next getMore. Only accessed while the cursor is pinned.
+    ReadAheadBuffer _readAheadBuffer;
 };
 
 /**
@@ -0,0 +1,271 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/commands/cursor_read_ahead.h"
+
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/cursor_manager.h"
+#include "mongo/db/cursor_server_params_gen.h"
+#include "mongo/db/db_raii.h"
+#include "mongo/db/query/find_common.h"
+#include "mongo/db/repl/read_concern_args.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/scopeguard.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
+
+
+namespace mongo {
+namespace {
+
+const auto getCursorReadAhead = ServiceContext::declareDecoration<CursorReadAhead>();
+
+const ServiceContext::ConstructorActionRegisterer cursorReadAheadRegisterer{
+    "CursorReadAhead",
+    [](ServiceContext* service) {},
+    [](ServiceContext* service) { getCursorReadAhead(service).shutdown(); }};
+
+CounterMetric readAheadBatchesMetric{"cursor.readAhead.batches"};
+CounterMetric readAheadDocsMetric{"cursor.readAhead.docs"};
+CounterMetric readAheadDocsServedMetric{"cursor.readAhead.docsServed"};
+CounterMetric readAheadSkippedMetric{"cursor.readAhead.skipped"};
+
+}  // namespace
+
+CursorReadAhead* CursorReadAhead::get(ServiceContext* svcCtx) {
+    return &getCursorReadAhead(svcCtx);
+}
+
+CursorReadAhead* CursorReadAhead::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+bool CursorReadAhead::shouldReadAhead(OperationContext* opCtx, const ClientCursor& cursor) {
+    if (gCursorReadAheadMaxBytes.load() <= 0) {
+        return false;
+    }
+
+    // Exhaust cursors already stream results without waiting for the next request, and tailable
+    // cursors would block waiting for inserts.
+    if (opCtx->isExhaust() || cursor.isTailable()) {
+        return false;
+    }
+
+    // Cursors that lock internally (e.g. aggregations) may touch several collections, and
+    // cursors in a transaction or with a stashed recovery unit are bound to their session's
+    // storage snapshot. Neither can be resumed by an unrelated operation.
+    auto exec = cursor.getExecutor();
+    if (exec->lockPolicy() != PlanExecutor::LockPolicy::kLockExternally ||
+        exec->isSaveRecoveryUnitAcrossCommandsEnabled() || cursor.getTxnNumber() ||
+        opCtx->inMultiDocumentTransaction()) {
+        return false;
+    }
+
+    // Only read concerns which read the latest data can be re-established without selecting a
+    // timestamped read source.
+    auto level = cursor.getReadConcernArgs().getLevel();
+    return level == repl::ReadConcernLevel::kLocalReadConcern ||
+        level == repl::ReadConcernLevel::kAvailableReadConcern;
+}
+
+void CursorReadAhead::scheduleReadAhead(CursorId cursorId) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    if (_shutdown || _inProgress.count(cursorId)) {
+        return;
+    }
+    _inProgress.emplace(cursorId, SharedPromise<void>{});
+
+    _getPool(lk).schedule([this, cursorId](Status status) {
+        ON_BLOCK_EXIT([&] { _finish(cursorId); });
+        if (!status.isOK()) {
+            return;
+        }
+        _readAhead(cursorId);
+    });
+}
+
+bool CursorReadAhead::waitForReadAhead(OperationContext* opCtx, CursorId cursorId) {
+    SharedSemiFuture<void> done;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto it = _inProgress.find(cursorId);
+        if (it == _inProgress.end()) {
+            return false;
+        }
+        done = it->second.getFuture();
+    }
+    done.get(opCtx);
+    return true;
+}
+
+void CursorReadAhead::shutdown() {
+    std::unique_ptr<ThreadPool> pool;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _shutdown = true;
+        pool = std::move(_pool);
+    }
+    if (pool) {
+        pool->shutdown();
+        pool->join();
+    }
+}
+
+ThreadPool& CursorReadAhead::_getPool(WithLock) {
+    if (!_pool) {
+        ThreadPool::Options options;
+        options.poolName = "CursorReadAhead";
+        options.minThreads = 0;
+        options.maxThreads = gCursorReadAheadMaxThreads;
+        _pool = std::make_unique<ThreadPool>(std::move(options));
+        _pool->startup();
+    }
+    return *_pool;
+}
+
+void CursorReadAhead::_finish(CursorId cursorId) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _inProgress.find(cursorId);
+    invariant(it != _inProgress.end());
+    it->second.emplaceValue();
+    _inProgress.erase(it);
+}
+
+void CursorReadAhead::_readAhead(CursorId cursorId) {
+    // This runs as a thread pool task, which must not throw. Any error which occurs before the
+    // executor resumes leaves the cursor untouched, so that the next getMore runs into it instead.
+    try {
+        ThreadClient tc("CursorReadAhead", getGlobalServiceContext());
+        {
+            stdx::lock_guard<Client> lk(*tc.get());
+            tc.get()->setSystemOperationKillableByStepdown(lk);
+        }
+        AuthorizationSession::get(cc())->grantInternalAuthorization(&cc());
+        auto uniqueOpCtx = cc().makeOperationContext();
+        auto opCtx = uniqueOpCtx.get();
+
+        boost::optional<ClientCursorPin> cursorPin;
+        try {
+            auto swPin = CursorManager::get(opCtx)->pinCursor(
+                opCtx, cursorId, {}, CursorManager::kNoCheckSession);
+            if (!swPin.isOK()) {
+                // The cursor was exhausted, killed or timed out since the getMore returned.
+                return;
+            }
+            cursorPin.emplace(std::move(swPin.getValue()));
+        } catch (const ExceptionFor<ErrorCodes::CursorInUse>&) {
+            // The next getMore arrived first, so there is nothing left to hide.
+            readAheadSkippedMetric.increment();
+            return;
+        }
+
+        auto& buffer = (*cursorPin)->getReadAheadBuffer();
+        auto exec = (*cursorPin)->getExecutor();
+        const auto maxBytes = static_cast<std::size_t>(gCursorReadAheadMaxBytes.load());
+        if (!buffer.docs.empty()) {
+            return;
+        }
+
+        {
+            stdx::lock_guard<Client> lk(*opCtx->getClient());
+            repl::ReadConcernArgs::get(opCtx) = (*cursorPin)->getReadConcernArgs();
+        }
+        ReadPreferenceSetting::get(opCtx) = (*cursorPin)->getReadPreferenceSetting();
+
+        AutoGetCollectionForReadMaybeLockFree readLock(opCtx,
+                                                       exec->nss(),
+                                                       AutoGetCollectionViewMode::kViewsForbidden,
+                                                       Date_t::max(),
+                                                       exec->getSecondaryNamespaces());
+
+        // If this node can no longer serve the read, leave the cursor alone and let the next
+        // getMore report the error.
+        if (!repl::ReplicationCoordinator::get(opCtx)
+                 ->checkCanServeReadsFor(opCtx, (*cursorPin)->nss(), true)
+                 .isOK()) {
+            readAheadSkippedMetric.increment();
+            return;
+        }
+
+        exec->reattachToOperationContext(opCtx);
+
+        std::uint64_t numDocs = 0;
+        try {
+            exec->restoreState(&readLock.getCollection());
+
+            BSONObj obj;
+            while (!FindCommon::enoughForGetMore(buffer.batchSize, numDocs) &&
+                   buffer.bytes < maxBytes &&
+                   PlanExecutor::ADVANCED == exec->getNext(&obj, nullptr)) {
+                buffer.bytes += obj.objsize();
+                buffer.docs.push_back(obj.getOwned());
+                ++numDocs;
+            }
+
+            exec->saveState();
+        } catch (const DBException& ex) {
+            // The executor may be unusable now. Kill the cursor so that the next getMore reports
+            // the error, as it would have had it run the executor itself.
+            LOGV2_DEBUG(7460200,
+                        2,
+                        "Cursor read-ahead failed",
+                        "cursorId"_attr = cursorId,
+                        "error"_attr = ex.toStatus());
+            exec->markAsKilled(ex.toStatus());
+        }
+
+        exec->detachFromOperationContext();
+
+        ++buffer.nBatches;
+        buffer.nDocs += numDocs;
+        readAheadBatchesMetric.increment();
+        readAheadDocsMetric.increment(numDocs);
+    } catch (const DBException& ex) {
+        LOGV2_DEBUG(7460201,
+                    2,
+                    "Skipped cursor read-ahead",
+                    "cursorId"_attr = cursorId,
+                    "error"_attr = ex.toStatus());
+        readAheadSkippedMetric.increment();
+    }
+}
+
+void CursorReadAhead::recordDocsServed(ClientCursor* cursor, std::uint64_t numDocs) {
+    cursor->getReadAheadBuffer().nDocsServed += numDocs;
+    readAheadDocsServedMetric.increment(numDocs);
+}
+
+}  // namespace mongo
@@ -0,0 +1,117 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include "mongo/db/clientcursor.h"
+#include "mongo/db/cursor_id.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/future.h"
+
+namespace mongo {
+
+/**
+ * Produces the next batch of a find cursor in the background after a getMore has returned, so
+ * that the following getMore can be answered from memory instead of paying the full execution
+ * latency on the critical path.
+ *
+ * Once a getMore has released its pin, it calls scheduleReadAhead(). A task on the read-ahead
+ * thread pool then pins the cursor like any other operation, acquires the collection lock through
+ * AutoGetCollectionForRead, and runs the cursor's PlanExecutor until it has produced the batch
+ * size of the last getMore or the 'cursorReadAheadMaxBytes' budget is reached. The results are
+ * kept in the cursor's ReadAheadBuffer and the cursor is unpinned again. The executor yields
+ * normally while doing so.
+ *
+ * A getMore which finds the cursor pinned by a read-ahead waits for it to finish through
+ * waitForReadAhead() instead of failing with CursorInUse. If the getMore pins the cursor first,
+ * the read-ahead gives up silently.
+ */
+class CursorReadAhead {
+    CursorReadAhead(const CursorReadAhead&) = delete;
+    CursorReadAhead& operator=(const CursorReadAhead&) = delete;
+
+public:
+    CursorReadAhead() = default;
+
+    static CursorReadAhead* get(ServiceContext* svcCtx);
+    static CursorReadAhead* get(OperationContext* opCtx);
+
+    /**
+     * Returns true if the pinned 'cursor' may be read ahead once the getMore running on 'opCtx'
+     * unpins it. Only cursors whose executor is locked externally, which are not tailable, and
+     * which do not belong to a transaction or to a snapshot read are eligible, since their state
+     * can be resumed by a different operation with the same read concern.
+     */
+    static bool shouldReadAhead(OperationContext* opCtx, const ClientCursor& cursor);
+
+    /**
+     * Schedules a read-ahead of the cursor with id 'cursorId'. Must be called after the getMore
+     * which used the cursor has released its pin.
+     */
+    void scheduleReadAhead(CursorId cursorId);
+
+    /**
+     * If a read-ahead of 'cursorId' is in progress, blocks until it completes and returns true.
+     * Returns false immediately otherwise. Throws if 'opCtx' is interrupted while waiting.
+     */
+    bool waitForReadAhead(OperationContext* opCtx, CursorId cursorId);
+
+    /**
+     * Records that a getMore returned 'numDocs' documents from the read-ahead buffer of the pinned
+     * 'cursor'.
+     */
+    static void recordDocsServed(ClientCursor* cursor, std::uint64_t numDocs);
+
+    /**
+     * Stops accepting new read-aheads and waits for the ones in progress to finish.
+     */
+    void shutdown();
+
+private:
+    void _readAhead(CursorId cursorId);
+    void _finish(CursorId cursorId);
+
+    ThreadPool& _getPool(WithLock);
+
+    Mutex _mutex = MONGO_MAKE_LATCH("CursorReadAhead::_mutex");
+
+    // Promises fulfilled when the read-ahead of the given cursor completes, whether it produced
+    // any results or not.
+    stdx::unordered_map<CursorId, SharedPromise<void>> _inProgress;
+
+    // Created on first use so that nodes which never enable read-ahead do not spawn threads.
+    std::unique_ptr<ThreadPool> _pool;
+    bool _shutdown = false;
+};
+
+}  // namespace mongo
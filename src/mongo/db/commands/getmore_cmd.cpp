@@ -40,6 +40,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/commands.h"
+#include "mongo/db/commands/cursor_read_ahead.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/curop_failpoint_helpers.h"
 #include "mongo/db/cursor_manager.h"
@@ -321,7 +322,8 @@ public:
     public:
         Invocation(Command* cmd, const OpMsgRequest& request)
             : CommandInvocation(cmd),
-              _cmd(GetMoreCommandRequest::parse(IDLParserContext{"getMore"}, request)) {
+              _cmd(GetMoreCommandRequest::parse(IDLParserContext{"getMore"}, request)),
+              _cmdObj(request.body) {
             NamespaceString nss(_cmd.getDbName(), _cmd.getCollection());
             uassert(ErrorCodes::InvalidNamespace,
                     str::stream() << "Invalid namespace for getMore: " << nss.ns(),
@@ -382,6 +384,39 @@ public:
             BSONObj obj;
             PlanExecutor::ExecState state;
             size_t batchSize = cmd.getBatchSize().value_or(0);
+
+            // Serve any results which were read ahead since the last getMore first. They precede
+            // everything the executor has yet to return.
+            auto& readAhead = cursor->getReadAheadBuffer();
+            readAhead.batchSize = batchSize;
+            if (!readAhead.docs.empty()) {
+                std::uint64_t numServed = 0;
+                while (!readAhead.docs.empty() &&
+                       !FindCommon::enoughForGetMore(batchSize, *numResults) &&
+                       FindCommon::haveSpaceForNext(
+                           readAhead.docs.front(), *numResults, nextBatch->bytesUsed())) {
+                    obj = std::move(readAhead.docs.front());
+                    readAhead.docs.pop_front();
+                    readAhead.bytes -= obj.objsize();
+
+                    if (*numResults == 0) {
+                        nextBatch->reserveReplyBuffer(FindCommon::getBytesToReserveForGetMoreReply(
+                            isTailable, obj.objsize(), batchSize));
+                    }
+                    nextBatch->append(obj);
+                    (*numResults)++;
+                    numServed++;
+                    docUnitsReturned->observeOne(obj.objsize());
+                }
+                CursorReadAhead::recordDocsServed(cursor, numServed);
+
+                // Results must be returned in order, so the executor cannot contribute to this
+                // batch while some read-ahead results are still waiting.
+                if (!readAhead.docs.empty()) {
+                    return true;
+                }
+            }
+
             try {
                 while (!FindCommon::enoughForGetMore(batchSize, *numResults) &&
                        PlanExecutor::ADVANCED == (state = exec->getNext(&obj, nullptr))) {
@@ -449,10 +484,14 @@ public:
                 nextBatch->setPostBatchResumeToken(exec->getPostBatchResumeToken());
             }
 
-            return shouldSaveCursorGetMore(exec, isTailable);
+            return shouldSaveCursorGetMore(exec, isTailable) || !readAhead.docs.empty();
         }
 
-        void acquireLocksAndIterateCursor(OperationContext* opCtx,
+        /**
+         * Returns true if the cursor was saved and its next batch may be read ahead in the
+         * background once it is unpinned.
+         */
+        bool acquireLocksAndIterateCursor(OperationContext* opCtx,
                                           rpc::ReplyBuilderInterface* reply,
                                           ClientCursorPin& cursorPin,
                                           CurOp* curOp) {
@@ -725,11 +764,23 @@ public:
                 cursorDeleter.dismiss();
 
                 if (opCtx->isExhaust()) {
-                    // Indicate that an exhaust message should be generated and the previous BSONObj
-                    // command parameters should be reused as the next BSONObj command parameters.
-                    reply->setNextInvocation(boost::none);
+                    if (auto exhaustBatches = _cmd.getExhaustBatches()) {
+                        // The stream ends once the requested number of batches has been sent, and
+                        // the client continues it with another getMore once it has room for more.
+                        if (*exhaustBatches > 1) {
+                            reply->setNextInvocation(
+                                _makeNextExhaustInvocation(*exhaustBatches - 1));
+                        }
+                    } else {
+                        // Indicate that an exhaust message should be generated and the previous
+                        // BSONObj command parameters should be reused as the next BSONObj command
+                        // parameters.
+                        reply->setNextInvocation(boost::none);
+                    }
                 }
             }
+
+            return respondWithId && CursorReadAhead::shouldReadAhead(opCtx, *cursorPin.getCursor());
         }
 
         void run(OperationContext* opCtx, rpc::ReplyBuilderInterface* reply) override {
@@ -769,14 +820,27 @@ public:
                 validateMaxTimeMS(_cmd.getMaxTimeMS(), cc);
             };
 
-            auto cursorPin =
-                uassertStatusOK(CursorManager::get(opCtx)->pinCursor(opCtx, cursorId, pinCheck));
+            auto cursorPin = [&] {
+                try {
+                    return uassertStatusOK(
+                        CursorManager::get(opCtx)->pinCursor(opCtx, cursorId, pinCheck));
+                } catch (const ExceptionFor<ErrorCodes::CursorInUse>&) {
+                    // The cursor may be pinned by a background read-ahead of this batch. If so,
+                    // wait for it and use its results rather than failing the getMore.
+                    if (!CursorReadAhead::get(opCtx)->waitForReadAhead(opCtx, cursorId)) {
+                        throw;
+                    }
+                    return uassertStatusOK(
+                        CursorManager::get(opCtx)->pinCursor(opCtx, cursorId, pinCheck));
+                }
+            }();
 
             // Get the read concern level here in case the cursor is exhausted while iterating.
             const auto isLinearizableReadConcern = cursorPin->getReadConcernArgs().getLevel() ==
                 repl::ReadConcernLevel::kLinearizableReadConcern;
 
-            acquireLocksAndIterateCursor(opCtx, reply, cursorPin, curOp);
+            const auto shouldReadAhead =
+                acquireLocksAndIterateCursor(opCtx, reply, cursorPin, curOp);
 
             if (MONGO_unlikely(getMoreHangAfterPinCursor.shouldFail())) {
                 LOGV2(20477,
@@ -806,6 +870,12 @@ public:
                     "waitBeforeUnpinningOrDeletingCursorAfterGetMoreBatch");
             }
 
+            if (shouldReadAhead) {
+                // The next batch can only be produced once this operation has unpinned the cursor.
+                cursorPin.release();
+                CursorReadAhead::get(opCtx)->scheduleReadAhead(cursorId);
+            }
+
             if (getTestCommandsEnabled()) {
                 validateResult(reply);
             }
@@ -817,7 +887,25 @@ public:
                                       ret.removeField("ok"));
         }
 
+        /**
+         * Returns the command parameters of this getMore with 'exhaustBatches' replaced by the
+         * number of batches which remain to be streamed.
+         */
+        BSONObj _makeNextExhaustInvocation(std::int64_t remainingBatches) const {
+            BSONObjBuilder niBuilder;
+            for (const auto& elem : _cmdObj) {
+                if (elem.fieldNameStringData() == GetMoreCommandRequest::kExhaustBatchesFieldName) {
+                    niBuilder.append(GetMoreCommandRequest::kExhaustBatchesFieldName,
+                                     remainingBatches);
+                } else {
+                    niBuilder.append(elem);
+                }
+            }
+            return niBuilder.obj();
+        }
+
         const GetMoreCommandRequest _cmd;
+        const BSONObj _cmdObj;
     };
 
     bool maintenanceOk() const override {
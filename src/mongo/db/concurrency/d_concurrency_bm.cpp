@@ -36,6 +36,7 @@
 #include "mongo/db/storage/recovery_unit_noop.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/processinfo.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kTest
 
@@ -81,6 +82,7 @@ public:
      */
     void makeKClientsWithLockers(int k) {
         clients.reserve(k);
+        locker.resize(std::max<size_t>(locker.size(), k));
         for (int i = 0; i < k; ++i) {
             auto client = getGlobalServiceContext()->makeClient(str::stream()
                                                                 << "test client for thread " << i);
@@ -93,7 +95,7 @@ public:
 protected:
     std::vector<std::pair<ServiceContext::UniqueClient, ServiceContext::UniqueOperationContext>>
         clients;
-    std::array<std::unique_ptr<LockerImpl>, kMaxPerfThreads> locker;
+    std::vector<std::unique_ptr<LockerImpl>> locker;
 };
 
 BENCHMARK_DEFINE_F(DConcurrencyTest, BM_StdMutex)(benchmark::State& state) {
@@ -200,6 +202,53 @@ BENCHMARK_DEFINE_F(DConcurrencyTest, BM_CollectionExclusiveLock)(benchmark::Stat
     }
 }
 
+/**
+ * Like BM_CollectionIntentSharedLock, but every thread locks a collection of its own, so the
+ * threads only share the global and database resources.
+ */
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_CollectionIntentSharedLockPerThread)
+(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+    }
+
+    DatabaseName dbName(boost::none, "test");
+    NamespaceString nss("test.coll" + std::to_string(state.thread_index));
+    for (auto keepRunning : state) {
+        Lock::DBLock dlk(clients[state.thread_index].second.get(), dbName, MODE_IS);
+        Lock::CollectionLock clk(clients[state.thread_index].second.get(), nss, MODE_IS);
+    }
+
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
+/**
+ * Like BM_CollectionIntentExclusiveLock, but thread 0 takes the collection lock in MODE_X once
+ * every 1000 iterations, which makes the intent locks take the slow path until it is released.
+ */
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_CollectionIntentExclusiveLockWithConflicts)
+(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+    }
+
+    DatabaseName dbName(boost::none, "test");
+    long long iterations = 0;
+    for (auto keepRunning : state) {
+        const bool exclusive = state.thread_index == 0 && ++iterations % 1000 == 0;
+        Lock::DBLock dlk(clients[state.thread_index].second.get(), dbName, MODE_IX);
+        Lock::CollectionLock clk(clients[state.thread_index].second.get(),
+                                 NamespaceString("test.coll"),
+                                 exclusive ? MODE_X : MODE_IX);
+    }
+
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_StdMutex)->ThreadRange(1, kMaxPerfThreads);
 
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_ResourceMutexShared)->ThreadRange(1, kMaxPerfThreads);
@@ -210,6 +259,11 @@ BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionIntentSharedLock)
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionIntentExclusiveLock)
     ->ThreadRange(1, kMaxPerfThreads);
 
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionIntentSharedLockPerThread)
+    ->ThreadRange(1, ProcessInfo::getNumAvailableCores());
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionIntentExclusiveLockWithConflicts)
+    ->ThreadRange(1, ProcessInfo::getNumAvailableCores());
+
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionSharedLock)->ThreadRange(1, kMaxPerfThreads);
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionExclusiveLock)->ThreadRange(1, kMaxPerfThreads);
 
@@ -94,6 +94,22 @@ static const int LockConflictsTable[] = {
 // Mask of modes
 const uint64_t intentModes = (1 << MODE_IS) | (1 << MODE_IX);
 
+/**
+ * Intent mode requests for these resources may be granted through a fast path slot. Other
+ * resources, such as mutexes, are rarely locked in intent modes.
+ */
+bool isFastPathEligible(ResourceId resId) {
+    const ResourceType type = resId.getType();
+    return type == RESOURCE_GLOBAL || type == RESOURCE_DATABASE || type == RESOURCE_COLLECTION;
+}
+
+/**
+ * Index of the count of requests in 'mode', which must be an intent mode, in a fast path slot.
+ */
+size_t fastPathCountIndex(LockMode mode) {
+    return mode == MODE_IS ? 0 : 1;
+}
+
 // Ensure we do not add new modes without updating the conflicts table
 MONGO_STATIC_ASSERT((sizeof(LockConflictsTable) / sizeof(LockConflictsTable[0])) == LockModesCount);
 
@@ -164,6 +180,10 @@ struct LockHead {
 
         conversionsCount = 0;
         compatibleFirstCount = 0;
+
+        fastPathSlot = -1;
+        fastPathBlocked = false;
+        fastPathModes = 0;
     }
 
     /**
@@ -209,7 +229,7 @@ struct LockHead {
 
         // New lock request. Queue after all granted modes and after any already requested
         // conflicting modes
-        if (conflicts(request->mode, grantedModes) ||
+        if (conflicts(request->mode, grantedModes | fastPathModes) ||
             (!compatibleFirstCount && conflicts(request->mode, conflictModes))) {
             request->status = LockRequest::STATUS_WAITING;
 
@@ -336,6 +356,30 @@ struct LockHead {
     // be switched to compatible-first. As long as this value is > 0, the policy will stay
     // compatible-first.
     uint32_t compatibleFirstCount;
+
+    //
+    // Fast path
+    //
+
+    // Index of the LockManager fast path slot owned by this resource, or -1 if it owns none. The
+    // slot is only released by cleanupUnusedLocks once no requests are counted in it.
+    int fastPathSlot;
+
+    // Whether this LockHead holds a block on its fast path slot, which it does exactly as long as
+    // it has granted or pending requests in non-intent modes.
+    bool fastPathBlocked;
+
+    // Bit-mask of the modes granted through the fast path slot, which is only maintained while
+    // the slot is blocked. Requests on the queues must treat these modes as granted.
+    uint32_t fastPathModes;
+
+    /**
+     * True iff this resource has requests in modes which intent requests granted through the fast
+     * path could conflict with.
+     */
+    bool needsFastPathBlocked() const {
+        return (grantedModes & ~intentModes) || conflictModes;
+    }
 };
 
 /**
@@ -467,6 +511,8 @@ std::map<LockerId, BSONObj> LockManager::getLockToClientMap(ServiceContext* serv
 LockManager::LockManager() {
     _lockBuckets = new LockBucket[_numLockBuckets];
     _partitions = new Partition[_numPartitions];
+    _fastPathSlots = new CacheExclusive<FastPathSlot>[kNumFastPathSlots];
+    _fastPathCounts = new Striped<FastPathStripe>();
 }
 
 LockManager::~LockManager() {
@@ -477,17 +523,29 @@ LockManager::~LockManager() {
         invariant(_lockBuckets[i].data.empty());
     }
 
+    for (unsigned i = 0; i < kNumFastPathSlots; i++) {
+        invariant(!_fastPathSlots[i]->resourceId.load());
+    }
+
     delete[] _lockBuckets;
     delete[] _partitions;
+    delete[] _fastPathSlots;
+    delete _fastPathCounts;
 }
 
 LockResult LockManager::lock(ResourceId resId, LockRequest* request, LockMode mode) {
     // Sanity check that requests are not being reused without proper cleanup
     invariant(request->recursiveCount == 1);
+    invariant(request->fastPathSlot < 0);
 
     request->partitioned = (mode == MODE_IX || mode == MODE_IS);
     request->mode = mode;
 
+    // Fastest path for intent locks, which does not take any mutex
+    if (request->partitioned && _tryLockFastPath(resId, request)) {
+        return LOCK_OK;
+    }
+
     // For intent modes, try the PartitionedLockHead
     if (request->partitioned) {
         Partition* partition = _getPartition(request);
@@ -513,8 +571,19 @@ LockResult LockManager::lock(ResourceId resId, LockRequest* request, LockMode mo
 
     LockHead* lock = bucket->findOrInsert(resId);
 
-    // Start a partitioned lock if possible
-    if (request->partitioned && !(lock->grantedModes & (~intentModes)) && !lock->conflictModes) {
+    // Intent locks use the fast path slot of the resource unless it is blocked, and any other mode
+    // blocks it before checking for conflicts with the requests granted through it.
+    if (request->partitioned) {
+        if (_lockFastPathLocked(lock, request)) {
+            return LOCK_OK;
+        }
+    } else {
+        _blockFastPath(lock);
+    }
+
+    // Start a partitioned lock if possible. Resources owning a fast path slot do not need one.
+    if (request->partitioned && lock->fastPathSlot < 0 && !(lock->grantedModes & (~intentModes)) &&
+        !lock->conflictModes) {
         Partition* partition = _getPartition(request);
         stdx::lock_guard<SimpleMutex> scopedLock(partition->mutex);
         PartitionedLockHead* partitionedLock = partition->findOrInsert(resId);
@@ -568,6 +637,24 @@ LockResult LockManager::convert(ResourceId resId, LockRequest* request, LockMode
         lock->migratePartitionedLockHeads();
     }
 
+    // A request granted through the fast path slot moves to the granted queue, so that the
+    // conversion can wait there like any other.
+    if (request->fastPathSlot >= 0) {
+        invariant(lock->fastPathSlot == request->fastPathSlot);
+        _fastPathCounts->forStripe(request->fastPathStripe)[request->fastPathSlot]
+            .granted[fastPathCountIndex(request->mode)]
+            .fetchAndSubtract(1);
+        request->fastPathSlot = -1;
+        request->partitioned = false;
+        request->lock = lock;
+        lock->grantedList.push_back(request);
+        lock->incGrantedModeCount(request->mode);
+    }
+
+    if (!(modeMask(newMode) & intentModes)) {
+        _blockFastPath(lock);
+    }
+
     // Construct granted mask without our current mode, so that it is not counted as
     // conflicting
     uint32_t grantedModesWithoutCurrentRequest = 0;
@@ -590,7 +677,7 @@ LockResult LockManager::convert(ResourceId resId, LockRequest* request, LockMode
     //
     // Because the check does not look into the conflict modes bitmap, it will grant L to
     // T1 in S mode, instead of block, which would otherwise cause deadlock.
-    if (conflicts(newMode, grantedModesWithoutCurrentRequest)) {
+    if (conflicts(newMode, grantedModesWithoutCurrentRequest | lock->fastPathModes)) {
         request->status = LockRequest::STATUS_CONVERTING;
         request->convertMode = newMode;
 
@@ -611,6 +698,18 @@ bool LockManager::unlock(LockRequest* request) {
     invariant(request->recursiveCount > 0);
     request->recursiveCount--;
 
+    if (request->fastPathSlot >= 0) {
+        // Only the Locker thread moves a request off the fast path, so no synchronization is
+        // needed to find out whether it is still counted in the slot.
+        invariant(request->status == LockRequest::STATUS_GRANTED);
+        if (request->recursiveCount > 0)
+            return false;
+
+        _unlockFastPath(request->fastPathSlot, request->fastPathStripe, request->mode);
+        request->fastPathSlot = -1;
+        return true;
+    }
+
     if (request->partitioned) {
         // Unlocking a lock that was acquired as partitioned. The lock request may since have
         // moved to the lock head, but there is no safe way to find out without synchronizing
@@ -736,6 +835,25 @@ void LockManager::_cleanupUnusedLocksInBucket(LockBucket* bucket) {
             invariant(lock->conflictList._back == nullptr);
             invariant(lock->conversionsCount == 0);
             invariant(lock->compatibleFirstCount == 0);
+            invariant(!lock->fastPathBlocked);
+
+            // The fast path slot can only be released once no requests are counted in it.
+            // Blocking it while checking makes any request racing with the release back off.
+            if (lock->fastPathSlot >= 0) {
+                FastPathSlot& slot = *_fastPathSlots[lock->fastPathSlot];
+                slot.blockers.fetchAndAdd(1);
+                const bool inUse = _fastPathModes(lock->fastPathSlot) != 0;
+                if (!inUse) {
+                    slot.lock = nullptr;
+                    slot.resourceId.store(0);
+                }
+                slot.blockers.fetchAndSubtract(1);
+
+                if (inUse) {
+                    it++;
+                    continue;
+                }
+            }
 
             bucket->data.erase(it++);
             deletedLockHeads++;
@@ -747,6 +865,12 @@ void LockManager::_cleanupUnusedLocksInBucket(LockBucket* bucket) {
 }
 
 void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
+    // Requests granted through the fast path slot may have been released since the modes were
+    // last computed.
+    if (lock->fastPathBlocked) {
+        lock->fastPathModes = _fastPathModes(lock->fastPathSlot);
+    }
+
     // Unblock any converting requests (because conversions are still counted as granted and
     // are on the granted queue).
     for (LockRequest* iter = lock->grantedList._front;
@@ -777,7 +901,8 @@ void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
                 }
             }
 
-            if (!conflicts(iter->convertMode, grantedModesWithoutCurrentRequest)) {
+            if (!conflicts(iter->convertMode,
+                           grantedModesWithoutCurrentRequest | lock->fastPathModes)) {
                 lock->conversionsCount--;
                 lock->decGrantedModeCount(iter->mode);
                 iter->status = LockRequest::STATUS_GRANTED;
@@ -816,7 +941,7 @@ void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
         // the granted queue.
         iterNext = iter->next;
 
-        if (conflicts(iter->mode, lock->grantedModes)) {
+        if (conflicts(iter->mode, lock->grantedModes | lock->fastPathModes)) {
             // If iter doesn't have a previous pointer, this means that it is at the front of the
             // queue. If we continue scanning the queue beyond this point, we will starve it by
             // granting more and more requests. However, if we newly transition to compatibleFirst
@@ -854,6 +979,13 @@ void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
     // with the bitmask on the modes.
     invariant((lock->grantedModes == 0) ^ (lock->grantedList._front != nullptr));
     invariant((lock->conflictModes == 0) ^ (lock->conflictList._front != nullptr));
+
+    // Once only intent modes are left, intent requests may use the fast path slot again.
+    if (lock->fastPathBlocked && !lock->needsFastPathBlocked()) {
+        _fastPathSlots[lock->fastPathSlot]->blockers.fetchAndSubtract(1);
+        lock->fastPathBlocked = false;
+        lock->fastPathModes = 0;
+    }
 }
 
 LockManager::LockBucket* LockManager::_getBucket(ResourceId resId) const {
@@ -864,6 +996,132 @@ LockManager::Partition* LockManager::_getPartition(LockRequest* request) const {
     return &_partitions[request->locker->getId() % _numPartitions];
 }
 
+bool LockManager::_tryLockFastPath(ResourceId resId, LockRequest* request) {
+    // Compatible-first requests change the policy of the LockHead, so they must be granted on it.
+    if (request->compatibleFirst) {
+        return false;
+    }
+
+    const unsigned slotIndex = resId % kNumFastPathSlots;
+    FastPathSlot& slot = *_fastPathSlots[slotIndex];
+    if (slot.resourceId.load() != static_cast<uint64_t>(resId) || slot.blockers.load()) {
+        return false;
+    }
+
+    // Count the request before checking again that the slot is unblocked and owned by the
+    // resource. Conflicting requests block the slot before summing its counts, so either they see
+    // this request or this request sees their block.
+    const unsigned stripeIndex = Striped<FastPathStripe>::currentThreadStripeIndex();
+    _fastPathCounts->forStripe(stripeIndex)[slotIndex]
+        .granted[fastPathCountIndex(request->mode)]
+        .fetchAndAdd(1);
+    if (slot.blockers.load() || slot.resourceId.load() != static_cast<uint64_t>(resId)) {
+        _unlockFastPath(slotIndex, stripeIndex, request->mode);
+        return false;
+    }
+
+    request->status = LockRequest::STATUS_GRANTED;
+    request->fastPathSlot = slotIndex;
+    request->fastPathStripe = stripeIndex;
+    return true;
+}
+
+bool LockManager::_lockFastPathLocked(LockHead* lock, LockRequest* request) {
+    if (request->compatibleFirst) {
+        return false;
+    }
+
+    if (lock->fastPathSlot < 0) {
+        // Only claim a free slot while there are no requests the fast path would bypass, and no
+        // partitioned requests, which conflicting requests would otherwise have to migrate too.
+        if (!isFastPathEligible(lock->resourceId) || lock->needsFastPathBlocked() ||
+            lock->partitioned()) {
+            return false;
+        }
+
+        const unsigned slotIndex = lock->resourceId % kNumFastPathSlots;
+        FastPathSlot& slot = *_fastPathSlots[slotIndex];
+        unsigned long long expected = 0;
+        if (!slot.resourceId.compareAndSwap(&expected, lock->resourceId)) {
+            return false;
+        }
+        slot.lock = lock;
+        lock->fastPathSlot = slotIndex;
+    }
+
+    if (lock->fastPathBlocked) {
+        return false;
+    }
+
+    const unsigned stripeIndex = Striped<FastPathStripe>::currentThreadStripeIndex();
+    _fastPathCounts->forStripe(stripeIndex)[lock->fastPathSlot]
+        .granted[fastPathCountIndex(request->mode)]
+        .fetchAndAdd(1);
+    request->status = LockRequest::STATUS_GRANTED;
+    request->fastPathSlot = lock->fastPathSlot;
+    request->fastPathStripe = stripeIndex;
+    return true;
+}
+
+void LockManager::_unlockFastPath(unsigned slotIndex, unsigned stripeIndex, LockMode mode) {
+    _fastPathCounts->forStripe(stripeIndex)[slotIndex]
+        .granted[fastPathCountIndex(mode)]
+        .fetchAndSubtract(1);
+
+    // Requests of the slot's owner may be waiting for this one to be released. The owner cannot
+    // release the slot while it has waiting requests, so the owner read here is the one to notify.
+    FastPathSlot& slot = *_fastPathSlots[slotIndex];
+    if (!slot.blockers.load()) {
+        return;
+    }
+
+    const unsigned long long owner = slot.resourceId.load();
+    if (!owner) {
+        return;
+    }
+
+    LockBucket* bucket = &_lockBuckets[owner % _numLockBuckets];
+    stdx::lock_guard<SimpleMutex> scopedLock(bucket->mutex);
+    if (slot.resourceId.load() != owner || !slot.lock->fastPathBlocked) {
+        return;
+    }
+
+    _onLockModeChanged(slot.lock, true);
+}
+
+void LockManager::_blockFastPath(LockHead* lock) {
+    if (lock->fastPathSlot < 0) {
+        return;
+    }
+
+    if (!lock->fastPathBlocked) {
+        _fastPathSlots[lock->fastPathSlot]->blockers.fetchAndAdd(1);
+        lock->fastPathBlocked = true;
+    }
+    lock->fastPathModes = _fastPathModes(lock->fastPathSlot);
+}
+
+uint32_t LockManager::_fastPathModes(unsigned slotIndex) const {
+    // Once the slot is blocked, only the requests counted before it was blocked and those backing
+    // off from it are counted. Every request is uncounted on the stripe it was counted on, even if
+    // its Locker has moved to another thread since, so the count of each stripe never drops below
+    // the number of requests still granted on it, and the sums never miss a granted request.
+    long long granted[2] = {0, 0};
+    _fastPathCounts->forEach([&](const FastPathStripe& stripe) {
+        granted[0] += stripe[slotIndex].granted[0].load();
+        granted[1] += stripe[slotIndex].granted[1].load();
+    });
+
+    uint32_t modes = 0;
+    if (granted[fastPathCountIndex(MODE_IS)] > 0) {
+        modes |= modeMask(MODE_IS);
+    }
+    if (granted[fastPathCountIndex(MODE_IX)] > 0) {
+        modes |= modeMask(MODE_IX);
+    }
+    return modes;
+}
+
 void LockManager::dump() const {
     BSONArrayBuilder locks;
     _buildLocksArray(getLockToClientMap(getGlobalServiceContext()), true, nullptr, &locks);
@@ -927,6 +1185,16 @@ void LockManager::_buildLocksArray(const std::map<LockerId, BSONObj>& lockToClie
                     }
                 }
             }
+            // Requests granted through the fast path slot are only known by their modes.
+            if (lock->fastPathSlot >= 0) {
+                auto arr = BSONArrayBuilder(o.subarrayStart("fastPathGrantedModes"));
+                const uint32_t fastPathModes = _fastPathModes(lock->fastPathSlot);
+                for (auto mode : {MODE_IS, MODE_IX}) {
+                    if (fastPathModes & modeMask(mode)) {
+                        arr.append(modeName(mode));
+                    }
+                }
+            }
         }
     }
 }
@@ -1002,6 +1270,8 @@ void LockRequest::initNew(Locker* locker, LockGrantNotification* notify) {
 
     lock = nullptr;
     partitionedLock = nullptr;
+    fastPathSlot = -1;
+    fastPathStripe = 0;
     prev = nullptr;
     next = nullptr;
     status = STATUS_NEW;
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <deque>
 #include <map>
@@ -43,7 +44,9 @@
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/unordered_map.h"
+#include "mongo/util/aligned.h"
 #include "mongo/util/concurrency/mutex.h"
+#include "mongo/util/striped_counter.h"
 
 namespace mongo {
 
@@ -191,6 +194,63 @@ private:
         Map data;
     };
 
+    // Intent mode requests for global, database and collection resources are granted without
+    // taking any mutex, by counting them in a slot owned by the resource, as long as the resource
+    // has no granted or pending request in any other mode. A request in any other mode blocks the
+    // slot under the resource's bucket mutex and then waits for the counted requests to drain,
+    // which they signal by notifying the resource's LockHead when they are released.
+    static constexpr unsigned kNumFastPathSlots = 128;
+
+    struct FastPathSlot {
+        // The resource which owns this slot, or 0 if the slot is free. Only changes under the
+        // bucket mutex of the owning resource, from 0 to a resource or from a resource to 0.
+        AtomicWord<unsigned long long> resourceId{0};
+
+        // Non-zero while intent requests for the owning resource must take the slow path.
+        AtomicWord<unsigned> blockers{0};
+
+        // LockHead of the owning resource. Protected by the owning resource's bucket mutex.
+        LockHead* lock = nullptr;
+    };
+
+    // Intent requests granted through each slot, in MODE_IS and in MODE_IX. The counts are
+    // striped by thread, so only their sums across all stripes are meaningful. A request is
+    // uncounted on the stripe it was counted on, as recorded in LockRequest::fastPathStripe.
+    struct FastPathCounts {
+        AtomicWord<long long> granted[2];
+    };
+    typedef std::array<FastPathCounts, kNumFastPathSlots> FastPathStripe;
+
+    /**
+     * Attempts to grant an intent mode request through the fast path slot of 'resId' without
+     * taking any mutex. Returns false if the request must take the slow path.
+     */
+    bool _tryLockFastPath(ResourceId resId, LockRequest* request);
+
+    /**
+     * Grants an intent mode request through the fast path slot of 'lock', claiming a free slot for
+     * it if possible, unless the slot is blocked. Must be called under the lock's bucket mutex.
+     */
+    bool _lockFastPathLocked(LockHead* lock, LockRequest* request);
+
+    /**
+     * Stops counting a request of 'mode' granted through the slot, which was counted on the stripe
+     * 'stripeIndex', and notifies the slot's owner if the slot is blocked.
+     */
+    void _unlockFastPath(unsigned slotIndex, unsigned stripeIndex, LockMode mode);
+
+    /**
+     * Makes the intent requests of 'lock' take the slow path from now on and refreshes the modes
+     * granted through its fast path slot, if it has one. Must be called under the lock's bucket
+     * mutex.
+     */
+    void _blockFastPath(LockHead* lock);
+
+    /**
+     * Returns the modes of the requests currently granted through the slot.
+     */
+    uint32_t _fastPathModes(unsigned slotIndex) const;
+
     /**
      * Retrieves the bucket in which the particular resource must reside. There is no need to
      * hold a lock when calling this function.
@@ -237,5 +297,8 @@ private:
 
     static const unsigned _numPartitions;
     Partition* _partitions;
+
+    CacheExclusive<FastPathSlot>* _fastPathSlots;
+    Striped<FastPathStripe>* _fastPathCounts;
 };
 }  // namespace mongo
@@ -460,6 +460,24 @@ struct LockRequest {
     // Protected by LockHead bucket's mutex
     PartitionedLockHead* partitionedLock;
 
+    // Index of the LockManager fast path slot through which this intent mode request was granted,
+    // or -1 if it was not granted through the fast path. A request can only transition from a fast
+    // path slot to 'lock', never the other way around.
+    //
+    // Written by LockManager on Locker thread
+    // Read by LockManager on Locker thread
+    // No synchronization
+    int fastPathSlot;
+
+    // Stripe of the fast path counts on which this request was counted when it was granted through
+    // the fast path. The request must be uncounted on the same stripe, even if the Locker has since
+    // moved to a thread of another stripe, so that the count of no stripe ever goes negative.
+    //
+    // Written by LockManager on Locker thread
+    // Read by LockManager on Locker thread
+    // No synchronization
+    unsigned fastPathStripe;
+
     // The linked list chain on which this request hangs off the owning lock head. The reason
     // intrusive linked list is used instead of the std::list class is to allow for entries to be
     // removed from the middle of the list in O(1) time, if they are known instead of having to
@@ -30,6 +30,7 @@
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/concurrency/lock_manager_test_help.h"
 #include "mongo/db/service_context_test_fixture.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/unittest.h"
 
@@ -962,4 +963,59 @@ TEST_F(LockManagerTest, Fairness) {
     ASSERT(lockMgr.unlock(&requestIX1));
 }
 
+TEST_F(LockManagerTest, FastPathIntentLocksConflictWithStrongModes) {
+    LockManager lockMgr;
+    const ResourceId resId(RESOURCE_COLLECTION, NamespaceString(boost::none, "TestDB.collection"));
+
+    // Uncontended intent locks are granted through the resource's fast path slot
+    LockerImpl lockerIS(getServiceContext());
+    LockRequestCombo requestIS(&lockerIS);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIS, MODE_IS));
+    ASSERT_GTE(requestIS.fastPathSlot, 0);
+
+    LockerImpl lockerIX(getServiceContext());
+    LockRequestCombo requestIX(&lockerIX);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIX, MODE_IX));
+    ASSERT_EQ(requestIS.fastPathSlot, requestIX.fastPathSlot);
+
+    // A conflicting lock waits for them
+    LockerImpl lockerX(getServiceContext());
+    LockRequestCombo requestX(&lockerX);
+    ASSERT(LOCK_WAITING == lockMgr.lock(resId, &requestX, MODE_X));
+
+    // Intent locks now queue up behind it
+    LockerImpl lockerIS1(getServiceContext());
+    LockRequestCombo requestIS1(&lockerIS1);
+    ASSERT(LOCK_WAITING == lockMgr.lock(resId, &requestIS1, MODE_IS));
+    ASSERT_LT(requestIS1.fastPathSlot, 0);
+
+    // Releasing the fast path locks, even from another thread, grants the X lock
+    ASSERT(lockMgr.unlock(&requestIS));
+    ASSERT_EQ(0, requestX.numNotifies);
+
+    bool unlocked = false;
+    stdx::thread([&] { unlocked = lockMgr.unlock(&requestIX); }).join();
+    ASSERT(unlocked);
+    ASSERT_EQ(LOCK_OK, requestX.lastResult);
+    ASSERT_EQ(1, requestX.numNotifies);
+    ASSERT_EQ(0, requestIS1.numNotifies);
+
+    ASSERT(lockMgr.unlock(&requestX));
+    ASSERT_EQ(LOCK_OK, requestIS1.lastResult);
+    ASSERT(lockMgr.unlock(&requestIS1));
+
+    // Once the X lock is gone, intent locks use the fast path again and can still be converted
+    LockerImpl lockerIS2(getServiceContext());
+    LockRequestCombo requestIS2(&lockerIS2);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIS2, MODE_IS));
+    ASSERT_GTE(requestIS2.fastPathSlot, 0);
+
+    ASSERT(LOCK_OK == lockMgr.convert(resId, &requestIS2, MODE_S));
+    ASSERT(requestIS2.mode == MODE_S);
+    ASSERT_LT(requestIS2.fastPathSlot, 0);
+
+    ASSERT(!lockMgr.unlock(&requestIS2));
+    ASSERT(lockMgr.unlock(&requestIS2));
+}
+
 }  // namespace mongo
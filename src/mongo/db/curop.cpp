@@ -959,6 +959,10 @@ void OpDebug::report(OperationContext* opCtx,
         pAttrs->add("remoteOpWaitMillis", durationCount<Milliseconds>(*remoteOpWaitTime));
     }
 
+    if (sortedMergeTime) {
+        pAttrs->add("sortedMergeMicros", durationCount<Microseconds>(*sortedMergeTime));
+    }
+
     pAttrs->add("durationMillis", durationCount<Milliseconds>(executionTime));
 }
 
@@ -1109,6 +1113,10 @@ void OpDebug::append(OperationContext* opCtx,
         b.append("remoteOpWaitMillis", durationCount<Milliseconds>(*remoteOpWaitTime));
     }
 
+    if (sortedMergeTime) {
+        b.append("sortedMergeMicros", durationCount<Microseconds>(*sortedMergeTime));
+    }
+
     b.appendNumber("millis", durationCount<Milliseconds>(executionTime));
 
     if (!curop.getPlanSummary().empty()) {
@@ -1395,6 +1403,12 @@ std::function<BSONObj(ProfileFilter::Args)> OpDebug::appendStaged(StringSet requ
         }
     });
 
+    addIfNeeded("sortedMergeMicros", [](auto field, auto args, auto& b) {
+        if (args.op.sortedMergeTime) {
+            b.append(field, durationCount<Microseconds>(*args.op.sortedMergeTime));
+        }
+    });
+
     // millis and durationMillis are the same thing. This is one of the few inconsistencies between
     // the profiler (OpDebug::append) and the log file (OpDebug::report), so for the profile filter
     // we support both names.
@@ -322,6 +322,9 @@ public:
     // Used to track the amount of time spent waiting for a response from remote operations.
     boost::optional<Microseconds> remoteOpWaitTime;
 
+    // Time spent by mongos merging the results of a sorted query from multiple shards.
+    boost::optional<Nanoseconds> sortedMergeTime;
+
     // Stores additive metrics.
     AdditiveMetrics additiveMetrics;
 
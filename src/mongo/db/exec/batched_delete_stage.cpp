@@ -143,9 +143,6 @@ BatchedDeleteStage::BatchedDeleteStage(
     tassert(6303800,
             "batched deletions only support multi-document deletions (multi: true)",
             _params->isMulti);
-    tassert(6303801,
-            "batched deletions do not support the 'fromMigrate' parameter",
-            !_params->fromMigrate);
     tassert(6303802,
             "batched deletions do not support the 'returnDelete' parameter",
             !_params->returnDeleted);
@@ -337,9 +334,13 @@ long long BatchedDeleteStage::_commitBatch(WorkingSetID* out,
         WorkingSetMember* member = _ws->get(workingSetMemberID);
 
         // Determine whether the document being deleted is owned by this shard, and the action
-        // to undertake if it isn't.
-        const auto action = docStillMatches ? _preWriteFilter.computeAction(member->doc.value())
-                                            : write_stage_common::PreWriteFilter::Action::kSkip;
+        // to undertake if it isn't. Deletions on behalf of a migration (e.g. range deletions) are
+        // expected to target documents the shard doesn't own.
+        auto action = write_stage_common::PreWriteFilter::Action::kSkip;
+        if (docStillMatches) {
+            action = _params->fromMigrate ? write_stage_common::PreWriteFilter::Action::kWrite
+                                          : _preWriteFilter.computeAction(member->doc.value());
+        }
         bool writeToOrphan = false;
         switch (action) {
             case write_stage_common::PreWriteFilter::Action::kSkip:
@@ -341,12 +341,27 @@ PlanState IndexScanStage::getNext() {
 
     checkForInterrupt(_opCtx);
 
+    // Unless the whole KeyString is bound to a slot, read the index entry in place from the
+    // cursor instead of copying it; the slots are then only valid until the cursor moves again.
+    boost::optional<KeyStringEntryView> entry;
+    if (_recordAccessor) {
+        if (_firstGetNext) {
+            _nextRecord = _cursor->seekForKeyString(getSeekKeyLow());
+        } else {
+            _nextRecord = _cursor->nextKeyString();
+        }
+        if (_nextRecord) {
+            entry.emplace(*_nextRecord);
+        }
+    } else if (_firstGetNext) {
+        entry = _cursor->seekForKeyStringView(getSeekKeyLow());
+    } else {
+        entry = _cursor->nextKeyStringView();
+    }
+
     if (_firstGetNext) {
         _firstGetNext = false;
-        _nextRecord = _cursor->seekForKeyString(getSeekKeyLow());
         ++_specificStats.seeks;
-    } else {
-        _nextRecord = _cursor->nextKeyString();
     }
 
     ++_specificStats.numReads;
@@ -360,12 +375,13 @@ PlanState IndexScanStage::getNext() {
         uasserted(ErrorCodes::QueryTrialRunCompleted, "Trial run early exit in ixscan");
     }
 
-    if (!_nextRecord) {
+    if (!entry) {
         return trackPlanState(PlanState::IS_EOF);
     }
 
     if (auto seekKeyHigh = getSeekKeyHigh(); seekKeyHigh) {
-        auto cmp = _nextRecord->keyString.compare(*seekKeyHigh);
+        auto cmp = KeyString::compare(
+            entry->buffer, seekKeyHigh->getBuffer(), entry->size, seekKeyHigh->getSize());
 
         if (_forward) {
             if (cmp > 0) {
@@ -389,13 +405,18 @@ PlanState IndexScanStage::getNext() {
 
     if (_recordIdAccessor) {
         _recordIdAccessor->reset(
-            false, value::TypeTags::RecordId, value::bitcastFrom<RecordId*>(&_nextRecord->loc));
+            false, value::TypeTags::RecordId, value::bitcastFrom<const RecordId*>(entry->loc));
     }
 
     if (_accessors.size()) {
         _valuesBuffer.reset();
-        readKeyStringValueIntoAccessors(
-            _nextRecord->keyString, *_ordering, &_valuesBuffer, &_accessors, _indexKeysToInclude);
+        readKeyStringValueIntoAccessors(entry->buffer,
+                                        entry->size,
+                                        *entry->typeBits,
+                                        *_ordering,
+                                        &_valuesBuffer,
+                                        &_accessors,
+                                        _indexKeysToInclude);
     }
 
     return trackPlanState(PlanState::ADVANCED);
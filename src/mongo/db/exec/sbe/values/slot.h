@@ -663,6 +663,20 @@ void readKeyStringValueIntoAccessors(
     std::vector<OwnedValueAccessor>* accessors,
     boost::optional<IndexKeysInclusionSet> indexKeysToInclude = boost::none);
 
+/**
+ * Same as above, but reads the components from a KeyString held in a buffer that is not owned by a
+ * KeyString::Value, such as the current key of an index cursor. Only the components covered by
+ * 'accessors' are decoded; any trailing components and the RecordId are left unread.
+ */
+void readKeyStringValueIntoAccessors(
+    const char* keyStringBuffer,
+    size_t keyStringSize,
+    const KeyString::TypeBits& typeBits,
+    const Ordering& ordering,
+    BufBuilder* valueBufferBuilder,
+    std::vector<OwnedValueAccessor>* accessors,
+    boost::optional<IndexKeysInclusionSet> indexKeysToInclude = boost::none);
+
 
 /**
  * Commonly used containers.
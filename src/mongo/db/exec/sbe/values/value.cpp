@@ -883,11 +883,26 @@ void readKeyStringValueIntoAccessors(const KeyString::Value& keyString,
                                      BufBuilder* valueBufferBuilder,
                                      std::vector<OwnedValueAccessor>* accessors,
                                      boost::optional<IndexKeysInclusionSet> indexKeysToInclude) {
+    readKeyStringValueIntoAccessors(keyString.getBuffer(),
+                                    keyString.getSize(),
+                                    keyString.getTypeBits(),
+                                    ordering,
+                                    valueBufferBuilder,
+                                    accessors,
+                                    std::move(indexKeysToInclude));
+}
+
+void readKeyStringValueIntoAccessors(const char* keyStringBuffer,
+                                     size_t keyStringSize,
+                                     const KeyString::TypeBits& typeBits,
+                                     const Ordering& ordering,
+                                     BufBuilder* valueBufferBuilder,
+                                     std::vector<OwnedValueAccessor>* accessors,
+                                     boost::optional<IndexKeysInclusionSet> indexKeysToInclude) {
     OwnedValueAccessorValueBuilder valBuilder(valueBufferBuilder);
     invariant(!indexKeysToInclude || indexKeysToInclude->count() == accessors->size());
 
-    BufReader reader(keyString.getBuffer(), keyString.getSize());
-    KeyString::TypeBits typeBits(keyString.getTypeBits());
+    BufReader reader(keyStringBuffer, keyStringSize);
     KeyString::TypeBits::Reader typeBitsReader(typeBits);
 
     bool keepReading = true;
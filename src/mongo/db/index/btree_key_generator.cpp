@@ -53,16 +53,14 @@ const BSONObj undefinedObj = BSON("" << BSONUndefined);
 const BSONElement undefinedElt = undefinedObj.firstElement();
 
 /**
- * Returns the non-array element at the specified path. This function returns an empty BSON element
- * if the path doesn't exist.
+ * Returns the element at the specified path, or boost::none if there is an array element along the
+ * 'path', including at its end. This function returns an empty BSON element if the path doesn't
+ * exist.
  *
  * The 'path' can be specified using a dotted notation in order to traverse through embedded
  * objects.
- *
- * This function must only be used when there is no an array element along the 'path'. The caller is
- * responsible to ensure this invariant holds.
  */
-BSONElement extractNonArrayElementAtPath(const BSONObj& obj, StringData path) {
+boost::optional<BSONElement> extractNonArrayElementAtPath(const BSONObj& obj, StringData path) {
     static const auto kEmptyElt = BSONElement{};
 
     auto&& [elt, tail] = [&]() -> std::pair<BSONElement, StringData> {
@@ -71,9 +69,10 @@ BSONElement extractNonArrayElementAtPath(const BSONObj& obj, StringData path) {
         }
         return {obj.getField(path), ""_sd};
     }();
-    invariant(elt.type() != BSONType::Array);
 
-    if (elt.eoo()) {
+    if (elt.type() == BSONType::Array) {
+        return boost::none;
+    } else if (elt.eoo()) {
         return kEmptyElt;
     } else if (tail.empty()) {
         return elt;
@@ -239,15 +238,16 @@ void BtreeKeyGenerator::getKeys(SharedBufferFragmentBuilder& pooledBufferBuilder
         if (multikeyPaths) {
             multikeyPaths->resize(1);
         }
-    } else if (skipMultikey && !_pathsContainPositionalComponent) {
-        // This index doesn't contain array values. We therefore always set 'multikeyPaths' as
-        // [[ ], [], ...].
+    } else if (!_pathsContainPositionalComponent &&
+               _getKeysWithoutArray(pooledBufferBuilder, obj, collator, id, keys)) {
+        // The document doesn't contain array values along the indexed paths. We therefore always
+        // set 'multikeyPaths' as [[ ], [], ...].
         if (multikeyPaths) {
             invariant(multikeyPaths->empty());
             multikeyPaths->resize(_fieldNames.size());
         }
-        _getKeysWithoutArray(pooledBufferBuilder, obj, collator, id, keys);
     } else {
+        invariant(!skipMultikey || _pathsContainPositionalComponent);
         if (multikeyPaths) {
             invariant(multikeyPaths->empty());
             multikeyPaths->resize(_fieldNames.size());
@@ -308,7 +308,7 @@ size_t BtreeKeyGenerator::PositionalPathInfo::getApproximateSize() const {
     return size;
 }
 
-void BtreeKeyGenerator::_getKeysWithoutArray(SharedBufferFragmentBuilder& pooledBufferBuilder,
+bool BtreeKeyGenerator::_getKeysWithoutArray(SharedBufferFragmentBuilder& pooledBufferBuilder,
                                              const BSONObj& obj,
                                              const CollatorInterface* collator,
                                              const boost::optional<RecordId>& id,
@@ -319,27 +319,32 @@ void BtreeKeyGenerator::_getKeysWithoutArray(SharedBufferFragmentBuilder& pooled
 
     for (auto&& fieldName : _fieldNames) {
         auto elem = extractNonArrayElementAtPath(obj, fieldName);
-        if (elem.eoo()) {
+        if (!elem) {
+            // The partially built key is discarded along with 'keyString'.
+            return false;
+        }
+        if (elem->eoo()) {
             ++numNotFound;
         }
 
         if (collator) {
-            keyString.appendBSONElement(elem, [&](StringData stringData) {
+            keyString.appendBSONElement(*elem, [&](StringData stringData) {
                 return collator->getComparisonString(stringData);
             });
         } else {
-            keyString.appendBSONElement(elem);
+            keyString.appendBSONElement(*elem);
         }
     }
 
     if (_isSparse && numNotFound == _fieldNames.size()) {
-        return;
+        return true;
     }
 
     if (id) {
         keyString.appendRecordId(*id);
     }
     keys->insert(keyString.release());
+    return true;
 }
 
 void BtreeKeyGenerator::_getKeysWithArray(std::vector<const char*>* fieldNames,
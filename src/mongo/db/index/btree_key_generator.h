@@ -68,11 +68,12 @@ public:
      * element with the prefixes of the indexed field that would cause this index to be multikey as
      * a result of inserting 'keys'.
      *
-     * If the caller is certain that the current index is not multikey, and the insertion of 'obj'
-     * will not turn the index into a multikey, then the 'skipMultikey' parameter can be set to
-     * 'true' to be able to use an optimized algorithm for the index key generation. Otherwise,
-     * this parameter must be set to 'false'. In this case a generic algorithm will be used, which
-     * can handle both multikey and non-multikey indexes.
+     * Documents without array values along the indexed paths generate their key with an optimized
+     * algorithm, and any other document with a generic algorithm which can handle both multikey and
+     * non-multikey indexes. If the caller is certain that the current index is not multikey, and
+     * the insertion of 'obj' will not turn the index into a multikey, then the 'skipMultikey'
+     * parameter can be set to 'true', which asserts that 'obj' is indeed handled by the optimized
+     * algorithm. Otherwise, this parameter must be set to 'false'.
      *
      * If the 'collator' argument is set to null, this key generator orders strings according to the
      * simple binary compare. If non-null, represents the collator used to generate index keys for
@@ -160,10 +161,11 @@ private:
                            const boost::optional<RecordId>& id) const;
 
     /**
-     * An optimized version of the key generation algorithm to be used when it is known that 'obj'
-     * doesn't contain an array value in any of the fields in the key pattern.
+     * An optimized version of the key generation algorithm for documents that don't contain an
+     * array value along any of the fields in the key pattern. Returns false without generating any
+     * key if 'obj' does contain one.
      */
-    void _getKeysWithoutArray(SharedBufferFragmentBuilder& pooledBufferBuilder,
+    bool _getKeysWithoutArray(SharedBufferFragmentBuilder& pooledBufferBuilder,
                               const BSONObj& obj,
                               const CollatorInterface* collator,
                               const boost::optional<RecordId>& id,
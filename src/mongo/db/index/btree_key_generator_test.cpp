@@ -409,6 +409,31 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromCompoundMissing) {
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
 }
 
+TEST(BtreeKeyGeneratorTest, GetKeysFromCompoundWithArrayInLastField) {
+    BSONObj keyPattern = fromjson("{x: 1, 'y.z': 1}");
+    BSONObj genKeysFrom = fromjson("{x: 'a', y: {z: ['b', 'c']}}");
+    KeyString::HeapBuilder keyString1(KeyString::Version::kLatestVersion,
+                                      fromjson("{'': 'a', '': 'b'}"),
+                                      Ordering::make(BSONObj()));
+    KeyString::HeapBuilder keyString2(KeyString::Version::kLatestVersion,
+                                      fromjson("{'': 'a', '': 'c'}"),
+                                      Ordering::make(BSONObj()));
+    KeyStringSet expectedKeys{keyString1.release(), keyString2.release()};
+    MultikeyPaths expectedMultikeyPaths{MultikeyComponents{}, {1U}};
+    ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
+}
+
+TEST(BtreeKeyGeneratorTest, GetKeysFromCompoundWithScalarAlongDottedPath) {
+    BSONObj keyPattern = fromjson("{x: 1, 'y.z': 1}");
+    BSONObj genKeysFrom = fromjson("{x: 'a', y: 'b'}");
+    KeyString::HeapBuilder keyString(KeyString::Version::kLatestVersion,
+                                     fromjson("{'': 'a', '': null}"),
+                                     Ordering::make(BSONObj()));
+    KeyStringSet expectedKeys{keyString.release()};
+    MultikeyPaths expectedMultikeyPaths{MultikeyComponents{}, MultikeyComponents{}};
+    ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
+}
+
 TEST(BtreeKeyGeneratorTest, GetKeysFromArraySubelementComplex) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:[{b:[2]}]}");
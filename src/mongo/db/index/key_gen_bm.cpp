@@ -161,9 +161,124 @@ void BM_KeyGenArrayOfArray(benchmark::State& state, int32_t elements) {
     }
 }
 
+template <typename T>
+void BM_KeyGenScalar(benchmark::State& state, T value) {
+    BSONObjBuilder builder;
+    builder.append("_id", OID::gen());
+    builder.append(kFieldName, value);
+    builder.append("b", "some other field");
+    BSONObj obj = builder.obj();
+
+    BtreeKeyGenerator generator({kFieldName},
+                                {BSONElement{}},
+                                false,
+                                KeyString::Version::kLatestVersion,
+                                makeOrdering(kFieldName));
+
+    SharedBufferFragmentBuilder allocator(kMemBlockSize,
+                                          SharedBufferFragmentBuilder::ConstantGrowStrategy());
+    KeyStringSet keys;
+    MultikeyPaths multikeyPaths;
+    RecordId id(1);
+
+    for (auto _ : state) {
+        generator.getKeys(allocator, obj, false, &keys, &multikeyPaths, nullptr, id);
+        benchmark::ClobberMemory();
+        keys.clear();
+        multikeyPaths.clear();
+    }
+}
+
+void BM_KeyGenCompound(benchmark::State& state, bool withArray) {
+    BSONObjBuilder builder;
+    {
+        BSONObjBuilder subObjBuilder(builder.subobjStart("a"));
+        subObjBuilder.append("b", 1);
+        subObjBuilder.append("c", "abc");
+    }
+    if (withArray) {
+        builder.append("d", BSON_ARRAY(Date_t::now()));
+    } else {
+        builder.append("d", Date_t::now());
+    }
+    BSONObj obj = builder.obj();
+
+    BSONObj keyPattern = BSON("a.b" << 1 << "a.c" << -1 << "d" << 1);
+    BtreeKeyGenerator generator({"a.b", "a.c", "d"},
+                                {BSONElement{}, BSONElement{}, BSONElement{}},
+                                false,
+                                KeyString::Version::kLatestVersion,
+                                Ordering::make(keyPattern));
+
+    SharedBufferFragmentBuilder allocator(kMemBlockSize,
+                                          SharedBufferFragmentBuilder::ConstantGrowStrategy());
+    KeyStringSet keys;
+    MultikeyPaths multikeyPaths;
+    RecordId id(1);
+
+    for (auto _ : state) {
+        generator.getKeys(allocator, obj, false, &keys, &multikeyPaths, nullptr, id);
+        benchmark::ClobberMemory();
+        keys.clear();
+        multikeyPaths.clear();
+    }
+}
+
+/**
+ * Generates the keys of a batch of documents with a single allocator and keeps them all alive until
+ * the end of the batch, as an insert of 'batchSize' documents does.
+ */
+void BM_KeyGenBatch(benchmark::State& state, int32_t batchSize) {
+    std::mt19937 gen(numGen());
+
+    std::vector<BSONObj> docs;
+    for (int32_t i = 0; i < batchSize; ++i) {
+        BSONObjBuilder builder;
+        builder.append("_id", OID::gen());
+        builder.append(kFieldName, static_cast<int32_t>(gen()));
+        docs.push_back(builder.obj());
+    }
+
+    BtreeKeyGenerator generator({kFieldName},
+                                {BSONElement{}},
+                                false,
+                                KeyString::Version::kLatestVersion,
+                                makeOrdering(kFieldName));
+
+    SharedBufferFragmentBuilder allocator(kMemBlockSize,
+                                          SharedBufferFragmentBuilder::ConstantGrowStrategy());
+    std::vector<KeyStringSet> keys(batchSize);
+    MultikeyPaths multikeyPaths;
+
+    for (auto _ : state) {
+        for (int32_t i = 0; i < batchSize; ++i) {
+            generator.getKeys(
+                allocator, docs[i], false, &keys[i], &multikeyPaths, nullptr, RecordId(i + 1));
+            multikeyPaths.clear();
+        }
+        benchmark::ClobberMemory();
+        for (auto& docKeys : keys) {
+            docKeys.clear();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+
 BENCHMARK_CAPTURE(BM_KeyGenBasic, Generic, false);
 BENCHMARK_CAPTURE(BM_KeyGenBasic, SkipMultikey, true);
 
+BENCHMARK_CAPTURE(BM_KeyGenScalar, Int, 42);
+BENCHMARK_CAPTURE(BM_KeyGenScalar, Long, 42LL);
+BENCHMARK_CAPTURE(BM_KeyGenScalar, String, std::string("some indexed string value"));
+BENCHMARK_CAPTURE(BM_KeyGenScalar, ObjectId, OID::gen());
+BENCHMARK_CAPTURE(BM_KeyGenScalar, Date, Date_t::now());
+
+BENCHMARK_CAPTURE(BM_KeyGenCompound, Scalars, false);
+BENCHMARK_CAPTURE(BM_KeyGenCompound, Array, true);
+
+BENCHMARK_CAPTURE(BM_KeyGenBatch, 100, 100);
+BENCHMARK_CAPTURE(BM_KeyGenBatch, 1K, 1000);
+
 BENCHMARK_CAPTURE(BM_KeyGenArray, 1K, 1000);
 BENCHMARK_CAPTURE(BM_KeyGenArray, 10K, 10000);
 BENCHMARK_CAPTURE(BM_KeyGenArray, 100K, 100000);
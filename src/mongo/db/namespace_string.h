@@ -203,6 +203,9 @@ public:
     // Namespace for storing config.transactions cloner progress for resharding.
     static const NamespaceString kReshardingTxnClonerProgressNamespace;
 
+    // Namespace for storing the _id ranges cloned concurrently by resharding.
+    static const NamespaceString kReshardingCollectionClonerProgressNamespace;
+
     // Namespace for storing config.collectionCriticalSections documents
     static const NamespaceString kCollectionCriticalSectionsNamespace;
 
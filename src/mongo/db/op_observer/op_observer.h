@@ -381,6 +381,20 @@ public:
                                const NamespaceString& collectionName,
                                const UUID& uuid) = 0;
 
+    /**
+     * Called after the documents of a clustered collection with RecordIds in the inclusive range
+     * ['minRecordId', 'maxRecordId'] were removed by truncating the range in the record store.
+     * 'bytesDeleted' and 'docsDeleted' are the size and the number of the removed documents.
+     */
+    virtual void onTruncateRange(OperationContext* opCtx,
+                                 const NamespaceString& collectionName,
+                                 const UUID& uuid,
+                                 const RecordId& minRecordId,
+                                 const RecordId& maxRecordId,
+                                 int64_t bytesDeleted,
+                                 int64_t docsDeleted,
+                                 bool fromMigrate) = 0;
+
     /**
      * The onUnpreparedTransactionCommit method is called on the commit of an unprepared
      * transaction, before the RecoveryUnit onCommit() is called.  It must not be called when no
@@ -1468,6 +1468,37 @@ void OpObserverImpl::onEmptyCapped(OperationContext* opCtx,
     }
 }
 
+void OpObserverImpl::onTruncateRange(OperationContext* opCtx,
+                                     const NamespaceString& collectionName,
+                                     const UUID& uuid,
+                                     const RecordId& minRecordId,
+                                     const RecordId& maxRecordId,
+                                     int64_t bytesDeleted,
+                                     int64_t docsDeleted,
+                                     bool fromMigrate) {
+    if (!collectionName.isReplicated()) {
+        // The oplog is only disabled for the command namespace of unreplicated databases.
+        return;
+    }
+
+    BSONObjBuilder bob;
+    bob.append("truncateRange", collectionName.coll());
+    minRecordId.serializeToken("minRecordId", &bob);
+    maxRecordId.serializeToken("maxRecordId", &bob);
+    bob.append("bytesDeleted", bytesDeleted);
+    bob.append("docsDeleted", docsDeleted);
+
+    MutableOplogEntry oplogEntry;
+    oplogEntry.setOpType(repl::OpTypeEnum::kCommand);
+
+    oplogEntry.setTid(collectionName.tenantId());
+    oplogEntry.setNss(collectionName.getCommandNS());
+    oplogEntry.setUuid(uuid);
+    oplogEntry.setObject(bob.obj());
+    oplogEntry.setFromMigrateIfTrue(fromMigrate);
+    logOperation(opCtx, &oplogEntry, true /*assignWallClockTime*/, _oplogWriter.get());
+}
+
 namespace {
 
 /**
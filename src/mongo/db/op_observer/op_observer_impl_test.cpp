@@ -765,6 +765,38 @@ TEST_F(OpObserverTest, OnRenameCollectionOmitsDropTargetFieldIfDropTargetUuidIsN
     ASSERT_BSONOBJ_EQ(oExpected, o);
 }
 
+TEST_F(OpObserverTest, OnTruncateRangeExpectedOplogEntry) {
+    OpObserverImpl opObserver(std::make_unique<OplogWriterImpl>());
+    auto opCtx = cc().makeOperationContext();
+    auto uuid = UUID::gen();
+    NamespaceString nss(boost::none, "test.coll");
+    const RecordId minRecordId(1);
+    const RecordId maxRecordId(10);
+
+    // Write to the oplog.
+    {
+        AutoGetDb autoDb(opCtx.get(), nss.dbName(), MODE_X);
+        WriteUnitOfWork wunit(opCtx.get());
+        opObserver.onTruncateRange(
+            opCtx.get(), nss, uuid, minRecordId, maxRecordId, 1024, 10, true /* fromMigrate */);
+        wunit.commit();
+    }
+
+    auto entry = assertGet(OplogEntry::parse(getSingleOplogEntry(opCtx.get())));
+
+    // Ensure that the truncated range and its counts were properly added to the oplog entry.
+    ASSERT(entry.getCommandType() == OplogEntry::CommandType::kTruncateRange);
+    ASSERT_EQ(nss.getCommandNS(), entry.getNss());
+    ASSERT_EQ(uuid, *entry.getUuid());
+    ASSERT_TRUE(entry.getFromMigrate().value_or(false));
+    const auto& o = entry.getObject();
+    ASSERT_EQ(nss.coll(), o["truncateRange"].valueStringData());
+    ASSERT_EQ(minRecordId, RecordId::deserializeToken(o["minRecordId"]));
+    ASSERT_EQ(maxRecordId, RecordId::deserializeToken(o["maxRecordId"]));
+    ASSERT_EQ(1024, o["bytesDeleted"].safeNumberLong());
+    ASSERT_EQ(10, o["docsDeleted"].safeNumberLong());
+}
+
 TEST_F(OpObserverTest, MustBePrimaryToWriteOplogEntries) {
     OpObserverImpl opObserver(std::make_unique<OplogWriterImpl>());
     auto opCtx = cc().makeOperationContext();
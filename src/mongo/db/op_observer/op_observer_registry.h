@@ -367,6 +367,26 @@ public:
             o->onEmptyCapped(opCtx, collectionName, uuid);
     }
 
+    void onTruncateRange(OperationContext* const opCtx,
+                         const NamespaceString& collectionName,
+                         const UUID& uuid,
+                         const RecordId& minRecordId,
+                         const RecordId& maxRecordId,
+                         int64_t bytesDeleted,
+                         int64_t docsDeleted,
+                         bool fromMigrate) {
+        ReservedTimes times{opCtx};
+        for (auto& o : _observers)
+            o->onTruncateRange(opCtx,
+                               collectionName,
+                               uuid,
+                               minRecordId,
+                               maxRecordId,
+                               bytesDeleted,
+                               docsDeleted,
+                               fromMigrate);
+    }
+
     void onUnpreparedTransactionCommit(OperationContext* opCtx,
                                        std::vector<repl::ReplOperation>* statements,
                                        size_t numberOfPrePostImagesToWrite) override {
@@ -34,10 +34,12 @@
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression_algo.h"
+#include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/pipeline/aggregation_request_helper.h"
 #include "mongo/db/pipeline/document_path_support.h"
 #include "mongo/db/pipeline/document_source_documents.h"
 #include "mongo/db/pipeline/document_source_merge_gen.h"
+#include "mongo/db/pipeline/document_source_queue.h"
 #include "mongo/db/pipeline/document_source_sort.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
@@ -75,6 +77,37 @@ BSONObj buildEqualityOrQuery(const std::string& fieldName, const BSONArray& valu
     return orBuilder.obj();
 }
 
+/**
+ * Calls 'fn' with every value that an equality predicate on 'path' may be compared with, given that
+ * 'elem' is the value of its first 'pathIdx' components: each value found along 'path' and, when it
+ * is an array, each of its elements. Arrays along the path are traversed through their elements.
+ */
+template <typename Fn>
+void visitEqualityValuesAlongPath(const BSONElement& elem,
+                                  const FieldPath& path,
+                                  size_t pathIdx,
+                                  const Fn& fn) {
+    if (pathIdx == path.getPathLength()) {
+        fn(Value(elem));
+        if (elem.type() == BSONType::Array) {
+            for (auto&& subElem : elem.Obj()) {
+                fn(Value(subElem));
+            }
+        }
+        return;
+    }
+
+    if (elem.type() == BSONType::Object) {
+        if (auto child = elem.Obj()[path.getFieldName(pathIdx)]) {
+            visitEqualityValuesAlongPath(child, path, pathIdx + 1, fn);
+        }
+    } else if (elem.type() == BSONType::Array) {
+        for (auto&& subElem : elem.Obj()) {
+            visitEqualityValuesAlongPath(subElem, path, pathIdx, fn);
+        }
+    }
+}
+
 void lookupPipeValidator(const Pipeline& pipeline) {
     const auto& sources = pipeline.getSources();
     std::for_each(sources.begin(), sources.end(), [](auto& src) {
@@ -504,8 +537,110 @@ std::unique_ptr<Pipeline, PipelineDeleter> DocumentSourceLookUp::buildPipelineFr
     return pipeline;
 }
 
+bool DocumentSourceLookUp::buildBroadcastTable(long long maxBytes) {
+    MakePipelineOptions pipelineOpts;
+    pipelineOpts.optimize = true;
+    pipelineOpts.attachCursorSource = true;
+    pipelineOpts.validator = lookupPipeValidator;
+    pipelineOpts.shardTargetingPolicy = ShardTargetingPolicy::kAllowed;
+    auto pipeline = Pipeline::makePipeline(std::vector<BSONObj>{}, _fromExpCtx, pipelineOpts);
+
+    long long totalBytes = 0;
+    while (auto doc = pipeline->getNext()) {
+        auto obj = doc->toBson();
+        totalBytes += obj.objsize();
+        if (totalBytes > maxBytes) {
+            LOGV2_DEBUG(7470100,
+                        3,
+                        "$lookup foreign collection is too large for a broadcast join",
+                        logAttrs(_fromNs),
+                        "maxBytes"_attr = maxBytes);
+            _broadcastDocs = {};
+            return false;
+        }
+        _broadcastDocs.push_back(std::move(obj));
+    }
+    accumulatePipelinePlanSummaryStats(*pipeline, _stats.planSummaryStats);
+
+    _broadcastIndex.emplace(
+        _fromExpCtx->getValueComparator().makeUnorderedValueMap<std::vector<size_t>>());
+    for (size_t i = 0; i < _broadcastDocs.size(); ++i) {
+        if (auto elem = _broadcastDocs[i][_foreignField->getFieldName(0)]) {
+            visitEqualityValuesAlongPath(elem, *_foreignField, 1, [&](const Value& value) {
+                auto& positions = (*_broadcastIndex)[value];
+                if (positions.empty() || positions.back() != i) {
+                    positions.push_back(i);
+                }
+            });
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<Pipeline, PipelineDeleter> DocumentSourceLookUp::buildBroadcastJoinPipeline(
+    const Document& inputDoc) {
+    if (_broadcastJoinState == BroadcastJoinState::kUndecided) {
+        // Only a plain equality join, whose $match is the whole foreign pipeline, can be answered
+        // from the foreign collection's documents alone.
+        const auto maxBytes = internalQueryLookupBroadcastJoinMaxBytes.load();
+        const bool eligible = maxBytes > 0 && hasLocalFieldForeignFieldJoin() && !_userPipeline &&
+            _resolvedPipeline.size() == 1 && foreignShardedLookupAllowed() &&
+            !FieldRef(_foreignField->fullPath()).hasNumericPathComponents() &&
+            _fromExpCtx->mongoProcessInterface->isSharded(_fromExpCtx->opCtx, _fromNs);
+        _broadcastJoinState = eligible && buildBroadcastTable(maxBytes)
+            ? BroadcastJoinState::kInUse
+            : BroadcastJoinState::kAbandoned;
+    }
+    if (_broadcastJoinState != BroadcastJoinState::kInUse) {
+        return nullptr;
+    }
+
+    // The index only narrows down the candidates; each of them is still matched against the
+    // $match built for 'inputDoc', which also carries any absorbed '_additionalFilter'.
+    const auto matchExpr = uassertStatusOK(MatchExpressionParser::parse(
+        _resolvedPipeline[*_fieldMatchPipelineIdx].firstElement().Obj(), _fromExpCtx));
+
+    // A null or missing local value also matches foreign documents missing the foreign field, so
+    // it is matched against every foreign document.
+    bool hasValue = false;
+    bool hasNullishValue = false;
+    std::vector<size_t> candidates;
+    document_path_support::visitAllValuesAtPath(inputDoc, *_localField, [&](const Value& value) {
+        if (value.nullish()) {
+            hasNullishValue = true;
+            return;
+        }
+        hasValue = true;
+        if (auto it = _broadcastIndex->find(value); it != _broadcastIndex->end()) {
+            candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+        }
+    });
+    auto queue = DocumentSourceQueue::create(_fromExpCtx);
+    auto addIfMatches = [&](size_t i) {
+        if (matchExpr->matchesBSON(_broadcastDocs[i])) {
+            queue->emplace_back(Document(_broadcastDocs[i]));
+        }
+    };
+    if (!hasValue || hasNullishValue) {
+        for (size_t i = 0; i < _broadcastDocs.size(); ++i) {
+            addIfMatches(i);
+        }
+    } else {
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        for (auto i : candidates) {
+            addIfMatches(i);
+        }
+    }
+    return Pipeline::create({queue}, _fromExpCtx);
+}
+
 std::unique_ptr<Pipeline, PipelineDeleter> DocumentSourceLookUp::buildPipeline(
     const Document& inputDoc) {
+    if (auto pipeline = buildBroadcastJoinPipeline(inputDoc)) {
+        return pipeline;
+    }
+
     // Copy all 'let' variables into the foreign pipeline's expression context.
     _variables.copyToExpCtx(_variablesParseState, _fromExpCtx.get());
 
@@ -985,6 +1120,9 @@ void DocumentSourceLookUp::appendSpecificExecStats(MutableDocument& doc) const {
                    std::back_inserter(indexesUsedVec),
                    [](std::string idx) -> Value { return Value(idx); });
     doc["indexesUsed"] = Value{std::move(indexesUsedVec)};
+    if (_broadcastJoinState == BroadcastJoinState::kInUse) {
+        doc["broadcastJoinDocs"] = Value(static_cast<long long>(_broadcastDocs.size()));
+    }
 }
 
 void DocumentSourceLookUp::serializeToArray(
@@ -333,6 +333,22 @@ private:
      */
     std::unique_ptr<Pipeline, PipelineDeleter> buildPipeline(const Document& inputDoc);
 
+    /**
+     * For a localField/foreignField join against a sharded foreign collection, joins 'inputDoc'
+     * against an in-memory copy of the foreign collection rather than querying the shards once per
+     * input document. The foreign collection is read when this is first called, and abandoned for
+     * the rest of the operation if it is larger than 'internalQueryLookupBroadcastJoinMaxBytes'.
+     * Returns a pipeline producing the joined foreign documents, or nullptr if the join must query
+     * the foreign collection instead.
+     */
+    std::unique_ptr<Pipeline, PipelineDeleter> buildBroadcastJoinPipeline(const Document& inputDoc);
+
+    /**
+     * Reads the foreign collection into '_broadcastDocs' and indexes it by '_foreignField'. Returns
+     * false, leaving both empty, if the collection is larger than 'maxBytes'.
+     */
+    bool buildBroadcastTable(long long maxBytes);
+
     /**
      * Reinitialize the cache with a new max size. May only be called if this DSLookup was created
      * with pipeline syntax only, the cache has not been frozen or abandoned, and no data has been
@@ -392,6 +408,17 @@ private:
     // from a cursor source.
     boost::optional<SequentialDocumentCache> _cache;
 
+    // Whether a localField/foreignField join is answered from '_broadcastDocs'. Decided when the
+    // first input document is joined.
+    enum class BroadcastJoinState { kUndecided, kInUse, kAbandoned };
+    BroadcastJoinState _broadcastJoinState = BroadcastJoinState::kUndecided;
+
+    // The foreign collection of a broadcast join in the order it was read, and the positions in
+    // '_broadcastDocs' of the documents holding each value along '_foreignField'. Values are
+    // compared under the collation of '_fromExpCtx', as the $match they stand in for would be.
+    std::vector<BSONObj> _broadcastDocs;
+    boost::optional<ValueUnorderedMap<std::vector<size_t>>> _broadcastIndex;
+
     // The ExpressionContext used when performing aggregation pipelines against the '_resolvedNs'
     // namespace.
     boost::intrusive_ptr<ExpressionContext> _fromExpCtx;
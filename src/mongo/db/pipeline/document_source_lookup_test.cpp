@@ -49,6 +49,7 @@
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/repl/storage_interface_mock.h"
 #include "mongo/db/server_options.h"
+#include "mongo/idl/server_parameter_test_util.h"
 
 namespace mongo {
 namespace {
@@ -815,12 +816,18 @@ TEST(MakeMatchStageFromInput, ArrayValueWithRegexUsesOrQuery) {
 class MockMongoInterface final : public StubMongoProcessInterface {
 public:
     MockMongoInterface(deque<DocumentSource::GetNextResult> mockResults,
-                       bool removeLeadingQueryStages = false)
+                       bool removeLeadingQueryStages = false,
+                       bool isSharded = false)
         : _mockResults(std::move(mockResults)),
-          _removeLeadingQueryStages(removeLeadingQueryStages) {}
+          _removeLeadingQueryStages(removeLeadingQueryStages),
+          _isSharded(isSharded) {}
 
     bool isSharded(OperationContext* opCtx, const NamespaceString& ns) final {
-        return false;
+        return _isSharded;
+    }
+
+    int getNumCursorsAttached() const {
+        return _numCursorsAttached;
     }
 
     std::unique_ptr<Pipeline, PipelineDeleter> attachCursorSourceToPipeline(
@@ -840,12 +847,15 @@ public:
 
         pipeline->addInitialSource(
             DocumentSourceMock::createForTest(_mockResults, pipeline->getContext()));
+        ++_numCursorsAttached;
         return pipeline;
     }
 
 private:
     deque<DocumentSource::GetNextResult> _mockResults;
     bool _removeLeadingQueryStages = false;
+    bool _isSharded = false;
+    int _numCursorsAttached = 0;
 };
 
 TEST_F(DocumentSourceLookUpTest, ShouldPropagatePauses) {
@@ -896,6 +906,69 @@ TEST_F(DocumentSourceLookUpTest, ShouldPropagatePauses) {
     ASSERT_TRUE(lookup->getNext().isEOF());
 }
 
+TEST_F(DocumentSourceLookUpTest, ShouldJoinAgainstBroadcastShardedForeignCollection) {
+    RAIIServerParameterControllerForTest maxBytes("internalQueryLookupBroadcastJoinMaxBytes",
+                                                  1024 * 1024);
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs(boost::none, "test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    auto mockLocalSource = DocumentSourceMock::createForTest(
+        {Document{{"foreignId", 0}},
+         Document{{"foreignId", {1, 2}}},
+         Document{{"foreignId", 3}},
+         Document{{"other", 0}}},
+        expCtx);
+
+    // Mock out the foreign collection, which is read once and joined in memory.
+    deque<DocumentSource::GetNextResult> mockForeignContents{
+        Document{{"_id", 0}, {"key", 0}},
+        Document{{"_id", 1}, {"key", {1, 4}}},
+        Document{{"_id", 2}, {"key", 2}},
+        Document{{"_id", 3}}};
+    auto mongoProcessInterface = std::make_shared<MockMongoInterface>(
+        std::move(mockForeignContents), false /* removeLeadingQueryStages */, true /* isSharded */);
+    expCtx->mongoProcessInterface = mongoProcessInterface;
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "foreignId"_sd},
+                                         {"foreignField", "key"_sd},
+                                         {"as", "foreignDocs"_sd}}}}
+                          .toBson();
+    auto lookup = makeLookUpFromBson(lookupSpec.firstElement(), expCtx);
+    lookup->setSource(mockLocalSource.get());
+
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"foreignId", 0}, {"foreignDocs", {Document{{"_id", 0}, {"key", 0}}}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"foreignId", {1, 2}},
+                                 {"foreignDocs",
+                                  {Document{{"_id", 1}, {"key", {1, 4}}},
+                                   Document{{"_id", 2}, {"key", 2}}}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"foreignId", 3}, {"foreignDocs", std::vector<Value>{}}}));
+
+    // A missing local field joins with the foreign documents missing the foreign field.
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"other", 0}, {"foreignDocs", {Document{{"_id", 3}}}}}));
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    ASSERT_EQ(1, mongoProcessInterface->getNumCursorsAttached());
+}
+
 TEST_F(DocumentSourceLookUpTest, ShouldPropagatePausesWhileUnwinding) {
     auto expCtx = getExpCtx();
     NamespaceString fromNs(boost::none, "test", "foreign");
@@ -881,6 +881,65 @@ boost::optional<ShardedExchangePolicy> checkIfEligibleForExchange(OperationConte
     return walkPipelineBackwardsTrackingShardKey(opCtx, mergePipeline, cm);
 }
 
+boost::optional<ShardedExchangePolicy> checkIfEligibleForGroupMergeExchange(
+    const Pipeline* mergePipeline, const std::set<ShardId>& shardIds) {
+    if (internalQueryDisableExchange.load() ||
+        !internalQueryPartitionGroupMergeAcrossShards.load() || shardIds.size() < 2) {
+        return boost::none;
+    }
+
+    const auto& sources = mergePipeline->getSources();
+    const auto leadingGroup =
+        sources.empty() ? nullptr : dynamic_cast<DocumentSourceGroup*>(sources.front().get());
+    if (!leadingGroup || !leadingGroup->doingMerge()) {
+        return boost::none;
+    }
+
+    // The partial groups are distributed by a hash of their group key's BSON, which only sends
+    // equal keys to the same consumer when keys are compared without a collation.
+    if (mergePipeline->getContext()->getCollator()) {
+        return boost::none;
+    }
+
+    // Each consumer only sees its own partition of the groups, so the stages following the $group
+    // must not need a single stream, a particular host, or to write their output.
+    for (auto it = std::next(sources.begin()); it != sources.end(); ++it) {
+        const auto constraints = (*it)->constraints(Pipeline::SplitState::kSplitForMerge);
+        if ((*it)->distributedPlanLogic() ||
+            constraints.hostRequirement != StageConstraints::HostTypeRequirement::kNone ||
+            constraints.writesPersistentData()) {
+            return boost::none;
+        }
+    }
+
+    // Split the hashed key space into one equal range per targeted shard.
+    const auto numConsumers = shardIds.size();
+    const auto rangeSize = std::numeric_limits<unsigned long long>::max() / numConsumers;
+    std::vector<BSONObj> boundaries{BSON("_id" << MINKEY)};
+    std::vector<int> consumerIds;
+    for (size_t consumerId = 0; consumerId < numConsumers; ++consumerId) {
+        if (consumerId > 0) {
+            boundaries.emplace_back(BSON(
+                "_id" << static_cast<long long>(
+                    static_cast<unsigned long long>(std::numeric_limits<long long>::min()) +
+                    consumerId * rangeSize)));
+        }
+        consumerIds.emplace_back(consumerId);
+    }
+    boundaries.emplace_back(BSON("_id" << MAXKEY));
+
+    ExchangeSpec exchangeSpec;
+    exchangeSpec.setPolicy(ExchangePolicyEnum::kKeyRange);
+    exchangeSpec.setKey(BSON("_id"
+                             << "hashed"));
+    exchangeSpec.setBoundaries(std::move(boundaries));
+    exchangeSpec.setConsumers(numConsumers);
+    exchangeSpec.setConsumerIds(std::move(consumerIds));
+
+    return ShardedExchangePolicy{std::move(exchangeSpec),
+                                 std::vector<ShardId>(shardIds.begin(), shardIds.end())};
+}
+
 SplitPipeline splitPipeline(std::unique_ptr<Pipeline, PipelineDeleter> pipeline) {
     // Re-brand 'pipeline' as the merging pipeline. We will move stages one by one from the merging
     // half to the shards, as possible.
@@ -1086,6 +1145,10 @@ DispatchShardPipelineResults dispatchShardPipeline(
             splitPipelines->shardsPipeline->peekFront()->getSourceName() !=
                 "$_internalSearchMongotRemote"_sd) {
             exchangeSpec = checkIfEligibleForExchange(opCtx, splitPipelines->mergePipeline.get());
+            if (!exchangeSpec && !splitPipelines->shardCursorsSortSpec) {
+                exchangeSpec = checkIfEligibleForGroupMergeExchange(
+                    splitPipelines->mergePipeline.get(), shardIds);
+            }
         }
     }
 
@@ -105,6 +105,14 @@ struct DispatchShardPipelineResults {
 boost::optional<ShardedExchangePolicy> checkIfEligibleForExchange(OperationContext* opCtx,
                                                                   const Pipeline* mergePipeline);
 
+/**
+ * If the merging pipeline starts by merging the partial groups of a $group and can then run on
+ * disjoint partitions of the groups, returns an exchange which hashes the groups by key across all
+ * of 'shardIds', so that each of them merges its own partition.
+ */
+boost::optional<ShardedExchangePolicy> checkIfEligibleForGroupMergeExchange(
+    const Pipeline* mergePipeline, const std::set<ShardId>& shardIds);
+
 /**
  * Split the current Pipeline into a Pipeline for each shard, and a Pipeline that combines the
  * results within a merging process. This call also performs optimizations with the aim of reducing
@@ -1094,6 +1094,31 @@ const StringMap<ApplyOpMetadata> kOpsMap = {
               extractNsFromUUIDorNs(opCtx, entry.getNss(), entry.getUuid(), entry.getObject()));
       },
       {ErrorCodes::NamespaceNotFound}}},
+    {"truncateRange",
+     {[](OperationContext* opCtx, const OplogEntry& entry, OplogApplication::Mode mode) -> Status {
+          const auto& cmd = entry.getObject();
+          const auto nss = extractNsFromUUIDorNs(opCtx, entry.getNss(), entry.getUuid(), cmd);
+          AutoGetCollection coll(opCtx, nss, MODE_IX);
+          if (!coll) {
+              return Status(ErrorCodes::NamespaceNotFound,
+                            str::stream() << "Cannot truncate a range of " << nss
+                                          << ": collection does not exist");
+          }
+
+          // Count the documents that are actually in the range on this node rather than applying
+          // the primary's counts, which would adjust the size again if the entry is reapplied.
+          WriteUnitOfWork wuow(opCtx);
+          collection_internal::truncateRange(opCtx,
+                                             coll.getCollection(),
+                                             RecordId::deserializeToken(cmd["minRecordId"]),
+                                             RecordId::deserializeToken(cmd["maxRecordId"]),
+                                             true /* includeMax */,
+                                             0 /* maxDocs */,
+                                             entry.getFromMigrate().value_or(false));
+          wuow.commit();
+          return Status::OK();
+      },
+      {ErrorCodes::NamespaceNotFound}}},
     {"commitTransaction",
      {[](OperationContext* opCtx, const OplogEntry& entry, OplogApplication::Mode mode) -> Status {
          return applyCommitTransaction(opCtx, entry, mode);
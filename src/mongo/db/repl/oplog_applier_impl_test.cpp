@@ -52,6 +52,7 @@
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/pipeline/change_stream_preimage_gen.h"
 #include "mongo/db/query/internal_plans.h"
+#include "mongo/db/record_id_helpers.h"
 #include "mongo/db/repl/bgsync.h"
 #include "mongo/db/repl/drop_pending_collection_reaper.h"
 #include "mongo/db/repl/idempotency_test_fixture.h"
@@ -3327,6 +3328,41 @@ TEST_F(IdempotencyTest, EmptyCappedNamespaceNotFound) {
     ASSERT_FALSE(autoColl);
 }
 
+TEST_F(IdempotencyTest, TruncateRangeCountsTheDocumentsLeftInTheRange) {
+    ASSERT_OK(
+        ReplicationCoordinator::get(_opCtx.get())->setFollowerMode(MemberState::RS_RECOVERING));
+
+    ASSERT_OK(runOpInitialSync(makeCreateCollectionOplogEntry(
+        nextOpTime(),
+        nss,
+        BSON("uuid" << kUuid << "clusteredIndex"
+                    << BSON("key" << BSON("_id" << 1) << "unique" << true)))));
+    for (int i = 1; i <= 3; ++i) {
+        ASSERT_OK(runOpInitialSync(insert(BSON("_id" << i))));
+    }
+
+    // Create a "truncateRange" oplog entry for the documents with _id 1 and 2, with counts that
+    // do not match them.
+    BSONObjBuilder truncateRangeCmd;
+    truncateRangeCmd.append("truncateRange", nss.coll());
+    record_id_helpers::keyForElem(BSON("_id" << 1).firstElement())
+        .serializeToken("minRecordId", &truncateRangeCmd);
+    record_id_helpers::keyForElem(BSON("_id" << 2).firstElement())
+        .serializeToken("maxRecordId", &truncateRangeCmd);
+    truncateRangeCmd.append("bytesDeleted", 1000LL);
+    truncateRangeCmd.append("docsDeleted", 10LL);
+    auto truncateRangeOp = makeCommandOplogEntry(nextOpTime(), nss, truncateRangeCmd.obj(), kUuid);
+
+    // Applying the entry again finds nothing left in the range and leaves the size unchanged.
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_OK(runOpInitialSync(truncateRangeOp));
+
+        AutoGetCollectionForReadCommand autoColl(_opCtx.get(), nss);
+        ASSERT_EQ(autoColl->numRecords(_opCtx.get()), 1);
+        ASSERT_EQ(autoColl->dataSize(_opCtx.get()), BSON("_id" << 3).objsize());
+    }
+}
+
 TEST_F(IdempotencyTest, UpdateTwoFields) {
     ASSERT_OK(
         ReplicationCoordinator::get(_opCtx.get())->setFollowerMode(MemberState::RS_RECOVERING));
@@ -439,7 +439,8 @@ StatusWith<std::set<NamespaceString>> RollbackImpl::_namespacesForOp(const Oplog
             case OplogEntry::CommandType::kStartIndexBuild:
             case OplogEntry::CommandType::kAbortIndexBuild:
             case OplogEntry::CommandType::kCommitIndexBuild:
-            case OplogEntry::CommandType::kCollMod: {
+            case OplogEntry::CommandType::kCollMod:
+            case OplogEntry::CommandType::kTruncateRange: {
                 // For all other command types, we should be able to parse the collection name from
                 // the first command argument.
                 try {
@@ -1026,6 +1027,11 @@ Status RollbackImpl::_processRollbackOp(OperationContext* opCtx, const OplogEntr
             } else {
                 _newCounts[dropTargetUUID] = kCollectionScanRequired;
             }
+        } else if (oplogEntry.getCommandType() == OplogEntry::CommandType::kTruncateRange) {
+            // Rolling back a range truncation must increment the count by the number of documents
+            // it removed.
+            _countDiffs[oplogEntry.getUuid().value()] +=
+                oplogEntry.getObject()["docsDeleted"].safeNumberLong();
         } else if (oplogEntry.getCommandType() == OplogEntry::CommandType::kCommitTransaction) {
             // If we are rolling-back the commit of a prepared transaction, use the prepare oplog
             // entry to compute size adjustments. After recovering to the stable timestamp, prepared
@@ -102,9 +102,15 @@ StatusWith<DistributionStatus> createCollectionDistributionStatus(
     return {std::move(distribution)};
 }
 
+/**
+ * Collects the data size of the specified collections on every shard. If 'includeLoad' is set, also
+ * collects, and resets on the shards, the load put by each of their ranges since the previous time
+ * it was collected.
+ */
 stdx::unordered_map<NamespaceString, CollectionDataSizeInfoForBalancing>
 getDataSizeInfoForCollections(OperationContext* opCtx,
-                              const std::vector<CollectionType>& collections) {
+                              const std::vector<CollectionType>& collections,
+                              bool includeLoad = false) {
     const auto balancerConfig = Grid::get(opCtx)->getBalancerConfiguration();
     uassertStatusOK(balancerConfig->refreshAndCheck(opCtx));
 
@@ -129,8 +135,16 @@ getDataSizeInfoForCollections(OperationContext* opCtx,
         namespacesWithUUIDsForStatsRequest.push_back(nssWithUUID);
     }
 
+    if (includeLoad) {
+        for (auto& [_, dataSizeInfo] : dataSizeInfoMap) {
+            dataSizeInfo.loadInfo.emplace(balancerLoadMinNumOps.load(),
+                                          balancerLoadImbalanceThresholdPercent.load());
+        }
+    }
+
     ShardsvrGetStatsForBalancing req{namespacesWithUUIDsForStatsRequest};
     req.setScaleFactor(1);
+    req.setIncludeRangeLoad(includeLoad);
     const auto reqObj = req.toBSON({});
 
     const auto executor = Grid::get(opCtx)->getExecutorPool()->getFixedExecutor();
@@ -159,7 +173,15 @@ getDataSizeInfoForCollections(OperationContext* opCtx,
             invariant(collStatsFromShard.size() == collections.size());
             for (const auto& stats : collStatsFromShard) {
                 invariant(dataSizeInfoMap.contains(stats.getNs()));
-                dataSizeInfoMap.at(stats.getNs()).shardToDataSizeMap[shardId] = stats.getCollSize();
+                auto& dataSizeInfo = dataSizeInfoMap.at(stats.getNs());
+                dataSizeInfo.shardToDataSizeMap[shardId] = stats.getCollSize();
+
+                if (dataSizeInfo.loadInfo && stats.getRangeLoad()) {
+                    for (const auto& rangeLoad : *stats.getRangeLoad()) {
+                        dataSizeInfo.loadInfo->rangeToNumOpsMap[rangeLoad.getMin().getOwned()] +=
+                            rangeLoad.getNumOps();
+                    }
+                }
             }
         } catch (const ExceptionFor<ErrorCodes::ShardNotFound>& ex) {
             // Handle `removeShard`: skip shards removed during a balancing round
@@ -453,7 +475,8 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicyImpl::selectChunksToMo
             collsDataSizeInfo;
         if (feature_flags::gBalanceAccordingToDataSize.isEnabled(
                 serverGlobalParams.featureCompatibility)) {
-            collsDataSizeInfo.emplace(getDataSizeInfoForCollections(opCtx, collBatch));
+            collsDataSizeInfo.emplace(getDataSizeInfoForCollections(
+                opCtx, collBatch, balancerLoadAwareBalancing.load()));
         }
 
         for (const auto& collFromBatch : collBatch) {
@@ -567,6 +567,18 @@ MigrateInfosWithReason BalancerPolicy::balance(
 
         auto singleZoneBalance = [&]() {
             if (collDataSizeInfo.has_value()) {
+                if (collDataSizeInfo->loadInfo &&
+                    _singleZoneBalanceBasedOnLoad(shardStats,
+                                                  distribution,
+                                                  *collDataSizeInfo,
+                                                  zone,
+                                                  &migrations,
+                                                  usedShards,
+                                                  forceJumbo ? ForceJumbo::kForceBalancer
+                                                             : ForceJumbo::kDoNotForce)) {
+                    return true;
+                }
+
                 return _singleZoneBalanceBasedOnDataSize(shardStats,
                                                          distribution,
                                                          *collDataSizeInfo,
@@ -710,6 +722,160 @@ bool BalancerPolicy::_singleZoneBalanceBasedOnChunks(const ShardStatisticsVector
     return false;
 }
 
+std::map<ShardId, int64_t> BalancerPolicy::_getShardsLoad(
+    const ShardStatisticsVector& shardStats,
+    const DistributionStatus& distribution,
+    const CollectionLoadInfoForBalancing& loadInfo,
+    const string& zone) {
+    std::map<ShardId, int64_t> shardsLoad;
+
+    for (const auto& stat : shardStats) {
+        if (!zone.empty() && !stat.shardZones.count(zone))
+            continue;
+
+        auto& shardLoad = shardsLoad[stat.shardId];
+        for (const auto& chunk : distribution.getChunks(stat.shardId)) {
+            if (distribution.getZoneForChunk(chunk) != zone)
+                continue;
+
+            const auto rangeNumOpsIt = loadInfo.rangeToNumOpsMap.find(chunk.getMin());
+            if (rangeNumOpsIt != loadInfo.rangeToNumOpsMap.end()) {
+                shardLoad += rangeNumOpsIt->second;
+            }
+        }
+    }
+
+    return shardsLoad;
+}
+
+stdx::unordered_set<ShardId> BalancerPolicy::_getOverloadedShards(
+    const std::map<ShardId, int64_t>& shardsLoad, const CollectionLoadInfoForBalancing& loadInfo) {
+    int64_t totalNumOps = 0;
+    for (const auto& [_, shardLoad] : shardsLoad) {
+        totalNumOps += shardLoad;
+    }
+
+    if (shardsLoad.empty() || totalNumOps < loadInfo.minNumOps) {
+        return {};
+    }
+
+    const double maxShardLoad = static_cast<double>(totalNumOps) / shardsLoad.size() *
+        (100 + loadInfo.imbalanceThresholdPercent) / 100;
+
+    stdx::unordered_set<ShardId> overloadedShards;
+    for (const auto& [shardId, shardLoad] : shardsLoad) {
+        if (shardLoad > maxShardLoad) {
+            overloadedShards.insert(shardId);
+        }
+    }
+
+    return overloadedShards;
+}
+
+bool BalancerPolicy::_singleZoneBalanceBasedOnLoad(
+    const ShardStatisticsVector& shardStats,
+    const DistributionStatus& distribution,
+    const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+    const string& zone,
+    vector<MigrateInfo>* migrations,
+    stdx::unordered_set<ShardId>* usedShards,
+    ForceJumbo forceJumbo) {
+    const auto& loadInfo = *collDataSizeInfo.loadInfo;
+    const auto shardsLoad = _getShardsLoad(shardStats, distribution, loadInfo, zone);
+    const auto overloadedShards = _getOverloadedShards(shardsLoad, loadInfo);
+
+    ShardId from;
+    int64_t fromLoad = numeric_limits<int64_t>::min();
+    for (const auto& shardId : overloadedShards) {
+        if (usedShards->count(shardId))
+            continue;
+
+        const auto shardLoad = shardsLoad.at(shardId);
+        if (shardLoad > fromLoad) {
+            from = shardId;
+            fromLoad = shardLoad;
+        }
+    }
+
+    if (!from.isValid())
+        return false;
+
+    ShardId to;
+    int64_t toLoad = numeric_limits<int64_t>::max();
+    for (const auto& stat : shardStats) {
+        if (usedShards->count(stat.shardId) || overloadedShards.count(stat.shardId))
+            continue;
+
+        if (!isShardSuitableReceiver(stat, zone).isOK())
+            continue;
+
+        const auto shardLoadIt = shardsLoad.find(stat.shardId);
+        if (shardLoadIt != shardsLoad.end() && shardLoadIt->second < toLoad) {
+            to = stat.shardId;
+            toLoad = shardLoadIt->second;
+        }
+    }
+
+    if (!to.isValid())
+        return false;
+
+    // Moving a chunk only helps if the highest load of the two shards after the migration is lower
+    // than the current load of the donor, so only chunks with less load than the gap between the
+    // two shards are candidates. Out of those, pick the one which leaves the lowest peak load.
+    const ChunkType* chunkToMove = nullptr;
+    int64_t peakLoadAfterMove = fromLoad;
+    unsigned numJumboChunks = 0;
+
+    for (const auto& chunk : distribution.getChunks(from)) {
+        if (distribution.getZoneForChunk(chunk) != zone)
+            continue;
+
+        const auto rangeNumOpsIt = loadInfo.rangeToNumOpsMap.find(chunk.getMin());
+        if (rangeNumOpsIt == loadInfo.rangeToNumOpsMap.end())
+            continue;
+
+        if (chunk.getJumbo()) {
+            numJumboChunks++;
+            continue;
+        }
+
+        const auto chunkLoad = rangeNumOpsIt->second;
+        const auto peakLoad = std::max(fromLoad - chunkLoad, toLoad + chunkLoad);
+        if (peakLoad < peakLoadAfterMove) {
+            chunkToMove = &chunk;
+            peakLoadAfterMove = peakLoad;
+        }
+    }
+
+    LOGV2_DEBUG(7360600,
+                1,
+                "Balancing single zone according to load",
+                "namespace"_attr = distribution.nss().ns(),
+                "zone"_attr = zone,
+                "fromShardId"_attr = from,
+                "fromShardNumOps"_attr = fromLoad,
+                "toShardId"_attr = to,
+                "toShardNumOps"_attr = toLoad,
+                "peakNumOpsAfterMove"_attr = peakLoadAfterMove,
+                "numJumboChunks"_attr = numJumboChunks);
+
+    if (!chunkToMove)
+        return false;
+
+    migrations->emplace_back(to,
+                             from,
+                             distribution.nss(),
+                             chunkToMove->getCollectionUUID(),
+                             chunkToMove->getMin(),
+                             chunkToMove->getMax(),
+                             chunkToMove->getVersion(),
+                             forceJumbo,
+                             collDataSizeInfo.maxChunkSizeBytes);
+    invariant(usedShards->insert(from).second);
+    invariant(usedShards->insert(to).second);
+    return true;
+}
+
 bool BalancerPolicy::_singleZoneBalanceBasedOnDataSize(
     const ShardStatisticsVector& shardStats,
     const DistributionStatus& distribution,
@@ -723,8 +889,18 @@ bool BalancerPolicy::_singleZoneBalanceBasedOnDataSize(
     if (!from.isValid())
         return false;
 
-    const auto [to, toSize] =
-        _getLeastLoadedReceiverShard(shardStats, distribution, collDataSizeInfo, zone, *usedShards);
+    // Do not move data onto shards which are already overloaded, as that would undo the work of
+    // load aware balancing
+    auto excludedReceivers = *usedShards;
+    if (collDataSizeInfo.loadInfo) {
+        const auto overloadedShards = _getOverloadedShards(
+            _getShardsLoad(shardStats, distribution, *collDataSizeInfo.loadInfo, zone),
+            *collDataSizeInfo.loadInfo);
+        excludedReceivers.insert(overloadedShards.begin(), overloadedShards.end());
+    }
+
+    const auto [to, toSize] = _getLeastLoadedReceiverShard(
+        shardStats, distribution, collDataSizeInfo, zone, excludedReceivers);
     if (!to.isValid()) {
         if (migrations->empty()) {
             LOGV2(6581600, "No available shards to take chunks for zone", "zone"_attr = zone);
@@ -215,6 +215,27 @@ typedef stdx::variant<Status, StatusWith<AutoSplitVectorResponse>, StatusWith<Da
 typedef std::vector<ClusterStatistics::ShardStatistics> ShardStatisticsVector;
 typedef std::map<ShardId, std::vector<ChunkType>> ShardToChunksMap;
 
+/*
+ * Keeps track of info needed for load aware balancing.
+ */
+struct CollectionLoadInfoForBalancing {
+    CollectionLoadInfoForBalancing(int64_t minNumOps, int64_t imbalanceThresholdPercent)
+        : minNumOps(minNumOps), imbalanceThresholdPercent(imbalanceThresholdPercent) {}
+
+    // Number of operations which targeted each range of the collection since the previous
+    // balancing round, indexed by the min key of the range
+    BSONObjIndexedMap<int64_t> rangeToNumOpsMap =
+        SimpleBSONObjComparator::kInstance.makeBSONObjIndexedMap<int64_t>();
+
+    // Minimum number of operations which must have targeted a zone of the collection for its load
+    // to be taken into account
+    const int64_t minNumOps;
+
+    // How much higher than the average load of the shards in a zone the load of a shard must be,
+    // in percent, for ranges to be moved off of it
+    const int64_t imbalanceThresholdPercent;
+};
+
 /*
  * Keeps track of info needed for data size aware balancing.
  */
@@ -225,6 +246,9 @@ struct CollectionDataSizeInfoForBalancing {
 
     std::map<ShardId, int64_t> shardToDataSizeMap;
     const int64_t maxChunkSizeBytes;
+
+    // Set only in case of load aware balancing
+    boost::optional<CollectionLoadInfoForBalancing> loadInfo;
 };
 
 /**
@@ -458,10 +482,47 @@ private:
                                                 stdx::unordered_set<ShardId>* usedShards,
                                                 ForceJumbo forceJumbo);
 
+    /**
+     * Returns the number of operations which targeted the chunks of the specified zone owned by
+     * each of the shards with that zone, all shards in case the zone is empty.
+     */
+    static std::map<ShardId, int64_t> _getShardsLoad(const ShardStatisticsVector& shardStats,
+                                                     const DistributionStatus& distribution,
+                                                     const CollectionLoadInfoForBalancing& loadInfo,
+                                                     const std::string& zone);
+
+    /**
+     * Returns the shards whose load for the specified zone is higher than the average load of the
+     * shards with that zone by more than the configured threshold. Returns an empty set if the
+     * zone has not been targeted by enough operations for its load to be taken into account.
+     */
+    static stdx::unordered_set<ShardId> _getOverloadedShards(
+        const std::map<ShardId, int64_t>& shardsLoad,
+        const CollectionLoadInfoForBalancing& loadInfo);
+
+    /**
+     * Selects one chunk for the specified zone (if appropriate) to be moved from the shard with the
+     * highest load to the shard with the lowest load, choosing the chunk which minimizes the
+     * highest load of the two shards after the migration. Takes into account and updates the
+     * shards, which have already been used for migrations.
+     *
+     * Returns true if a migration was suggested, false otherwise. This method is intented to be
+     * called multiple times until all posible migrations for a zone have been selected.
+     */
+    static bool _singleZoneBalanceBasedOnLoad(
+        const ShardStatisticsVector& shardStats,
+        const DistributionStatus& distribution,
+        const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+        const std::string& zone,
+        std::vector<MigrateInfo>* migrations,
+        stdx::unordered_set<ShardId>* usedShards,
+        ForceJumbo forceJumbo);
+
     /**
      * Selects one range for the specified zone (if appropriate) to be moved in order to bring the
      * deviation of the collection data size closer to even across all shards in the specified
      * zone. Takes into account and updates the shards, which have already been used for migrations.
+     * In case of load aware balancing, ranges are never moved to shards which are overloaded.
      *
      * Returns true if a migration was suggested, false otherwise. This method is intented to be
      * called multiple times until all posible migrations for a zone have been selected.
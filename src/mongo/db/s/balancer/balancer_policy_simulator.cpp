@@ -0,0 +1,176 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/s/balancer/balancer_policy_simulator.h"
+
+#include <algorithm>
+
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+BalancerPolicySimulator::BalancerPolicySimulator(
+    int64_t maxChunkSizeBytes, boost::optional<CollectionLoadInfoForBalancing> loadInfo)
+    : _maxChunkSizeBytes(maxChunkSizeBytes),
+      _loadInfo(std::move(loadInfo)),
+      _collectionVersion({OID::gen(), Timestamp(1, 1)}, {1, 0}) {}
+
+void BalancerPolicySimulator::addShard(const ShardId& shardId, std::set<std::string> zones) {
+    _shardStats.emplace_back(shardId,
+                             0 /* maxSizeBytes */,
+                             0 /* currSizeBytes */,
+                             false /* isDraining */,
+                             std::move(zones),
+                             "" /* mongoVersion */,
+                             ClusterStatistics::ShardStatistics::use_bytes_t{});
+}
+
+void BalancerPolicySimulator::addRange(const ShardId& shardId,
+                                       int64_t dataSizeBytes,
+                                       int64_t numOps) {
+    _collectionVersion.incMajor();
+    _ranges.push_back({shardId, dataSizeBytes, numOps, _collectionVersion});
+}
+
+void BalancerPolicySimulator::addZoneRange(const ZoneRange& zoneRange) {
+    _zoneRanges.push_back(zoneRange);
+}
+
+BalancerPolicySimulator::Round BalancerPolicySimulator::runRound() {
+    ShardToChunksMap shardToChunksMap;
+    std::map<ShardId, int64_t> shardToDataSizeMap;
+    for (auto& stat : _shardStats) {
+        shardToChunksMap[stat.shardId];
+        stat.currSizeBytes = getShardDataSizeBytes(stat.shardId);
+        shardToDataSizeMap[stat.shardId] = stat.currSizeBytes;
+    }
+
+    CollectionDataSizeInfoForBalancing collDataSizeInfo(std::move(shardToDataSizeMap),
+                                                        _maxChunkSizeBytes);
+    collDataSizeInfo.loadInfo = _loadInfo;
+
+    auto rangeMinToIndex = SimpleBSONObjComparator::kInstance.makeBSONObjIndexedMap<size_t>();
+    for (size_t i = 0; i < _ranges.size(); ++i) {
+        const auto& range = _ranges[i];
+
+        ChunkType chunk;
+        chunk.setCollectionUUID(_uuid);
+        chunk.setMin(_getRangeMin(i));
+        chunk.setMax(_getRangeMax(i));
+        chunk.setShard(range.shardId);
+        chunk.setVersion(range.version);
+
+        if (collDataSizeInfo.loadInfo) {
+            collDataSizeInfo.loadInfo->rangeToNumOpsMap[chunk.getMin()] = range.numOps;
+        }
+        rangeMinToIndex[chunk.getMin()] = i;
+        shardToChunksMap[range.shardId].push_back(std::move(chunk));
+    }
+
+    DistributionStatus distribution(_nss, std::move(shardToChunksMap));
+    for (const auto& zoneRange : _zoneRanges) {
+        uassertStatusOK(distribution.addRangeToZone(zoneRange));
+    }
+
+    stdx::unordered_set<ShardId> usedShards;
+    auto [migrations, _] = BalancerPolicy::balance(
+        _shardStats, distribution, collDataSizeInfo, &usedShards, false /* forceJumbo */);
+
+    for (const auto& migration : migrations) {
+        auto& range = _ranges[rangeMinToIndex.at(migration.minKey)];
+        invariant(range.shardId == migration.from);
+
+        _collectionVersion.incMajor();
+        range.shardId = migration.to;
+        range.version = _collectionVersion;
+    }
+
+    return {std::move(migrations), getPeakShardNumOps(), getPeakShardDataSizeBytes()};
+}
+
+std::vector<BalancerPolicySimulator::Round> BalancerPolicySimulator::run(size_t maxNumRounds) {
+    std::vector<Round> rounds;
+    while (rounds.size() < maxNumRounds) {
+        rounds.push_back(runRound());
+        if (rounds.back().migrations.empty()) {
+            break;
+        }
+    }
+    return rounds;
+}
+
+int64_t BalancerPolicySimulator::getShardNumOps(const ShardId& shardId) const {
+    int64_t numOps = 0;
+    for (const auto& range : _ranges) {
+        if (range.shardId == shardId) {
+            numOps += range.numOps;
+        }
+    }
+    return numOps;
+}
+
+int64_t BalancerPolicySimulator::getShardDataSizeBytes(const ShardId& shardId) const {
+    int64_t dataSizeBytes = 0;
+    for (const auto& range : _ranges) {
+        if (range.shardId == shardId) {
+            dataSizeBytes += range.dataSizeBytes;
+        }
+    }
+    return dataSizeBytes;
+}
+
+int64_t BalancerPolicySimulator::getPeakShardNumOps() const {
+    int64_t peakNumOps = 0;
+    for (const auto& stat : _shardStats) {
+        peakNumOps = std::max(peakNumOps, getShardNumOps(stat.shardId));
+    }
+    return peakNumOps;
+}
+
+int64_t BalancerPolicySimulator::getPeakShardDataSizeBytes() const {
+    int64_t peakDataSizeBytes = 0;
+    for (const auto& stat : _shardStats) {
+        peakDataSizeBytes = std::max(peakDataSizeBytes, getShardDataSizeBytes(stat.shardId));
+    }
+    return peakDataSizeBytes;
+}
+
+BSONObj BalancerPolicySimulator::_getRangeMin(size_t rangeIndex) const {
+    return rangeIndex == 0 ? _shardKeyPattern.globalMin()
+                           : BSON("x" << static_cast<long long>(rangeIndex));
+}
+
+BSONObj BalancerPolicySimulator::_getRangeMax(size_t rangeIndex) const {
+    return rangeIndex == _ranges.size() - 1 ? _shardKeyPattern.globalMax()
+                                            : BSON("x" << static_cast<long long>(rangeIndex + 1));
+}
+
+}  // namespace mongo
@@ -0,0 +1,125 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "mongo/db/keypattern.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/s/balancer/balancer_policy.h"
+#include "mongo/s/shard_id.h"
+
+namespace mongo {
+
+/**
+ * Offline model of a sharded collection, used to evaluate the balancer policy without a cluster.
+ *
+ * Every range of the simulated collection has a data size and a number of operations targeting it
+ * per balancing round. Each simulated round feeds the current distribution of the ranges to
+ * BalancerPolicy::balance, the same way the balancer does, and applies the migrations it suggests.
+ * A migration always moves a whole range, so the ranges should be smaller than the max chunk size.
+ */
+class BalancerPolicySimulator {
+public:
+    /**
+     * Summary of a simulated balancing round.
+     */
+    struct Round {
+        MigrateInfoVector migrations;
+
+        // Highest number of operations and data size on a single shard after the migrations
+        int64_t peakShardNumOps;
+        int64_t peakShardDataSizeBytes;
+    };
+
+    BalancerPolicySimulator(int64_t maxChunkSizeBytes,
+                            boost::optional<CollectionLoadInfoForBalancing> loadInfo);
+
+    /**
+     * Adds a shard to the simulated cluster, optionally belonging to the specified zones.
+     */
+    void addShard(const ShardId& shardId, std::set<std::string> zones = {});
+
+    /**
+     * Appends a range owned by the specified shard to the simulated collection. The ranges are in
+     * the form [MinKey, 1), [1, 2), [2, 3) ... [N - 1, MaxKey) in the order they are added.
+     */
+    void addRange(const ShardId& shardId, int64_t dataSizeBytes, int64_t numOps);
+
+    /**
+     * Assigns the specified range of shard key values to a zone.
+     */
+    void addZoneRange(const ZoneRange& zoneRange);
+
+    /**
+     * Simulates a single balancing round and returns its summary.
+     */
+    Round runRound();
+
+    /**
+     * Simulates balancing rounds until the policy suggests no more migrations, or until the
+     * specified number of rounds is reached. Returns the summary of every simulated round.
+     */
+    std::vector<Round> run(size_t maxNumRounds);
+
+    int64_t getShardNumOps(const ShardId& shardId) const;
+    int64_t getShardDataSizeBytes(const ShardId& shardId) const;
+
+    int64_t getPeakShardNumOps() const;
+    int64_t getPeakShardDataSizeBytes() const;
+
+private:
+    struct SimulatedRange {
+        ShardId shardId;
+        int64_t dataSizeBytes;
+        int64_t numOps;
+        ChunkVersion version;
+    };
+
+    BSONObj _getRangeMin(size_t rangeIndex) const;
+    BSONObj _getRangeMax(size_t rangeIndex) const;
+
+    const NamespaceString _nss{"TestDB", "SimulatedColl"};
+    const UUID _uuid{UUID::gen()};
+    const KeyPattern _shardKeyPattern{BSON("x" << 1)};
+
+    const int64_t _maxChunkSizeBytes;
+    const boost::optional<CollectionLoadInfoForBalancing> _loadInfo;
+
+    ShardStatisticsVector _shardStats;
+    std::vector<ZoneRange> _zoneRanges;
+    std::vector<SimulatedRange> _ranges;
+
+    ChunkVersion _collectionVersion;
+};
+
+}  // namespace mongo
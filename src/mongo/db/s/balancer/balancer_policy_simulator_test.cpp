@@ -0,0 +1,175 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/s/balancer/balancer_policy_simulator.h"
+#include "mongo/unittest/unittest.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kTest
+
+
+namespace mongo {
+namespace {
+
+const auto kShardId0 = ShardId("shard0");
+const auto kShardId1 = ShardId("shard1");
+const auto kShardId2 = ShardId("shard2");
+const int64_t kMaxChunkSizeBytes = 128 * 1024 * 1024;
+const int64_t kRangeDataSizeBytes = 1024 * 1024;
+const int64_t kMaxNumRounds = 100;
+
+CollectionLoadInfoForBalancing makeLoadInfo() {
+    return CollectionLoadInfoForBalancing(1000 /* minNumOps */,
+                                          20 /* imbalanceThresholdPercent */);
+}
+
+/**
+ * Populates the simulator with three shards owning ten ranges of the same size each. The ranges
+ * owned by the first shard are targeted by ten times as many operations as the other ones.
+ */
+void addClusterWithHotShard(BalancerPolicySimulator* simulator) {
+    for (const auto& shardId : {kShardId0, kShardId1, kShardId2}) {
+        simulator->addShard(shardId);
+        for (int i = 0; i < 10; ++i) {
+            simulator->addRange(shardId, kRangeDataSizeBytes, shardId == kShardId0 ? 1000 : 100);
+        }
+    }
+}
+
+TEST(BalancerPolicySimulator, DataSizeBalancingIgnoresHotShard) {
+    BalancerPolicySimulator simulator(kMaxChunkSizeBytes, boost::none /* loadInfo */);
+    addClusterWithHotShard(&simulator);
+
+    const auto rounds = simulator.run(kMaxNumRounds);
+    ASSERT_EQ(1U, rounds.size());
+    ASSERT(rounds.back().migrations.empty());
+    ASSERT_EQ(10000, simulator.getPeakShardNumOps());
+}
+
+TEST(BalancerPolicySimulator, LoadAwareBalancingReducesPeakLoad) {
+    BalancerPolicySimulator simulator(kMaxChunkSizeBytes, makeLoadInfo());
+    addClusterWithHotShard(&simulator);
+
+    const auto rounds = simulator.run(kMaxNumRounds);
+    ASSERT_LT(rounds.size(), kMaxNumRounds);
+    ASSERT(rounds.back().migrations.empty());
+
+    // The peak load only ever decreases, until it is within the threshold of the average load
+    int64_t previousPeakNumOps = 10000;
+    for (const auto& round : rounds) {
+        ASSERT_LTE(round.peakShardNumOps, previousPeakNumOps);
+        previousPeakNumOps = round.peakShardNumOps;
+
+        for (const auto& migration : round.migrations) {
+            ASSERT_EQ(kShardId0, migration.from);
+            ASSERT(migration.maxKey);
+        }
+    }
+
+    const int64_t averageNumOps = (10000 + 1000 + 1000) / 3;
+    ASSERT_LTE(simulator.getPeakShardNumOps(), averageNumOps * 120 / 100);
+    ASSERT_LT(simulator.getShardNumOps(kShardId0), 10000);
+}
+
+TEST(BalancerPolicySimulator, LoadAwareBalancingDoesNotMoveRangesWithUniformLoad) {
+    BalancerPolicySimulator simulator(kMaxChunkSizeBytes, makeLoadInfo());
+    for (const auto& shardId : {kShardId0, kShardId1, kShardId2}) {
+        simulator.addShard(shardId);
+        for (int i = 0; i < 10; ++i) {
+            simulator.addRange(shardId, kRangeDataSizeBytes, 1000);
+        }
+    }
+
+    const auto rounds = simulator.run(kMaxNumRounds);
+    ASSERT_EQ(1U, rounds.size());
+    ASSERT(rounds.back().migrations.empty());
+}
+
+TEST(BalancerPolicySimulator, LoadAwareBalancingIgnoresLowLoad) {
+    BalancerPolicySimulator simulator(kMaxChunkSizeBytes, makeLoadInfo());
+    simulator.addShard(kShardId0);
+    simulator.addShard(kShardId1);
+    for (int i = 0; i < 10; ++i) {
+        simulator.addRange(kShardId0, kRangeDataSizeBytes, 10);
+        simulator.addRange(kShardId1, kRangeDataSizeBytes, 0);
+    }
+
+    const auto rounds = simulator.run(kMaxNumRounds);
+    ASSERT_EQ(1U, rounds.size());
+    ASSERT(rounds.back().migrations.empty());
+}
+
+TEST(BalancerPolicySimulator, LoadAwareBalancingDoesNotBounceSingleHotRange) {
+    BalancerPolicySimulator simulator(kMaxChunkSizeBytes, makeLoadInfo());
+    simulator.addShard(kShardId0);
+    simulator.addShard(kShardId1);
+    simulator.addRange(kShardId0, kRangeDataSizeBytes, 100000);
+    for (int i = 0; i < 5; ++i) {
+        simulator.addRange(kShardId0, kRangeDataSizeBytes, 10);
+        simulator.addRange(kShardId1, kRangeDataSizeBytes, 10);
+    }
+
+    // The cold ranges are moved off of the shard owning the hot range, but the hot range itself
+    // stays where it is, since moving it would only move the hot spot to the other shard
+    const auto rounds = simulator.run(kMaxNumRounds);
+    ASSERT_LT(rounds.size(), kMaxNumRounds);
+    ASSERT(rounds.back().migrations.empty());
+    ASSERT_EQ(100000, simulator.getShardNumOps(kShardId0));
+    ASSERT_EQ(100, simulator.getShardNumOps(kShardId1));
+}
+
+TEST(BalancerPolicySimulator, LoadAwareBalancingRespectsZones) {
+    BalancerPolicySimulator simulator(kMaxChunkSizeBytes, makeLoadInfo());
+    simulator.addShard(kShardId0, {"A"});
+    simulator.addShard(kShardId1, {"A"});
+    simulator.addShard(kShardId2, {"B"});
+    for (int i = 0; i < 10; ++i) {
+        simulator.addRange(kShardId0, kRangeDataSizeBytes, 1000);
+    }
+    for (int i = 0; i < 10; ++i) {
+        simulator.addRange(kShardId1, kRangeDataSizeBytes, 100);
+    }
+    for (int i = 0; i < 10; ++i) {
+        simulator.addRange(kShardId2, kRangeDataSizeBytes, 0);
+    }
+    simulator.addZoneRange(ZoneRange(BSON("x" << MINKEY), BSON("x" << 20), "A"));
+    simulator.addZoneRange(ZoneRange(BSON("x" << 20), BSON("x" << MAXKEY), "B"));
+
+    const auto rounds = simulator.run(kMaxNumRounds);
+    ASSERT_LT(rounds.size(), kMaxNumRounds);
+    for (const auto& round : rounds) {
+        for (const auto& migration : round.migrations) {
+            ASSERT_NE(kShardId2, migration.to);
+        }
+    }
+    ASSERT_EQ(0, simulator.getShardNumOps(kShardId2));
+    ASSERT_LT(simulator.getShardNumOps(kShardId0), 10000);
+}
+
+}  // namespace
+}  // namespace mongo
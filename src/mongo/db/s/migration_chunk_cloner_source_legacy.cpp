@@ -630,6 +630,8 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromIndexScan(OperationCon
                            internalQueryExecYieldIterations.load(),
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
+    stdx::lock_guard<Latch> jumboChunkCloneLock(_jumboChunkCloneMutex);
+
     if (!_jumboChunkCloneState->clonerExec) {
         auto exec = uassertStatusOK(_getIndexScanExecutor(
             opCtx, collection, InternalPlanner::IndexScanOptions::IXSCAN_FETCH));
@@ -687,38 +689,61 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneRecordIds(
                            internalQueryExecYieldIterations.load(),
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
-    stdx::unique_lock<Latch> lk(_mutex);
-    auto iter = _cloneRecordIds.begin();
-
-    for (; iter != _cloneRecordIds.end(); ++iter) {
-        // We must always make progress in this method by at least one document because empty
-        // return indicates there is no more initial clone data.
-        if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
-            break;
+    // The recipient may clone through several concurrent streams, so record ids are claimed before
+    // reading them, as many at a time as are expected to fit in the batch, and the ones which
+    // weren't read are put back.
+    bool batchIsFull = false;
+    while (!batchIsFull) {
+        std::vector<RecordId> claimedRecordIds;
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            const auto maxToClaim = std::max<uint64_t>(
+                1,
+                (BSONObjMaxUserSize - arrBuilder->len()) /
+                    std::max<uint64_t>(1, _averageObjectSizeForCloneRecordIds));
+
+            auto claimedEnd = _cloneRecordIds.begin();
+            while (claimedEnd != _cloneRecordIds.end() && claimedRecordIds.size() < maxToClaim) {
+                claimedRecordIds.push_back(*claimedEnd++);
+            }
+            _cloneRecordIds.erase(_cloneRecordIds.begin(), claimedEnd);
         }
 
-        auto nextRecordId = *iter;
-
-        lk.unlock();
+        if (claimedRecordIds.empty()) {
+            return;
+        }
 
-        Snapshotted<BSONObj> doc;
-        if (collection->findDoc(opCtx, nextRecordId, &doc)) {
-            // Use the builder size instead of accumulating the document sizes directly so
-            // that we take into consideration the overhead of BSONArray indices.
-            if (arrBuilder->arrSize() &&
-                (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
+        auto iter = claimedRecordIds.begin();
+        ON_BLOCK_EXIT([&] {
+            if (iter != claimedRecordIds.end()) {
+                stdx::lock_guard<Latch> lk(_mutex);
+                _cloneRecordIds.insert(iter, claimedRecordIds.end());
+            }
+        });
 
+        for (; iter != claimedRecordIds.end(); ++iter) {
+            // We must always make progress in this method by at least one document because empty
+            // return indicates there is no more initial clone data.
+            if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
+                batchIsFull = true;
                 break;
             }
 
-            arrBuilder->append(doc.value());
-            ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
-        }
+            Snapshotted<BSONObj> doc;
+            if (collection->findDoc(opCtx, *iter, &doc)) {
+                // Use the builder size instead of accumulating the document sizes directly so
+                // that we take into consideration the overhead of BSONArray indices.
+                if (arrBuilder->arrSize() &&
+                    (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
+                    batchIsFull = true;
+                    break;
+                }
 
-        lk.lock();
+                arrBuilder->append(doc.value());
+                ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
+            }
+        }
     }
-
-    _cloneRecordIds.erase(_cloneRecordIds.begin(), iter);
 }
 
 uint64_t MigrationChunkClonerSourceLegacy::getCloneBatchBufferAllocationSize() {
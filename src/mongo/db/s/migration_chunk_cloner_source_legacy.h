@@ -150,8 +150,8 @@ public:
 
     /**
      * Called by the recipient shard. Populates the passed BSONArrayBuilder with a set of documents,
-     * which are part of the initial clone sequence. Assumes that there is only one active caller
-     * to this method at a time (otherwise, it can cause corruption/crash).
+     * which are part of the initial clone sequence. May be called concurrently by several cloning
+     * streams of the recipient, each of which gets a disjoint set of documents.
      *
      * Returns OK status on success. If there were documents returned in the result argument, this
      * method should be called more times until the result is empty. If it returns failure, it is
@@ -400,6 +400,11 @@ private:
 
     // Set only once its discovered a chunk is jumbo
     boost::optional<JumboChunkCloneState> _jumboChunkCloneState;
+
+    // Serializes the concurrent calls to nextCloneBatch() which clone a jumbo chunk, since they all
+    // advance the single executor in '_jumboChunkCloneState'.
+    Mutex _jumboChunkCloneMutex =
+        MONGO_MAKE_LATCH("MigrationChunkClonerSourceLegacy::_jumboChunkCloneMutex");
 };
 
 /**
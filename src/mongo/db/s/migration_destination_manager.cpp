@@ -607,6 +607,92 @@ repl::OpTime MigrationDestinationManager::fetchAndApplyBatch(
     return lastOpApplied;
 }
 
+repl::OpTime MigrationDestinationManager::fetchAndApplyBatchesConcurrently(
+    OperationContext* opCtx,
+    int numStreams,
+    std::function<bool(OperationContext*, BSONObj)> applyBatchFn,
+    std::function<bool(OperationContext*, BSONObj*)> fetchBatchFn) {
+    if (numStreams <= 1) {
+        return fetchAndApplyBatch(opCtx, applyBatchFn, fetchBatchFn);
+    }
+
+    // Cancelled when any stream fails, or when 'opCtx' is interrupted.
+    CancellationSource streamsCancellationSource(opCtx->getCancellationToken());
+    auto executor = Grid::get(opCtx->getServiceContext())->getExecutorPool()->getFixedExecutor();
+
+    Mutex mutex = MONGO_MAKE_LATCH("MigrationDestinationManager::fetchAndApplyBatchesConcurrently");
+    repl::OpTime lastOpApplied;
+    Status firstError = Status::OK();
+
+    std::vector<stdx::thread> streams;
+    streams.reserve(numStreams);
+    for (int i = 0; i < numStreams; ++i) {
+        streams.emplace_back([&] {
+            Client::initThread("migrationCloneStream", opCtx->getServiceContext(), nullptr);
+            auto client = Client::getCurrent();
+            {
+                stdx::lock_guard lk(*client);
+                client->setSystemOperationKillableByStepdown(lk);
+            }
+            auto streamOpCtx = CancelableOperationContext(
+                cc().makeOperationContext(), streamsCancellationSource.token(), executor);
+
+            try {
+                auto streamLastOpApplied =
+                    fetchAndApplyBatch(streamOpCtx.get(), applyBatchFn, fetchBatchFn);
+
+                stdx::lock_guard<Latch> lk(mutex);
+                if (lastOpApplied < streamLastOpApplied) {
+                    lastOpApplied = streamLastOpApplied;
+                }
+            } catch (const DBException& ex) {
+                {
+                    stdx::lock_guard<Latch> lk(mutex);
+                    if (firstError.isOK()) {
+                        firstError = ex.toStatus();
+                    }
+                }
+                streamsCancellationSource.cancel();
+            }
+        });
+    }
+
+    for (auto& stream : streams) {
+        stream.join();
+    }
+
+    opCtx->checkForInterrupt();
+    uassertStatusOK(firstError);
+    return lastOpApplied;
+}
+
+void MigrationDestinationManager::checkCloneForInterrupt(OperationContext* outerOpCtx,
+                                                         OperationContext* opCtx,
+                                                         bool concurrentStream) {
+    opCtx->checkForInterrupt();
+    if (!concurrentStream) {
+        outerOpCtx->checkForInterrupt();
+    }
+}
+
+Status MigrationDestinationManager::awaitClonedDocumentsReplication(
+    OperationContext* outerOpCtx,
+    OperationContext* opCtx,
+    bool concurrentStream,
+    const WriteConcernOptions& writeConcern) {
+    auto awaitReplication = [&] {
+        const auto& lastOp = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+        return repl::ReplicationCoordinator::get(opCtx)
+            ->awaitReplication(opCtx, lastOp, writeConcern)
+            .status;
+    };
+
+    if (concurrentStream) {
+        return awaitReplication();
+    }
+    return runWithoutSession(outerOpCtx, awaitReplication);
+}
+
 Status MigrationDestinationManager::abort(const MigrationSessionId& sessionId) {
     stdx::lock_guard<Latch> sl(_mutex);
 
@@ -1318,13 +1404,16 @@ void MigrationDestinationManager::_migrateDriver(OperationContext* outerOpCtx,
 
             _chunkMarkedPending = true;  // no lock needed, only the migrate thread looks.
 
-            auto assertNotAborted = [&](OperationContext* opCtx) {
-                opCtx->checkForInterrupt();
-                outerOpCtx->checkForInterrupt();
+            // Concurrent cloning streams run on their own clients and must not touch
+            // 'outerOpCtx', so 'insertBatchFn' is told whether it runs on one of them.
+            auto assertNotAborted = [&](OperationContext* opCtx, bool concurrentStream) {
+                checkCloneForInterrupt(outerOpCtx, opCtx, concurrentStream);
                 uassert(50748, "Migration aborted while copying documents", getState() != kAbort);
             };
 
-            auto insertBatchFn = [&](OperationContext* opCtx, BSONObj nextBatch) {
+            auto insertBatchFn = [&](OperationContext* opCtx,
+                                     BSONObj nextBatch,
+                                     bool concurrentStream) {
                 auto arr = nextBatch["objects"].Obj();
                 if (arr.isEmpty()) {
                     return false;
@@ -1335,7 +1424,7 @@ void MigrationDestinationManager::_migrateDriver(OperationContext* outerOpCtx,
                     int batchClonedBytes = 0;
                     const int batchMaxCloned = migrateCloneInsertionBatchSize.load();
 
-                    assertNotAborted(opCtx);
+                    assertNotAborted(opCtx, concurrentStream);
 
                     write_ops::InsertCommandRequest insertOp(_nss);
                     insertOp.getWriteCommandRequestBase().setOrdered(true);
@@ -1382,21 +1471,16 @@ void MigrationDestinationManager::_migrateDriver(OperationContext* outerOpCtx,
                         _clonedBytes += batchClonedBytes;
                     }
                     if (_writeConcern.needToWaitForOtherNodes()) {
-                        runWithoutSession(outerOpCtx, [&] {
-                            repl::ReplicationCoordinator::StatusAndDuration replStatus =
-                                repl::ReplicationCoordinator::get(opCtx)->awaitReplication(
-                                    opCtx,
-                                    repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp(),
-                                    _writeConcern);
-                            if (replStatus.status.code() == ErrorCodes::WriteConcernFailed) {
-                                LOGV2_WARNING(
-                                    22011,
-                                    "secondaryThrottle on, but doc insert timed out; continuing",
-                                    "migrationId"_attr = _migrationId->toBSON());
-                            } else {
-                                uassertStatusOK(replStatus.status);
-                            }
-                        });
+                        auto replStatus = awaitClonedDocumentsReplication(
+                            outerOpCtx, opCtx, concurrentStream, _writeConcern);
+                        if (replStatus.code() == ErrorCodes::WriteConcernFailed) {
+                            LOGV2_WARNING(
+                                22011,
+                                "secondaryThrottle on, but doc insert timed out; continuing",
+                                "migrationId"_attr = _migrationId->toBSON());
+                        } else {
+                            uassertStatusOK(replStatus);
+                        }
                     }
 
                     sleepmillis(migrateCloneInsertionBatchDelayMS.load());
@@ -1421,9 +1505,34 @@ void MigrationDestinationManager::_migrateDriver(OperationContext* outerOpCtx,
                 return nextBatch->getField("objects").Obj().isEmpty();
             };
 
+            // Donors older than the latest FCV serve _migrateClone to a single caller at a time.
+            const int cloneConcurrency = feature_flags::gConcurrentMigrationClone.isEnabled(
+                                             serverGlobalParams.featureCompatibility)
+                ? migrateCloneConcurrency.load()
+                : 1;
+
             // If running on a replicated system, we'll need to flush the docs we cloned to the
             // secondaries
-            lastOpApplied = fetchAndApplyBatch(opCtx, insertBatchFn, fetchBatchFn);
+            if (cloneConcurrency > 1) {
+                // The cloning streams wait for replication on their own clients, so the session of
+                // 'outerOpCtx' is checked in while they run.
+                runWithoutSession(outerOpCtx, [&] {
+                    lastOpApplied = fetchAndApplyBatchesConcurrently(
+                        opCtx,
+                        cloneConcurrency,
+                        [&](OperationContext* opCtx, BSONObj nextBatch) {
+                            return insertBatchFn(opCtx, nextBatch, true /* concurrentStream */);
+                        },
+                        fetchBatchFn);
+                });
+            } else {
+                lastOpApplied = fetchAndApplyBatch(
+                    opCtx,
+                    [&](OperationContext* opCtx, BSONObj nextBatch) {
+                        return insertBatchFn(opCtx, nextBatch, false /* concurrentStream */);
+                    },
+                    fetchBatchFn);
+            }
 
             timing->done(4);
             migrateThreadHangAtStep4.pauseWhileSet();
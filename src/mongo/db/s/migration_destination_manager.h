@@ -143,6 +143,36 @@ public:
         std::function<bool(OperationContext*, BSONObj)> applyBatchFn,
         std::function<bool(OperationContext*, BSONObj*)> fetchBatchFn);
 
+    /**
+     * Same as fetchAndApplyBatch(), but runs 'numStreams' fetch and apply loops concurrently, each
+     * on its own client. A failure of any stream interrupts the others and is rethrown. Returns the
+     * latest OpTime applied by any of the streams.
+     */
+    static repl::OpTime fetchAndApplyBatchesConcurrently(
+        OperationContext* opCtx,
+        int numStreams,
+        std::function<bool(OperationContext*, BSONObj)> applyBatchFn,
+        std::function<bool(OperationContext*, BSONObj*)> fetchBatchFn);
+
+    /**
+     * Checks whether the cloning operation 'opCtx' was interrupted. Unless 'concurrentStream' is
+     * set, 'opCtx' clones on behalf of 'outerOpCtx', which is checked as well. Concurrent cloning
+     * streams run on their own clients and are interrupted through their cancellation tokens.
+     */
+    static void checkCloneForInterrupt(OperationContext* outerOpCtx,
+                                       OperationContext* opCtx,
+                                       bool concurrentStream);
+
+    /**
+     * Waits for the documents cloned by 'opCtx' to replicate with 'writeConcern'. Unless
+     * 'concurrentStream' is set, the session of 'outerOpCtx' is checked in while waiting. While
+     * concurrent cloning streams run, the migration thread has already checked it in.
+     */
+    static Status awaitClonedDocumentsReplication(OperationContext* outerOpCtx,
+                                                  OperationContext* opCtx,
+                                                  bool concurrentStream,
+                                                  const WriteConcernOptions& writeConcern);
+
     /**
      * Idempotent method, which causes the current ongoing migration to abort only if it has the
      * specified session id. If the migration is already aborted, does nothing.
@@ -29,8 +29,14 @@
 
 #include "mongo/platform/basic.h"
 
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/repl/storage_interface_impl.h"
 #include "mongo/db/s/migration_destination_manager.h"
 #include "mongo/db/s/shard_server_test_fixture.h"
+#include "mongo/db/session/logical_session_cache_noop.h"
+#include "mongo/db/session/session_catalog_mongod.h"
+#include "mongo/db/transaction/transaction_participant.h"
+#include "mongo/db/write_concern_options.h"
 #include "mongo/s/catalog_cache_test_fixture.h"
 
 namespace mongo {
@@ -64,6 +70,31 @@ protected:
         }
         return arrayBuilder.arr();
     }
+
+    /**
+     * Checks out a session with a transaction number on 'opCtx', as the migration thread does.
+     */
+    void setUpSessionWithTxn(OperationContext* opCtx, TxnNumber txnNum) {
+        // onStepUp() relies on the storage interface to create the config.transactions table.
+        repl::StorageInterface::set(getServiceContext(),
+                                    std::make_unique<repl::StorageInterfaceImpl>());
+        MongoDSessionCatalog::onStepUp(opCtx);
+        LogicalSessionCache::set(getServiceContext(), std::make_unique<LogicalSessionCacheNoop>());
+
+        opCtx->setLogicalSessionId(makeLogicalSessionIdForTest());
+        opCtx->setTxnNumber(txnNum);
+        _sessionTxnState.emplace(opCtx);
+        TransactionParticipant::get(opCtx).beginOrContinue(
+            opCtx, {txnNum}, boost::none /* autocommit */, boost::none /* startTransaction */);
+    }
+
+    void tearDown() override {
+        _sessionTxnState.reset();
+        ShardServerTestFixture::tearDown();
+    }
+
+private:
+    boost::optional<MongoDOperationContextSession> _sessionTxnState;
 };
 
 // Tests that documents will ferry from the fetch logic to the insert logic successfully.
@@ -165,6 +196,126 @@ TEST_F(MigrationDestinationManagerTest, CloneDocumentsCatchesInsertErrors) {
     ASSERT_EQ(operationContext()->getKillStatus(), 51008);
 }
 
+// Tests that concurrent cloning streams together apply every batch fetched exactly once.
+TEST_F(MigrationDestinationManagerTest, CloneDocumentsConcurrentlyAppliesEveryBatchOnce) {
+    const int numBatches = 50;
+    auto mutex = MONGO_MAKE_LATCH();
+    int batchesFetched = 0;
+    std::vector<int> resultIds;
+
+    auto fetchBatchFn = [&](OperationContext* opCtx, BSONObj* nextBatch) {
+        BSONArrayBuilder arrayBuilder;
+        {
+            stdx::lock_guard<Latch> lk(mutex);
+            if (batchesFetched < numBatches) {
+                arrayBuilder.append(createDocument(batchesFetched++));
+            }
+        }
+
+        *nextBatch = BSON("objects" << arrayBuilder.arr());
+        return nextBatch->getField("objects").Obj().isEmpty();
+    };
+
+    auto insertBatchFn = [&](OperationContext* opCtx, BSONObj docs) {
+        auto arr = docs["objects"].Obj();
+        if (arr.isEmpty())
+            return false;
+        stdx::lock_guard<Latch> lk(mutex);
+        for (auto&& docToClone : arr) {
+            resultIds.push_back(docToClone.Obj()["_id"].Int());
+        }
+        return true;
+    };
+
+    MigrationDestinationManager::fetchAndApplyBatchesConcurrently(
+        operationContext(), 4, insertBatchFn, fetchBatchFn);
+
+    std::sort(resultIds.begin(), resultIds.end());
+    ASSERT_EQ(resultIds.size(), static_cast<size_t>(numBatches));
+    for (int i = 0; i < numBatches; ++i) {
+        ASSERT_EQ(resultIds[i], i);
+    }
+}
+
+// Tests that an error in one of the concurrent cloning streams is thrown on the main thread.
+TEST_F(MigrationDestinationManagerTest, CloneDocumentsConcurrentlyThrowsStreamErrors) {
+    auto fetchBatchFn = [&](OperationContext* opCtx, BSONObj* nextBatch) {
+        uasserted(ErrorCodes::NetworkTimeout, "network error");
+        return true;
+    };
+
+    auto insertBatchFn = [&](OperationContext* opCtx, BSONObj docs) { return true; };
+
+    ASSERT_THROWS_CODE_AND_WHAT(MigrationDestinationManager::fetchAndApplyBatchesConcurrently(
+                                    operationContext(), 4, insertBatchFn, fetchBatchFn),
+                                DBException,
+                                ErrorCodes::NetworkTimeout,
+                                "network error");
+}
+
+// Tests that a serial clone waits for replication with the session of the migration thread
+// checked in, and checks it out again afterwards.
+TEST_F(MigrationDestinationManagerTest, SerialCloneAwaitsReplicationWithoutSession) {
+    auto outerOpCtx = operationContext();
+    setUpSessionWithTxn(outerOpCtx, 0);
+
+    auto applierClient = getServiceContext()->makeClient("batchApplier");
+    AlternativeClientRegion acr(applierClient);
+    auto applierOpCtx = cc().makeOperationContext();
+
+    boost::optional<bool> sessionCheckedOutWhileWaiting;
+    replicationCoordinator()->setAwaitReplicationReturnValueFunction(
+        [&](OperationContext*, const repl::OpTime&) {
+            sessionCheckedOutWhileWaiting = OperationContextSession::get(outerOpCtx) != nullptr;
+            return repl::ReplicationCoordinator::StatusAndDuration(Status::OK(), Milliseconds(0));
+        });
+
+    ASSERT_OK(MigrationDestinationManager::awaitClonedDocumentsReplication(
+        outerOpCtx, applierOpCtx.get(), false /* concurrentStream */, WriteConcernOptions()));
+    ASSERT_EQ(sessionCheckedOutWhileWaiting, false);
+    ASSERT(OperationContextSession::get(outerOpCtx));
+}
+
+// Tests that a concurrent cloning stream waits for replication on its own client only.
+TEST_F(MigrationDestinationManagerTest, ConcurrentCloneStreamAwaitsReplicationOnItsOwnClient) {
+    auto outerOpCtx = operationContext();
+    setUpSessionWithTxn(outerOpCtx, 0);
+
+    auto streamClient = getServiceContext()->makeClient("migrationCloneStream");
+    AlternativeClientRegion acr(streamClient);
+    auto streamOpCtx = cc().makeOperationContext();
+
+    OperationContext* waitingOpCtx = nullptr;
+    replicationCoordinator()->setAwaitReplicationReturnValueFunction(
+        [&](OperationContext* opCtx, const repl::OpTime&) {
+            waitingOpCtx = opCtx;
+            return repl::ReplicationCoordinator::StatusAndDuration(Status::OK(), Milliseconds(0));
+        });
+
+    ASSERT_OK(MigrationDestinationManager::awaitClonedDocumentsReplication(
+        outerOpCtx, streamOpCtx.get(), true /* concurrentStream */, WriteConcernOptions()));
+    ASSERT_EQ(waitingOpCtx, streamOpCtx.get());
+    ASSERT(OperationContextSession::get(outerOpCtx));
+}
+
+// Tests that a serial clone reacts to the interruption of the migration thread's operation, which
+// concurrent cloning streams leave to their cancellation tokens.
+TEST_F(MigrationDestinationManagerTest, SerialCloneChecksOuterOperationForInterrupt) {
+    auto outerOpCtx = operationContext();
+    outerOpCtx->markKilled(ErrorCodes::Interrupted);
+
+    auto applierClient = getServiceContext()->makeClient("batchApplier");
+    AlternativeClientRegion acr(applierClient);
+    auto applierOpCtx = cc().makeOperationContext();
+
+    ASSERT_THROWS_CODE(MigrationDestinationManager::checkCloneForInterrupt(
+                           outerOpCtx, applierOpCtx.get(), false /* concurrentStream */),
+                       DBException,
+                       ErrorCodes::Interrupted);
+    MigrationDestinationManager::checkCloneForInterrupt(
+        outerOpCtx, applierOpCtx.get(), true /* concurrentStream */);
+}
+
 using MigrationDestinationManagerNetworkTest = CatalogCacheTestFixture;
 
 // Verifies MigrationDestinationManager::getCollectionOptions() and
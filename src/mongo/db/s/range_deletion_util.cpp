@@ -33,10 +33,14 @@
 #include <boost/optional.hpp>
 #include <utility>
 
+#include "mongo/bson/simple_bsonobj_comparator.h"
+#include "mongo/db/batched_delete_pacer.h"
+#include "mongo/db/catalog/collection_write_path.h"
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/client.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/dbhelpers.h"
+#include "mongo/db/exec/batched_delete_stage.h"
 #include "mongo/db/exec/delete_stage.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/index/index_descriptor.h"
@@ -47,7 +51,9 @@
 #include "mongo/db/query/plan_yield_policy.h"
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner.h"
+#include "mongo/db/record_id_helpers.h"
 #include "mongo/db/repl/repl_client_info.h"
+#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/wait_for_majority_service.h"
 #include "mongo/db/s/migration_util.h"
 #include "mongo/db/s/shard_key_index_util.h"
@@ -61,6 +67,7 @@
 #include "mongo/s/catalog/sharding_catalog_client.h"
 #include "mongo/util/cancellation.h"
 #include "mongo/util/future_util.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kShardingRangeDeleter
 
@@ -73,9 +80,40 @@ MONGO_FAIL_POINT_DEFINE(suspendRangeDeletion);
 MONGO_FAIL_POINT_DEFINE(throwWriteConflictExceptionInDeleteRange);
 MONGO_FAIL_POINT_DEFINE(throwInternalErrorInDeleteRange);
 
+/**
+ * Returns the pacing of batched range deletion. Each pass is followed by a delay that keeps the
+ * time spent deleting within rangeDeleterBatchedDeleteDutyCyclePercent, so that the longer the
+ * storage engine takes to absorb the deletions, the longer the range deleter stays off of it. The
+ * delay backs off while the majority commit point lags behind by more than
+ * rangeDeleterMaxReplicationLagSecs, more than rangeDeleterMaxDirtyCachePercent of the storage
+ * engine cache is dirty, or after the storage engine rejects a batch.
+ */
+BatchedDeletePacer::Options getBatchedRangeDeletionPacing() {
+    BatchedDeletePacer::Options options;
+    options.dutyCyclePercent = rangeDeleterBatchedDeleteDutyCyclePercent.load();
+    options.minDelay = Milliseconds(rangeDeleterBatchDelayMS.load());
+    options.maxReplicationLag = Seconds(rangeDeleterMaxReplicationLagSecs.load());
+    options.maxDirtyCachePercent = rangeDeleterMaxDirtyCachePercent.load();
+    return options;
+}
+
+/**
+ * Returns whether the documents of 'collection' in a range of the shard key 'keyPattern' may be
+ * removed by truncating the range of their RecordIds. This requires a clustered collection sharded
+ * on {_id: 1} with the simple collation, so that a chunk range maps to a single range of RecordIds.
+ */
+bool canTruncateChunkRange(OperationContext* opCtx,
+                           const CollectionPtr& collection,
+                           const BSONObj& keyPattern) {
+    return collection->isClustered() && !collection->getDefaultCollator() &&
+        SimpleBSONObjComparator::kInstance.evaluate(keyPattern == BSON("_id" << 1)) &&
+        collection_internal::canTruncateRange(opCtx, collection);
+}
+
 /**
  * Performs the deletion of up to numDocsToRemovePerBatch entries within the range in progress. Must
- * be called under the collection lock.
+ * be called under the collection lock. If 'useBatchedDeletes' is set, the entries are deleted
+ * through a single pass of batched deletes bounded by rangeDeleterBatchedDeletePassTimeMS.
  *
  * Returns the number of documents deleted, 0 if done with the range, or bad status if deleting
  * the range failed.
@@ -84,7 +122,8 @@ StatusWith<int> deleteNextBatch(OperationContext* opCtx,
                                 const CollectionPtr& collection,
                                 BSONObj const& keyPattern,
                                 ChunkRange const& range,
-                                int numDocsToRemovePerBatch) {
+                                int numDocsToRemovePerBatch,
+                                bool useBatchedDeletes) {
     invariant(collection);
 
     auto const nss = collection->ns();
@@ -119,16 +158,62 @@ StatusWith<int> deleteNextBatch(OperationContext* opCtx,
                 "max"_attr = max,
                 "namespace"_attr = nss.ns());
 
+    const auto checkFailPoints = [] {
+        if (throwWriteConflictExceptionInDeleteRange.shouldFail()) {
+            throwWriteConflictException();
+        }
+
+        if (throwInternalErrorInDeleteRange.shouldFail()) {
+            uasserted(ErrorCodes::InternalError, "Failing for test");
+        }
+    };
+
+    if (rangeDeleterTruncateClusteredCollections.load() && !serverGlobalParams.moveParanoia &&
+        canTruncateChunkRange(opCtx, collection, keyPattern)) {
+        if (MONGO_unlikely(hangBeforeDoingDeletion.shouldFail())) {
+            LOGV2(7470303, "Hit hangBeforeDoingDeletion failpoint");
+            hangBeforeDoingDeletion.pauseWhileSet(opCtx);
+        }
+
+        const auto minRecordId = record_id_helpers::keyForElem(range.getMin().firstElement());
+        const auto maxRecordId = record_id_helpers::keyForElem(range.getMax().firstElement());
+        const auto numDeleted = writeConflictRetry(opCtx, "rangeDeleterTruncate", nss.ns(), [&] {
+            checkFailPoints();
+
+            WriteUnitOfWork wuow(opCtx);
+            const auto numDeleted = collection_internal::truncateRange(opCtx,
+                                                                       collection,
+                                                                       minRecordId,
+                                                                       maxRecordId,
+                                                                       false /* includeMax */,
+                                                                       numDocsToRemovePerBatch,
+                                                                       true /* fromMigrate */);
+            wuow.commit();
+            return numDeleted;
+        });
+
+        ShardingStatistics::get(opCtx).countDocsDeletedOnDonor.addAndFetch(numDeleted);
+        return static_cast<int>(numDeleted);
+    }
+
     auto deleteStageParams = std::make_unique<DeleteStageParams>();
     deleteStageParams->fromMigrate = true;
     deleteStageParams->isMulti = true;
-    deleteStageParams->returnDeleted = true;
+    deleteStageParams->returnDeleted = !useBatchedDeletes;
 
     if (serverGlobalParams.moveParanoia) {
         deleteStageParams->removeSaver =
             std::make_unique<RemoveSaver>("moveChunk", nss.ns(), "cleaning");
     }
 
+    std::unique_ptr<BatchedDeleteStageParams> batchedDeleteParams;
+    if (useBatchedDeletes) {
+        batchedDeleteParams = std::make_unique<BatchedDeleteStageParams>();
+        batchedDeleteParams->targetPassDocs = numDocsToRemovePerBatch;
+        batchedDeleteParams->targetPassTimeMS =
+            Milliseconds(rangeDeleterBatchedDeletePassTimeMS.load());
+    }
+
     auto exec =
         InternalPlanner::deleteWithShardKeyIndexScan(opCtx,
                                                      &collection,
@@ -138,41 +223,54 @@ StatusWith<int> deleteNextBatch(OperationContext* opCtx,
                                                      max,
                                                      BoundInclusion::kIncludeStartKeyOnly,
                                                      PlanYieldPolicy::YieldPolicy::YIELD_AUTO,
-                                                     InternalPlanner::FORWARD);
+                                                     InternalPlanner::FORWARD,
+                                                     std::move(batchedDeleteParams));
 
     if (MONGO_unlikely(hangBeforeDoingDeletion.shouldFail())) {
         LOGV2(23768, "Hit hangBeforeDoingDeletion failpoint");
         hangBeforeDoingDeletion.pauseWhileSet(opCtx);
     }
 
+    const auto logCursorError = [&](const DBException& ex) {
+        auto&& explainer = exec->getPlanExplainer();
+        auto&& [stats, _] = explainer.getWinningPlanStats(ExplainOptions::Verbosity::kExecStats);
+        LOGV2_WARNING(23776,
+                      "Cursor error while trying to delete {min} to {max} in {namespace}, "
+                      "stats: {stats}, error: {error}",
+                      "Cursor error while trying to delete range",
+                      "min"_attr = redact(min),
+                      "max"_attr = redact(max),
+                      "namespace"_attr = nss,
+                      "stats"_attr = redact(stats),
+                      "error"_attr = redact(ex.toStatus()));
+    };
+
+    if (useBatchedDeletes) {
+        checkFailPoints();
+
+        long long numDeleted;
+        try {
+            numDeleted = exec->executeDelete();
+        } catch (const DBException& ex) {
+            logCursorError(ex);
+            throw;
+        }
+
+        ShardingStatistics::get(opCtx).countDocsDeletedOnDonor.addAndFetch(numDeleted);
+        return static_cast<int>(numDeleted);
+    }
+
     int numDeleted = 0;
     do {
         BSONObj deletedObj;
 
-        if (throwWriteConflictExceptionInDeleteRange.shouldFail()) {
-            throwWriteConflictException();
-        }
-
-        if (throwInternalErrorInDeleteRange.shouldFail()) {
-            uasserted(ErrorCodes::InternalError, "Failing for test");
-        }
+        checkFailPoints();
 
         PlanExecutor::ExecState state;
         try {
             state = exec->getNext(&deletedObj, nullptr);
         } catch (const DBException& ex) {
-            auto&& explainer = exec->getPlanExplainer();
-            auto&& [stats, _] =
-                explainer.getWinningPlanStats(ExplainOptions::Verbosity::kExecStats);
-            LOGV2_WARNING(23776,
-                          "Cursor error while trying to delete {min} to {max} in {namespace}, "
-                          "stats: {stats}, error: {error}",
-                          "Cursor error while trying to delete range",
-                          "min"_attr = redact(min),
-                          "max"_attr = redact(max),
-                          "namespace"_attr = nss,
-                          "stats"_attr = redact(stats),
-                          "error"_attr = redact(ex.toStatus()));
+            logCursorError(ex);
             throw;
         }
 
@@ -337,16 +435,26 @@ Status deleteRangeInBatches(OperationContext* opCtx,
                             const ChunkRange& range,
                             const UUID& migrationId) {
     bool allDocsRemoved = false;
+    BatchedDeletePacer pacer;
+    Milliseconds passTime(0);
+    Milliseconds delayBeforeRetry(0);
     // Delete all batches in this range unless a stepdown error occurs. Do not yield the
     // executor to ensure that this range is fully deleted before another range is
     // processed.
     while (!allDocsRemoved) {
         try {
+            if (delayBeforeRetry > Milliseconds(0)) {
+                opCtx->sleepFor(std::exchange(delayBeforeRetry, Milliseconds(0)));
+            }
+
             int numDocsToRemovePerBatch = rangeDeleterBatchSize.load();
             if (numDocsToRemovePerBatch <= 0) {
                 numDocsToRemovePerBatch = kRangeDeleterBatchSizeDefault;
             }
 
+            const bool useBatchedDeletes =
+                rangeDeleterUseBatchedDeletes.load() && !serverGlobalParams.moveParanoia;
+
             Milliseconds delayBetweenBatches(rangeDeleterBatchDelayMS.load());
 
             ensureRangeDeletionTaskStillExists(opCtx, migrationId);
@@ -354,6 +462,7 @@ Status deleteRangeInBatches(OperationContext* opCtx,
             markRangeDeletionTaskAsProcessing(opCtx, migrationId);
 
             int numDeleted;
+            Timer passTimer;
             const auto nss = [&]() {
                 try {
                     AutoGetCollection collection(
@@ -366,13 +475,15 @@ Status deleteRangeInBatches(OperationContext* opCtx,
                                 "collectionUUID"_attr = collectionUuid,
                                 "range"_attr = redact(range.toString()),
                                 "numDocsToRemovePerBatch"_attr = numDocsToRemovePerBatch,
-                                "delayBetweenBatches"_attr = delayBetweenBatches);
+                                "delayBetweenBatches"_attr = delayBetweenBatches,
+                                "useBatchedDeletes"_attr = useBatchedDeletes);
 
                     numDeleted = uassertStatusOK(deleteNextBatch(opCtx,
                                                                  collection.getCollection(),
                                                                  keyPattern,
                                                                  range,
-                                                                 numDocsToRemovePerBatch));
+                                                                 numDocsToRemovePerBatch,
+                                                                 useBatchedDeletes));
 
                     return collection.getNss();
                 } catch (const ExceptionFor<ErrorCodes::NamespaceNotFound>&) {
@@ -383,6 +494,7 @@ Status deleteRangeInBatches(OperationContext* opCtx,
                         "deletion task. No need to delete documents.");
                 }
             }();
+            passTime = Milliseconds(passTimer.millis());
 
             migrationutil::persistUpdatedNumOrphans(
                 opCtx, migrationId, collectionUuid, -numDeleted);
@@ -399,14 +511,28 @@ Status deleteRangeInBatches(OperationContext* opCtx,
                         "collectionUUID"_attr = collectionUuid,
                         "range"_attr = range.toString());
 
+            if (useBatchedDeletes) {
+                delayBetweenBatches =
+                    pacer.delayAfterBatch(opCtx, passTime, getBatchedRangeDeletionPacing());
+            }
+
             if (numDeleted > 0) {
                 // (SERVER-62368) The range-deleter executor is mono-threaded, so
                 // sleeping synchronously for `delayBetweenBatches` ensures that no
                 // other batch is going to be cleared up before the expected delay.
+                LOGV2_DEBUG(7351700,
+                            2,
+                            "Waiting before the next range deletion batch",
+                            "namespace"_attr = nss.ns(),
+                            "passTime"_attr = passTime,
+                            "delayBetweenBatches"_attr = delayBetweenBatches);
                 opCtx->sleepFor(delayBetweenBatches);
             }
 
-            allDocsRemoved = numDeleted < numDocsToRemovePerBatch;
+            // A batched deletion pass may stop short of numDocsToRemovePerBatch once it runs out of
+            // time, so only an empty pass indicates that the range is clear.
+            allDocsRemoved =
+                useBatchedDeletes ? numDeleted == 0 : numDeleted < numDocsToRemovePerBatch;
         } catch (const DBException& ex) {
             // Errors other than those indicating stepdown and those that indicate that the
             // range deletion can no longer occur should be retried.
@@ -419,6 +545,15 @@ Status deleteRangeInBatches(OperationContext* opCtx,
                 ErrorCodes::isNotPrimaryError(errorCode)) {
                 return ex.toStatus();
             };
+
+            // The storage engine rejecting a batch of deletions signals that it is under pressure,
+            // so let it catch up before retrying.
+            if (rangeDeleterUseBatchedDeletes.load() &&
+                (errorCode == ErrorCodes::WriteConflict ||
+                 errorCode == ErrorCodes::TemporarilyUnavailable)) {
+                delayBeforeRetry = pacer.delayAfterBatch(
+                    passTime, true /* underPressure */, getBatchedRangeDeletionPacing());
+            }
         }
     }
     return Status::OK();
@@ -41,6 +41,7 @@
 #include "mongo/db/s/shard_server_test_fixture.h"
 #include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/vector_clock.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/util/fail_point.h"
 
@@ -264,6 +265,42 @@ TEST_F(RangeDeleterTest,
     ASSERT_EQUALS(dbclient.count(kNss, BSONObj()), 0);
 }
 
+TEST_F(RangeDeleterTest, RemoveDocumentsInRangeWithBatchedDeletesRemovesOnlyDocumentsInRange) {
+    RAIIServerParameterControllerForTest useBatchedDeletes("rangeDeleterUseBatchedDeletes", true);
+    // Several passes are required to clear the range.
+    RAIIServerParameterControllerForTest batchSize("rangeDeleterBatchSize", 2);
+    RAIIServerParameterControllerForTest batchDelay("rangeDeleterBatchDelayMS", 0);
+
+    const ChunkRange range(BSON(kShardKey << 0), BSON(kShardKey << 10));
+    const auto numDocsToInsert = 5;
+    auto queriesComplete = SemiFuture<void>::makeReady();
+
+    setFilteringMetadataWithUUID(uuid());
+    auto task = insertRangeDeletionTask(_opCtx, uuid(), range, numDocsToInsert);
+    DBDirectClient dbclient(_opCtx);
+    for (auto i = 0; i < numDocsToInsert; ++i) {
+        dbclient.insert(kNss.toString(), BSON(kShardKey << i));
+    }
+    // Documents on both sides of the range.
+    dbclient.insert(kNss.toString(), BSON(kShardKey << -1));
+    dbclient.insert(kNss.toString(), BSON(kShardKey << 10));
+
+    auto cleanupComplete =
+        removeDocumentsInRange(executor(),
+                               std::move(queriesComplete),
+                               kNss,
+                               uuid(),
+                               kShardKeyPattern,
+                               range,
+                               task.getId(),
+                               Seconds(0) /* delayForActiveQueriesOnSecondariesToComplete*/);
+
+    cleanupComplete.get();
+    ASSERT_EQUALS(dbclient.count(kNss, BSONObj()), 2);
+    ASSERT_EQUALS(dbclient.count(kNss, BSON(kShardKey << -1)), 1);
+    ASSERT_EQUALS(dbclient.count(kNss, BSON(kShardKey << 10)), 1);
+}
+
 TEST_F(RangeDeleterTest,
        RemoveDocumentsInRangeDoesNotRemoveDocumentsWithKeysLowerThanMinKeyOfRange) {
     const auto numDocsToInsert = 3;
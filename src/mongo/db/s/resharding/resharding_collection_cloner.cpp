@@ -32,6 +32,7 @@
 
 #include "mongo/db/s/resharding/resharding_collection_cloner.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "mongo/bson/json.h"
@@ -40,6 +41,8 @@
 #include "mongo/db/client.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/exec/document_value/value_comparator.h"
+#include "mongo/db/persistent_task_store.h"
 #include "mongo/db/pipeline/aggregation_request_helper.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_replace_root.h"
@@ -47,6 +50,7 @@
 #include "mongo/db/query/query_request_helper.h"
 #include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/s/resharding/document_source_resharding_ownership_match.h"
+#include "mongo/db/s/resharding/resharding_collection_cloner_progress_gen.h"
 #include "mongo/db/s/resharding/resharding_data_copy_util.h"
 #include "mongo/db/s/resharding/resharding_future_util.h"
 #include "mongo/db/s/resharding/resharding_metrics.h"
@@ -67,6 +71,33 @@
 namespace mongo {
 namespace {
 
+using Doc = Document;
+using Arr = std::vector<Value>;
+using V = Value;
+
+// The number of _id values sampled from the collection being resharded for each range it is split
+// into when cloning it concurrently.
+constexpr int kSamplesPerRange = 100;
+
+/**
+ * Returns the $expr matching the documents with an _id in [minId, maxId), where a missing value
+ * leaves the range unbounded on that side, or a missing value if both are.
+ */
+Value makeIdRangeExpr(const Value& minId, const Value& maxId) {
+    Arr conditions;
+    if (!minId.missing()) {
+        conditions.emplace_back(Doc{{"$gte", Arr{V{"$_id"_sd}, V{Doc{{"$literal", minId}}}}}});
+    }
+    if (!maxId.missing()) {
+        conditions.emplace_back(Doc{{"$lt", Arr{V{"$_id"_sd}, V{Doc{{"$literal", maxId}}}}}});
+    }
+
+    if (conditions.empty()) {
+        return Value();
+    }
+    return conditions.size() == 1 ? conditions.front() : V{Doc{{"$and", std::move(conditions)}}};
+}
+
 bool collectionHasSimpleCollation(OperationContext* opCtx, const NamespaceString& nss) {
     auto catalogCache = Grid::get(opCtx)->catalogCache();
     auto sourceChunkMgr = uassertStatusOK(catalogCache->getCollectionRoutingInfo(opCtx, nss));
@@ -98,11 +129,8 @@ ReshardingCollectionCloner::ReshardingCollectionCloner(ReshardingMetrics* metric
 std::unique_ptr<Pipeline, PipelineDeleter> ReshardingCollectionCloner::makePipeline(
     OperationContext* opCtx,
     std::shared_ptr<MongoProcessInterface> mongoProcessInterface,
-    Value resumeId) {
-    using Doc = Document;
-    using Arr = std::vector<Value>;
-    using V = Value;
-
+    Value resumeId,
+    Value maxId) {
     // Assume that the input collection isn't a view. The collectionUUID parameter to
     // the aggregate would enforce this anyway.
     StringMap<ExpressionContext::ResolvedNamespace> resolvedNamespaces;
@@ -125,7 +153,8 @@ std::unique_ptr<Pipeline, PipelineDeleter> ReshardingCollectionCloner::makePipel
     // we choose to disallow automatic resuming for collections with non-simple default collations.
     uassert(4929303,
             "Cannot resume cloning when sharded collection has non-simple default collation",
-            resumeId.missing() || collectionHasSimpleCollation(opCtx, _sourceNss));
+            (resumeId.missing() && maxId.missing()) ||
+                collectionHasSimpleCollation(opCtx, _sourceNss));
 
     auto expCtx = make_intrusive<ExpressionContext>(opCtx,
                                                     boost::none, /* explain */
@@ -143,12 +172,9 @@ std::unique_ptr<Pipeline, PipelineDeleter> ReshardingCollectionCloner::makePipel
 
     Pipeline::SourceContainer stages;
 
-    if (!resumeId.missing()) {
-        stages.emplace_back(DocumentSourceMatch::create(
-            Doc{{"$expr",
-                 Doc{{"$gte", Arr{V{"$_id"_sd}, V{Doc{{"$literal", std::move(resumeId)}}}}}}}}
-                .toBson(),
-            expCtx));
+    if (auto idRangeExpr = makeIdRangeExpr(resumeId, maxId); !idRangeExpr.missing()) {
+        stages.emplace_back(
+            DocumentSourceMatch::create(Doc{{"$expr", std::move(idRangeExpr)}}.toBson(), expCtx));
     }
 
     stages.emplace_back(DocumentSourceReshardingOwnershipMatch::create(
@@ -215,14 +241,19 @@ std::unique_ptr<Pipeline, PipelineDeleter> ReshardingCollectionCloner::_targetAg
 }
 
 std::unique_ptr<Pipeline, PipelineDeleter> ReshardingCollectionCloner::_restartPipeline(
-    OperationContext* opCtx) {
+    OperationContext* opCtx, const Value& minId, const Value& maxId) {
     auto idToResumeFrom = [&] {
         AutoGetCollection outputColl(opCtx, _outputNss, MODE_IS);
         uassert(ErrorCodes::NamespaceNotFound,
                 str::stream() << "Resharding collection cloner's output collection '" << _outputNss
                               << "' did not already exist",
                 outputColl);
-        return resharding::data_copy::findHighestInsertedId(opCtx, *outputColl);
+
+        auto idRangeExpr = makeIdRangeExpr(minId, maxId);
+        return resharding::data_copy::findHighestInsertedId(
+            opCtx,
+            *outputColl,
+            idRangeExpr.missing() ? BSONObj() : Doc{{"$expr", std::move(idRangeExpr)}}.toBson());
     }();
 
     // The BlockingResultsMerger underlying by the $mergeCursors stage records how long the
@@ -233,7 +264,10 @@ std::unique_ptr<Pipeline, PipelineDeleter> ReshardingCollectionCloner::_restartP
     ON_BLOCK_EXIT([curOp] { curOp->done(); });
 
     auto pipeline = _targetAggregationRequest(
-        *makePipeline(opCtx, MongoProcessInterface::create(opCtx), idToResumeFrom));
+        *makePipeline(opCtx,
+                      MongoProcessInterface::create(opCtx),
+                      idToResumeFrom.missing() ? minId : idToResumeFrom,
+                      maxId));
 
     if (!idToResumeFrom.missing()) {
         // Skip inserting the first document retrieved after resuming because $gte was used in the
@@ -296,11 +330,190 @@ bool ReshardingCollectionCloner::doOneBatch(OperationContext* opCtx, Pipeline& p
     return true;
 }
 
+std::vector<Value> ReshardingCollectionCloner::_loadOrChooseSplitPoints(OperationContext* opCtx) {
+    PersistentTaskStore<ReshardingCollectionClonerProgress> store(
+        NamespaceString::kReshardingCollectionClonerProgressNamespace);
+
+    boost::optional<std::vector<Value>> recordedSplitPoints;
+    store.forEach(
+        opCtx,
+        BSON(ReshardingCollectionClonerProgress::kSourceUUIDFieldName << _sourceUUID),
+        [&](const auto& doc) {
+            recordedSplitPoints.emplace();
+            for (const auto& splitPoint : doc.getSplitPoints()) {
+                recordedSplitPoints->emplace_back(Value(splitPoint["_id"]));
+            }
+            return false;
+        });
+
+    if (recordedSplitPoints) {
+        return std::move(*recordedSplitPoints);
+    }
+
+    // Cloning a single range, which is what any previous attempt at cloning did if no split points
+    // were recorded, resumes after the highest _id inserted overall. The inserted documents
+    // therefore form a prefix of every range the collection may be split into now.
+    //
+    // Resuming after the highest _id inserted within a range relies on the collection being
+    // resharded having the simple collation.
+    const int numRanges = resharding::gReshardingCollectionClonerConcurrency.load();
+    if (numRanges <= 1 || !collectionHasSimpleCollation(opCtx, _sourceNss)) {
+        return {};
+    }
+
+    auto splitPoints = _sampleSplitPoints(opCtx, numRanges);
+
+    std::vector<BSONObj> splitPointDocs;
+    splitPointDocs.reserve(splitPoints.size());
+    for (const auto& splitPoint : splitPoints) {
+        splitPointDocs.emplace_back(Doc{{"_id", splitPoint}}.toBson());
+    }
+
+    store.add(opCtx,
+              ReshardingCollectionClonerProgress{_sourceUUID, std::move(splitPointDocs)},
+              WriteConcernOptions{1, WriteConcernOptions::SyncMode::UNSET, Seconds(0)});
+
+    LOGV2(7451700,
+          "Split the documents to clone into ranges of _id values cloned concurrently",
+          "sourceNamespace"_attr = _sourceNss,
+          "outputNamespace"_attr = _outputNss,
+          "numRanges"_attr = splitPoints.size() + 1);
+
+    return splitPoints;
+}
+
+std::vector<Value> ReshardingCollectionCloner::_sampleSplitPoints(OperationContext* opCtx,
+                                                                  int numRanges) {
+    StringMap<ExpressionContext::ResolvedNamespace> resolvedNamespaces;
+    resolvedNamespaces[_sourceNss.coll()] = {_sourceNss, std::vector<BSONObj>{}};
+
+    auto expCtx = make_intrusive<ExpressionContext>(opCtx,
+                                                    boost::none, /* explain */
+                                                    false,       /* fromMongos */
+                                                    false,       /* needsMerge */
+                                                    false,       /* allowDiskUse */
+                                                    false,       /* bypassDocumentValidation */
+                                                    false,       /* isMapReduceCommand */
+                                                    _sourceNss,
+                                                    boost::none, /* runtimeConstants */
+                                                    nullptr,     /* collator */
+                                                    MongoProcessInterface::create(opCtx),
+                                                    std::move(resolvedNamespaces),
+                                                    _sourceUUID);
+
+    AggregateCommandRequest request(
+        _sourceNss,
+        {BSON("$sample" << BSON("size" << numRanges * kSamplesPerRange)),
+         BSON("$project" << BSON("_id" << 1))});
+    request.setCollectionUUID(_sourceUUID);
+    request.setReadConcern(BSON(repl::ReadConcernArgs::kLevelFieldName
+                                << repl::readConcernLevels::kSnapshotName
+                                << repl::ReadConcernArgs::kAtClusterTimeFieldName
+                                << _atClusterTime));
+    auto readPref = ReadPreferenceSetting{ReadPreference::Nearest};
+    request.setUnwrappedReadPref(readPref.toContainingBSON());
+    ReadPreferenceSetting::get(opCtx) = readPref;
+
+    auto* curOp = CurOp::get(opCtx);
+    curOp->ensureStarted();
+    ON_BLOCK_EXIT([curOp] { curOp->done(); });
+
+    std::vector<Value> sampledIds;
+    shardVersionRetry(opCtx,
+                      Grid::get(opCtx)->catalogCache(),
+                      _sourceNss,
+                      "sampling _id values to split resharding collection cloning"_sd,
+                      [&] {
+                          sampledIds.clear();
+                          auto pipeline =
+                              sharded_agg_helpers::targetShardsAndAddMergeCursors(expCtx, request);
+                          while (auto doc = pipeline->getNext()) {
+                              sampledIds.emplace_back((*doc)["_id"]);
+                          }
+                      });
+
+    if (sampledIds.empty()) {
+        return {};
+    }
+
+    std::sort(sampledIds.begin(), sampledIds.end(), ValueComparator::kInstance.getLessThan());
+
+    std::vector<Value> splitPoints;
+    for (int i = 1; i < numRanges; ++i) {
+        auto& splitPoint = sampledIds[i * sampledIds.size() / numRanges];
+        if (splitPoint.missing() ||
+            (!splitPoints.empty() &&
+             ValueComparator::kInstance.evaluate(splitPoints.back() == splitPoint))) {
+            continue;
+        }
+        splitPoints.emplace_back(std::move(splitPoint));
+    }
+
+    return splitPoints;
+}
+
 SemiFuture<void> ReshardingCollectionCloner::run(
     std::shared_ptr<executor::TaskExecutor> executor,
     std::shared_ptr<executor::TaskExecutor> cleanupExecutor,
     CancellationToken cancelToken,
     CancelableOperationContextFactory factory) {
+    auto splitPoints = std::make_shared<std::vector<Value>>();
+
+    return resharding::WithAutomaticRetry([this, splitPoints, factory] {
+               auto opCtx = factory.makeOperationContext(&cc());
+               *splitPoints = _loadOrChooseSplitPoints(opCtx.get());
+           })
+        .onTransientError([this](const Status& status) {
+            LOGV2(7451701,
+                  "Transient error while splitting sharded collection cloning",
+                  "sourceNamespace"_attr = _sourceNss,
+                  "outputNamespace"_attr = _outputNss,
+                  "readTimestamp"_attr = _atClusterTime,
+                  "error"_attr = redact(status));
+        })
+        .onUnrecoverableError([this](const Status& status) {
+            LOGV2_ERROR(7451702,
+                        "Operation-fatal error for resharding while splitting sharded collection "
+                        "cloning",
+                        "sourceNamespace"_attr = _sourceNss,
+                        "outputNamespace"_attr = _outputNss,
+                        "readTimestamp"_attr = _atClusterTime,
+                        "error"_attr = redact(status));
+        })
+        .until<Status>([](const Status& status) { return status.isOK(); })
+        .on(executor, cancelToken)
+        .then([this, splitPoints, executor, cleanupExecutor, cancelToken, factory] {
+            CancellationSource cancelSource(cancelToken);
+
+            std::vector<SharedSemiFuture<void>> rangeFutures;
+            rangeFutures.reserve(splitPoints->size() + 1);
+
+            Value minId;
+            for (size_t i = 0; i <= splitPoints->size(); ++i) {
+                auto maxId = i < splitPoints->size() ? (*splitPoints)[i] : Value();
+                rangeFutures.emplace_back(_runOnRange(executor,
+                                                      cleanupExecutor,
+                                                      cancelSource.token(),
+                                                      factory,
+                                                      minId,
+                                                      maxId)
+                                              .share());
+                minId = std::move(maxId);
+            }
+
+            return resharding::cancelWhenAnyErrorThenQuiesce(
+                rangeFutures, executor, std::move(cancelSource));
+        })
+        .semi();
+}
+
+SemiFuture<void> ReshardingCollectionCloner::_runOnRange(
+    std::shared_ptr<executor::TaskExecutor> executor,
+    std::shared_ptr<executor::TaskExecutor> cleanupExecutor,
+    CancellationToken cancelToken,
+    CancelableOperationContextFactory factory,
+    Value minId,
+    Value maxId) {
     struct ChainContext {
         std::unique_ptr<Pipeline, PipelineDeleter> pipeline;
         bool moreToCome = true;
@@ -308,10 +521,10 @@ SemiFuture<void> ReshardingCollectionCloner::run(
 
     auto chainCtx = std::make_shared<ChainContext>();
 
-    return resharding::WithAutomaticRetry([this, chainCtx, factory] {
+    return resharding::WithAutomaticRetry([this, chainCtx, factory, minId, maxId] {
                if (!chainCtx->pipeline) {
                    auto opCtx = factory.makeOperationContext(&cc());
-                   chainCtx->pipeline = _restartPipeline(opCtx.get());
+                   chainCtx->pipeline = _restartPipeline(opCtx.get(), minId, maxId);
                }
 
                auto opCtx = factory.makeOperationContext(&cc());
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/cancelable_operation_context.h"
@@ -69,13 +70,21 @@ public:
                                Timestamp atClusterTime,
                                NamespaceString outputNss);
 
+    /**
+     * Returns the pipeline fetching the documents this shard will own with an _id greater than or
+     * equal to 'resumeId' and less than 'maxId', where a missing value leaves the range unbounded
+     * on that side.
+     */
     std::unique_ptr<Pipeline, PipelineDeleter> makePipeline(
         OperationContext* opCtx,
         std::shared_ptr<MongoProcessInterface> mongoProcessInterface,
-        Value resumeId = Value());
+        Value resumeId = Value(),
+        Value maxId = Value());
 
     /**
-     * Schedules work to repeatedly fetch and insert batches of documents.
+     * Schedules work to repeatedly fetch and insert batches of documents. The documents are split
+     * into reshardingCollectionClonerConcurrency ranges of _id values, each fetched and inserted
+     * concurrently with the others.
      *
      * Returns a future that becomes ready when either:
      *   (a) all documents have been fetched and inserted, or
@@ -97,7 +106,29 @@ public:
 private:
     std::unique_ptr<Pipeline, PipelineDeleter> _targetAggregationRequest(const Pipeline& pipeline);
 
-    std::unique_ptr<Pipeline, PipelineDeleter> _restartPipeline(OperationContext* opCtx);
+    std::unique_ptr<Pipeline, PipelineDeleter> _restartPipeline(OperationContext* opCtx,
+                                                                const Value& minId,
+                                                                const Value& maxId);
+
+    /**
+     * Returns the _id values which split the documents to clone into the ranges cloned
+     * concurrently. They are chosen by sampling the collection being resharded when cloning first
+     * starts, and recorded locally so that each range resumes after the highest _id inserted
+     * within it.
+     */
+    std::vector<Value> _loadOrChooseSplitPoints(OperationContext* opCtx);
+
+    std::vector<Value> _sampleSplitPoints(OperationContext* opCtx, int numRanges);
+
+    /**
+     * Fetches and inserts the documents with an _id in [minId, maxId).
+     */
+    SemiFuture<void> _runOnRange(std::shared_ptr<executor::TaskExecutor> executor,
+                                 std::shared_ptr<executor::TaskExecutor> cleanupExecutor,
+                                 CancellationToken cancelToken,
+                                 CancelableOperationContextFactory factory,
+                                 Value minId,
+                                 Value maxId);
 
     ReshardingMetrics* _metrics;
     const ShardKeyPattern _newShardKeyPattern;
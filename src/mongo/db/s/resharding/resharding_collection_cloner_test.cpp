@@ -82,7 +82,9 @@ protected:
         const ShardKeyPattern& newShardKeyPattern,
         const ShardId& recipientShard,
         const std::deque<DocumentSource::GetNextResult>& sourceCollectionData,
-        const std::deque<DocumentSource::GetNextResult>& configCacheChunksData) {
+        const std::deque<DocumentSource::GetNextResult>& configCacheChunksData,
+        Value minId = Value(),
+        Value maxId = Value()) {
         _metrics = ReshardingMetrics::makeInstance(_sourceUUID,
                                                    newShardKeyPattern.toBSON(),
                                                    _sourceNss,
@@ -102,8 +104,11 @@ protected:
         getCatalogCacheMock()->setChunkManagerReturnValue(
             createChunkManager(newShardKeyPattern, configCacheChunksData));
 
-        _pipeline = _cloner->makePipeline(
-            operationContext(), std::make_shared<MockMongoInterface>(configCacheChunksData));
+        _pipeline =
+            _cloner->makePipeline(operationContext(),
+                                  std::make_shared<MockMongoInterface>(configCacheChunksData),
+                                  std::move(minId),
+                                  std::move(maxId));
 
         _pipeline->addInitialSource(
             DocumentSourceMock::createForTest(sourceCollectionData, _pipeline->getContext()));
@@ -169,8 +174,15 @@ protected:
         std::deque<DocumentSource::GetNextResult> collectionData,
         std::deque<DocumentSource::GetNextResult> configData,
         int64_t expectedDocumentsCount,
-        std::function<void(std::unique_ptr<SeekableRecordCursor>)> verifyFunction) {
-        initializePipelineTest(shardKey, recipientShard, collectionData, configData);
+        std::function<void(std::unique_ptr<SeekableRecordCursor>)> verifyFunction,
+        Value minId = Value(),
+        Value maxId = Value()) {
+        initializePipelineTest(shardKey,
+                               recipientShard,
+                               collectionData,
+                               configData,
+                               std::move(minId),
+                               std::move(maxId));
         auto opCtx = operationContext();
         AutoGetCollection tempColl{opCtx, tempNss, MODE_IS};
         while (_cloner->doOneBatch(operationContext(), *_pipeline)) {
@@ -383,5 +395,39 @@ TEST_F(ReshardingCollectionClonerTest, CompoundHashedShardKey) {
                     verify);
 }
 
+TEST_F(ReshardingCollectionClonerTest, IdRange) {
+    ShardKeyPattern sk{fromjson("{x: 1}")};
+    std::deque<DocumentSource::GetNextResult> collectionData{
+        Doc(fromjson("{_id: 1, x: 1}")),
+        Doc(fromjson("{_id: 2, x: 2}")),
+        Doc(fromjson("{_id: 3, x: 3}")),
+        Doc(fromjson("{_id: 4, x: 4}")),
+        Doc(fromjson("{_id: 5, x: 5}")),
+        Doc(fromjson("{_id: 6, x: 6}"))};
+    std::deque<DocumentSource::GetNextResult> configData{
+        Doc(fromjson("{_id: {x: {$minKey: 1}}, max: {x: {$maxKey: 1}}, shard: 'myShardName'}"))};
+    constexpr auto kExpectedCopiedCount = 3;
+    const auto verify = [](auto cursor) {
+        for (int id = 2; id < 5; ++id) {
+            auto next = cursor->next();
+            ASSERT(next);
+            ASSERT_BSONOBJ_BINARY_EQ(
+                BSON("_id" << id << "x" << id << "$sortKey" << BSON_ARRAY(id)),
+                next->data.toBson());
+        }
+
+        ASSERT_FALSE(cursor->next());
+    };
+
+    runPipelineTest(std::move(sk),
+                    _myShardName,
+                    std::move(collectionData),
+                    std::move(configData),
+                    kExpectedCopiedCount,
+                    verify,
+                    Value(2) /* minId */,
+                    Value(5) /* maxId */);
+}
+
 }  // namespace
 }  // namespace mongo
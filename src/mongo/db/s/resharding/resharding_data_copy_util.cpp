@@ -35,20 +35,28 @@
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/dbhelpers.h"
+#include "mongo/db/index_builds_coordinator.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/persistent_task_store.h"
 #include "mongo/db/pipeline/pipeline.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/s/resharding/resharding_collection_cloner_progress_gen.h"
 #include "mongo/db/s/resharding/resharding_oplog_applier_progress_gen.h"
 #include "mongo/db/s/resharding/resharding_txn_cloner_progress_gen.h"
 #include "mongo/db/s/resharding/resharding_util.h"
 #include "mongo/db/s/session_catalog_migration.h"
 #include "mongo/db/session/session_catalog_mongod.h"
 #include "mongo/db/session/session_txn_record_gen.h"
+#include "mongo/db/storage/two_phase_index_build_knobs_gen.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/transaction/transaction_participant.h"
+#include "mongo/logv2/log.h"
 #include "mongo/logv2/redaction.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kResharding
 
 namespace mongo::resharding::data_copy {
 
@@ -96,6 +104,14 @@ void ensureOplogCollectionsDropped(OperationContext* opCtx,
                                    const UUID& reshardingUUID,
                                    const UUID& sourceUUID,
                                    const std::vector<DonorShardFetchTimestamp>& donorShards) {
+    // Remove the collection cloner progress doc.
+    PersistentTaskStore<ReshardingCollectionClonerProgress> collectionClonerProgressStore(
+        NamespaceString::kReshardingCollectionClonerProgressNamespace);
+    collectionClonerProgressStore.remove(
+        opCtx,
+        BSON(ReshardingCollectionClonerProgress::kSourceUUIDFieldName << sourceUUID),
+        WriteConcernOptions());
+
     for (const auto& donor : donorShards) {
         auto reshardingSourceId = ReshardingSourceId{reshardingUUID, donor.getShardId()};
 
@@ -160,8 +176,10 @@ void ensureTemporaryReshardingCollectionRenamed(OperationContext* opCtx,
         renameCollection(opCtx, metadata.getTempReshardingNss(), metadata.getSourceNss(), options));
 }
 
-Value findHighestInsertedId(OperationContext* opCtx, const CollectionPtr& collection) {
-    auto doc = findDocWithHighestInsertedId(opCtx, collection);
+Value findHighestInsertedId(OperationContext* opCtx,
+                            const CollectionPtr& collection,
+                            const BSONObj& filter) {
+    auto doc = findDocWithHighestInsertedId(opCtx, collection, filter);
     if (!doc) {
         return Value{};
     }
@@ -175,7 +193,8 @@ Value findHighestInsertedId(OperationContext* opCtx, const CollectionPtr& collec
 }
 
 boost::optional<Document> findDocWithHighestInsertedId(OperationContext* opCtx,
-                                                       const CollectionPtr& collection) {
+                                                       const CollectionPtr& collection,
+                                                       const BSONObj& filter) {
     // TODO SERVER-60824: Remove special handling for empty collections once non-blocking sort is
     // enabled on clustered collections.
     if (collection && collection->isEmpty(opCtx)) {
@@ -183,6 +202,7 @@ boost::optional<Document> findDocWithHighestInsertedId(OperationContext* opCtx,
     }
 
     auto findCommand = std::make_unique<FindCommandRequest>(collection->ns());
+    findCommand->setFilter(filter);
     findCommand->setLimit(1);
     findCommand->setSort(BSON("_id" << -1));
 
@@ -195,6 +215,67 @@ boost::optional<Document> findDocWithHighestInsertedId(OperationContext* opCtx,
     return Document{doc};
 }
 
+void ensureIndexesBuiltInBulk(OperationContext* opCtx,
+                              const NamespaceString& nss,
+                              const std::vector<BSONObj>& indexSpecs) {
+    invariant(!opCtx->lockState()->isLocked());
+    invariant(!opCtx->lockState()->inAWriteUnitOfWork());
+
+    const auto collectionUUID = [&] {
+        AutoGetCollection coll(opCtx, nss, MODE_IS);
+        uassert(ErrorCodes::NamespaceNotFound,
+                str::stream() << "Collection '" << nss << "' did not already exist",
+                coll);
+        return coll->uuid();
+    }();
+
+    // An index build started by a previous primary keeps running after a failover. Wait for it to
+    // finish, as the index build started below would otherwise skip its indexes without waiting.
+    auto indexBuildsCoord = IndexBuildsCoordinator::get(opCtx);
+    indexBuildsCoord->awaitNoIndexBuildInProgressForCollection(opCtx, collectionUUID);
+
+    // Build the indexes the same way as createIndexes does, so that secondaries build them
+    // concurrently with the primary rather than each replaying a build once it has committed.
+    auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    const auto protocol = !replCoord->isOplogDisabledFor(opCtx, nss)
+        ? IndexBuildProtocol::kTwoPhase
+        : IndexBuildProtocol::kSinglePhase;
+    IndexBuildsCoordinator::IndexBuildOptions indexBuildOptions;
+    if (protocol == IndexBuildProtocol::kTwoPhase) {
+        indexBuildOptions.commitQuorum = replCoord->isReplEnabled() && enableIndexBuildCommitQuorum
+            ? CommitQuorumOptions(CommitQuorumOptions::kVotingMembers)
+            : CommitQuorumOptions(CommitQuorumOptions::kDisabled);
+    }
+
+    const auto buildUUID = UUID::gen();
+    LOGV2(7451703,
+          "Building indexes in bulk",
+          "namespace"_attr = nss,
+          "buildUUID"_attr = buildUUID,
+          "indexes"_attr = indexSpecs);
+    Timer timer;
+
+    // Indexes which already exist are filtered out by the index build. If this node steps down,
+    // the index build keeps running and the next primary waits for it above. If the resharding
+    // operation is aborted instead, dropping the temporary resharding collection aborts it.
+    auto buildIndexFuture = uassertStatusOK(indexBuildsCoord->startIndexBuild(opCtx,
+                                                                              nss.db().toString(),
+                                                                              collectionUUID,
+                                                                              indexSpecs,
+                                                                              buildUUID,
+                                                                              protocol,
+                                                                              indexBuildOptions));
+    auto stats = buildIndexFuture.get(opCtx);
+
+    LOGV2(7451704,
+          "Finished building indexes in bulk",
+          "namespace"_attr = nss,
+          "buildUUID"_attr = buildUUID,
+          "numIndexesBefore"_attr = stats.numIndexesBefore,
+          "numIndexesAfter"_attr = stats.numIndexesAfter,
+          "duration"_attr = Milliseconds(timer.millis()));
+}
+
 std::vector<InsertStatement> fillBatchForInsert(Pipeline& pipeline, int batchSizeLimitBytes) {
     // The BlockingResultsMerger underlying by the $mergeCursors stage records how long the
     // recipient spent waiting for documents from the donor shards. It doing so requires the CurOp
@@ -70,8 +70,9 @@ void ensureCollectionDropped(OperationContext* opCtx,
                              const NamespaceString& nss,
                              const boost::optional<UUID>& uuid = boost::none);
 /**
- * Removes documents from the oplog applier progress and transaction applier progress collections
- * that are associated with an in-progress resharding operation. Also drops all oplog buffer
+ * Removes documents from the oplog applier progress, transaction applier progress and collection
+ * cloner progress collections that are associated with an in-progress resharding operation. Also
+ * drops all oplog buffer
  * collections and conflict stash collections that are associated with the in-progress resharding
  * operation.
  */
@@ -91,15 +92,32 @@ void ensureTemporaryReshardingCollectionRenamed(OperationContext* opCtx,
                                                 const CommonReshardingMetadata& metadata);
 
 /**
- * Returns the largest _id value in the collection.
+ * Returns the largest _id value in the collection, among the documents matching 'filter' if
+ * specified.
  */
-Value findHighestInsertedId(OperationContext* opCtx, const CollectionPtr& collection);
+Value findHighestInsertedId(OperationContext* opCtx,
+                            const CollectionPtr& collection,
+                            const BSONObj& filter = BSONObj());
 
 /**
- * Returns the full document of the largest _id value in the collection.
+ * Returns the full document of the largest _id value in the collection, among the documents
+ * matching 'filter' if specified.
  */
 boost::optional<Document> findDocWithHighestInsertedId(OperationContext* opCtx,
-                                                       const CollectionPtr& collection);
+                                                       const CollectionPtr& collection,
+                                                       const BSONObj& filter = BSONObj());
+
+/**
+ * Builds the indexes from 'indexSpecs' which don't already exist on the specified collection,
+ * through a single scan of the collection which sorts the keys of all indexes externally before
+ * bulk loading them. The indexes are built through the IndexBuildsCoordinator as a two-phase index
+ * build, like createIndexes does, and this function waits for the index build to commit.
+ *
+ * Throws NamespaceNotFound if the collection doesn't already exist.
+ */
+void ensureIndexesBuiltInBulk(OperationContext* opCtx,
+                              const NamespaceString& nss,
+                              const std::vector<BSONObj>& indexSpecs);
 
 /**
  * Returns a batch of documents suitable for being inserted with insertBatch().
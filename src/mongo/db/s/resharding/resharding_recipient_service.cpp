@@ -575,8 +575,13 @@ void ReshardingRecipientService::RecipientStateMachine::
     {
         auto opCtx = factory.makeOperationContext(&cc());
 
+        // The shard key index is built along with the other indexes once cloning is done if index
+        // builds are deferred.
+        const bool deferIndexBuilds =
+            resharding::gReshardingRecipientBuildIndexesAfterCloning.load();
+
         _externalState->ensureTempReshardingCollectionExistsWithIndexes(
-            opCtx.get(), _metadata, *_cloneTimestamp);
+            opCtx.get(), _metadata, *_cloneTimestamp, deferIndexBuilds);
 
         _externalState->withShardVersionRetry(
             opCtx.get(),
@@ -587,14 +592,9 @@ void ReshardingRecipientService::RecipientStateMachine::
                     opCtx.get(),
                     _metadata.getTempReshardingNss(),
                     ShardKeyPattern(_metadata.getReshardingKey()));
-                shardkeyutil::validateShardKeyIndexExistsOrCreateIfPossible(
-                    opCtx.get(),
-                    _metadata.getTempReshardingNss(),
-                    ShardKeyPattern{_metadata.getReshardingKey()},
-                    CollationSpec::kSimpleSpec,
-                    false /* unique */,
-                    true /* enforceUniquenessCheck */,
-                    shardkeyutil::ValidationBehaviorsShardCollection(opCtx.get()));
+                if (!deferIndexBuilds) {
+                    _validateShardKeyIndexExistsOrCreate(opCtx.get());
+                }
             });
 
         // We add a fake 'shardCollection' notification here so that the C2C replicator can sync the
@@ -710,9 +710,35 @@ ReshardingRecipientService::RecipientStateMachine::_cloneThenTransitionToApplyin
 
     return future_util::withCancellation(_dataReplication->awaitCloningDone(), abortToken)
         .thenRunOn(**executor)
+        .then([this, &factory] {
+            // Oplog application doesn't start writing to the temporary resharding collection until
+            // the transition to kApplying, so any index whose build was deferred can be built in
+            // bulk from the cloned documents until then.
+            auto opCtx = factory.makeOperationContext(&cc());
+            _externalState->ensureTempReshardingCollectionIndexesBuilt(
+                opCtx.get(), _metadata, *_cloneTimestamp);
+
+            _externalState->withShardVersionRetry(
+                opCtx.get(),
+                _metadata.getTempReshardingNss(),
+                "validating shard key index for reshardCollection"_sd,
+                [&] { _validateShardKeyIndexExistsOrCreate(opCtx.get()); });
+        })
         .then([this, &factory] { _transitionToApplying(factory); });
 }
 
+void ReshardingRecipientService::RecipientStateMachine::_validateShardKeyIndexExistsOrCreate(
+    OperationContext* opCtx) {
+    shardkeyutil::validateShardKeyIndexExistsOrCreateIfPossible(
+        opCtx,
+        _metadata.getTempReshardingNss(),
+        ShardKeyPattern{_metadata.getReshardingKey()},
+        CollationSpec::kSimpleSpec,
+        false /* unique */,
+        true /* enforceUniquenessCheck */,
+        shardkeyutil::ValidationBehaviorsShardCollection(opCtx));
+}
+
 ExecutorFuture<void> ReshardingRecipientService::RecipientStateMachine::
     _awaitAllDonorsBlockingWritesThenTransitionToStrictConsistency(
         const std::shared_ptr<executor::ScopedTaskExecutor>& executor,
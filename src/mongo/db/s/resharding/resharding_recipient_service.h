@@ -218,6 +218,8 @@ private:
         const CancellationToken& abortToken,
         const CancelableOperationContextFactory& factory);
 
+    void _validateShardKeyIndexExistsOrCreate(OperationContext* opCtx);
+
     ExecutorFuture<void> _awaitAllDonorsBlockingWritesThenTransitionToStrictConsistency(
         const std::shared_ptr<executor::ScopedTaskExecutor>& executor,
         const CancellationToken& abortToken,
@@ -30,6 +30,13 @@
 
 #include "mongo/db/s/resharding/resharding_recipient_service_external_state.h"
 
+#include <algorithm>
+
+#include "mongo/bson/simple_bsonelement_comparator.h"
+#include "mongo/client/dbclient_base.h"
+#include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/query/collation/collation_spec.h"
+#include "mongo/db/s/resharding/resharding_data_copy_util.h"
 #include "mongo/db/s/resharding/resharding_donor_recipient_common.h"
 #include "mongo/db/s/sharding_state.h"
 #include "mongo/db/write_concern_options.h"
@@ -48,12 +55,26 @@ namespace mongo {
 namespace {
 const WriteConcernOptions kMajorityWriteConcern{
     WriteConcernOptions::kMajority, WriteConcernOptions::SyncMode::UNSET, Seconds(0)};
+
+/**
+ * Returns whether the index 'spec' can serve as the index on 'shardKeyPattern', following the same
+ * rules as shardkeyutil::validShardKeyIndexExists().
+ */
+bool isUsefulShardKeyIndex(const BSONObj& spec, const BSONObj& shardKeyPattern) {
+    return !spec[IndexDescriptor::kSparseFieldName].trueValue() &&
+        spec[IndexDescriptor::kPartialFilterExprFieldName].eoo() &&
+        spec[IndexDescriptor::kCollationFieldName].eoo() &&
+        shardKeyPattern.isPrefixOf(spec[IndexDescriptor::kKeyPatternFieldName].Obj(),
+                                   SimpleBSONElementComparator::kInstance);
 }
 
+}  // namespace
+
 void ReshardingRecipientService::RecipientStateMachineExternalState::
     ensureTempReshardingCollectionExistsWithIndexes(OperationContext* opCtx,
                                                     const CommonReshardingMetadata& metadata,
-                                                    Timestamp cloneTimestamp) {
+                                                    Timestamp cloneTimestamp,
+                                                    bool deferIndexBuilds) {
     LOGV2_DEBUG(5002300,
                 1,
                 "Creating temporary resharding collection",
@@ -77,6 +98,10 @@ void ReshardingRecipientService::RecipientStateMachineExternalState::
                              cloneTimestamp,
                              "loading indexes to create temporary resharding collection"_sd);
 
+    if (deferIndexBuilds) {
+        indexes.clear();
+    }
+
     // Set the temporary resharding collection's UUID to the resharding UUID. Note that
     // BSONObj::addFields() replaces any fields that already exist.
     collOptions = collOptions.addFields(BSON("uuid" << metadata.getReshardingUUID()));
@@ -93,6 +118,36 @@ void ReshardingRecipientService::RecipientStateMachineExternalState::
         ->clearFilteringMetadata(opCtx);
 }
 
+void ReshardingRecipientService::RecipientStateMachineExternalState::
+    ensureTempReshardingCollectionIndexesBuilt(OperationContext* opCtx,
+                                               const CommonReshardingMetadata& metadata,
+                                               Timestamp cloneTimestamp) {
+    auto [indexes, idIndex] =
+        getCollectionIndexes(opCtx,
+                             metadata.getSourceNss(),
+                             metadata.getSourceUUID(),
+                             cloneTimestamp,
+                             "loading indexes to build on temporary resharding collection"_sd);
+
+    const auto& shardKeyPattern = metadata.getReshardingKey().toBSON();
+    if (std::none_of(indexes.begin(), indexes.end(), [&](const BSONObj& spec) {
+            return isUsefulShardKeyIndex(spec, shardKeyPattern);
+        })) {
+        // The collection may have a non-simple default collation, which the shard key index must
+        // not inherit.
+        indexes.push_back(BSON(IndexDescriptor::kIndexVersionFieldName
+                               << static_cast<int>(IndexDescriptor::IndexVersion::kV2)
+                               << IndexDescriptor::kKeyPatternFieldName << shardKeyPattern
+                               << IndexDescriptor::kIndexNameFieldName
+                               << DBClientBase::genIndexName(shardKeyPattern)
+                               << IndexDescriptor::kCollationFieldName
+                               << CollationSpec::kSimpleSpec));
+    }
+
+    resharding::data_copy::ensureIndexesBuiltInBulk(
+        opCtx, metadata.getTempReshardingNss(), indexes);
+}
+
 template <typename Callable>
 auto RecipientStateMachineExternalStateImpl::_withShardVersionRetry(OperationContext* opCtx,
                                                                     const NamespaceString& nss,
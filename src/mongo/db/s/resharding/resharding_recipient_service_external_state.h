@@ -100,11 +100,24 @@ public:
      * The collection options are taken from the primary shard for the source database and the
      * collection indexes are taken from the shard which owns the global minimum chunk.
      *
-     * This function won't automatically create an index on the new shard key pattern.
+     * This function won't automatically create an index on the new shard key pattern. If
+     * 'deferIndexBuilds' is true, the collection is created with only its _id index and the other
+     * indexes are left to ensureTempReshardingCollectionIndexesBuilt().
      */
     void ensureTempReshardingCollectionExistsWithIndexes(OperationContext* opCtx,
                                                          const CommonReshardingMetadata& metadata,
-                                                         Timestamp cloneTimestamp);
+                                                         Timestamp cloneTimestamp,
+                                                         bool deferIndexBuilds);
+
+    /**
+     * Builds the indexes of the source collection which the temporary resharding collection is
+     * missing, in bulk from the documents cloned into it. Unless one of them already starts with
+     * the new shard key pattern, an index on the new shard key pattern is built along with them, as
+     * it can no longer be created on its own once the collection holds the cloned documents.
+     */
+    void ensureTempReshardingCollectionIndexesBuilt(OperationContext* opCtx,
+                                                    const CommonReshardingMetadata& metadata,
+                                                    Timestamp cloneTimestamp);
 };
 
 class RecipientStateMachineExternalStateImpl
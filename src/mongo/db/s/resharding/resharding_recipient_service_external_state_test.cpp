@@ -246,10 +246,10 @@ public:
         ASSERT_EQ(indexesCopy.size(), 0);
     }
 
-    void verifyTempReshardingCollectionAndMetadata() {
+    void verifyTempReshardingCollectionAndMetadata(bool deferIndexBuilds = false) {
         RecipientStateMachineExternalStateImpl externalState;
         externalState.ensureTempReshardingCollectionExistsWithIndexes(
-            operationContext(), kMetadata, kDefaultFetchTimestamp);
+            operationContext(), kMetadata, kDefaultFetchTimestamp, deferIndexBuilds);
         CollectionShardingRuntime csr(getServiceContext(), kOrigNss, executor());
         ASSERT(csr.getCurrentMetadataIfKnown() == boost::none);
     }
@@ -329,6 +329,76 @@ TEST_F(RecipientServiceExternalStateTest, CreateLocalReshardingCollectionBasic)
     verifyCollectionAndIndexes(kReshardingNss, kReshardingUUID, indexes);
 }
 
+TEST_F(RecipientServiceExternalStateTest, CreateLocalReshardingCollectionDeferringIndexBuilds) {
+    auto shards = setupNShards(2);
+
+    loadRoutingTableWithTwoChunksAndTwoShardsImpl(kOrigNss,
+                                                  kShardKey.toBSON(),
+                                                  boost::optional<std::string>("1"),
+                                                  kOrigUUID,
+                                                  kOrigEpoch,
+                                                  kOrigTimestamp);
+
+    // Simulate a refresh for the temporary resharding collection.
+    loadOneChunkMetadataForTemporaryReshardingColl(kReshardingNss,
+                                                   kOrigNss,
+                                                   kReshardingKey,
+                                                   kReshardingUUID,
+                                                   kReshardingEpoch,
+                                                   kReshardingTimestamp);
+
+    const BSONObj idIndex = BSON("v" << 2 << "key" << BSON("_id" << 1) << "name"
+                                     << "_id_");
+    const std::vector<BSONObj> indexes = {idIndex,
+                                          BSON("v" << 2 << "key" << BSON("a" << 1) << "name"
+                                                   << "indexOne"),
+                                          BSON("v" << 2 << "key" << BSON("b" << 1) << "name"
+                                                   << "indexTwo"
+                                                   << "unique" << true)};
+    auto future = launchAsync([&] {
+        expectRefreshReturnForOriginalColl(
+            kOrigNss, kShardKey, kOrigUUID, kOrigEpoch, kOrigTimestamp);
+        expectListCollections(
+            kOrigNss,
+            kOrigUUID,
+            {BSON("name" << kOrigNss.coll() << "options" << BSONObj() << "info"
+                         << BSON("readOnly" << false << "uuid" << kOrigUUID) << "idIndex"
+                         << idIndex)},
+            HostAndPort(shards[1].getHost()));
+        expectListIndexes(kOrigNss, kOrigUUID, indexes, HostAndPort(shards[0].getHost()));
+    });
+
+    verifyTempReshardingCollectionAndMetadata(true /* deferIndexBuilds */);
+
+    future.default_timed_get();
+
+    // Only the _id index is maintained while documents are cloned.
+    verifyCollectionAndIndexes(kReshardingNss, kReshardingUUID, {idIndex});
+
+    DBDirectClient client(operationContext());
+    for (int i = 0; i < 10; ++i) {
+        client.insert(kReshardingNss.ns(), BSON("_id" << i << "a" << i % 2 << "b" << i));
+    }
+
+    future = launchAsync([&] {
+        expectListIndexes(kOrigNss, kOrigUUID, indexes, HostAndPort(shards[0].getHost()));
+    });
+
+    RecipientStateMachineExternalStateImpl externalState;
+    externalState.ensureTempReshardingCollectionIndexesBuilt(
+        operationContext(), kMetadata, kDefaultFetchTimestamp);
+
+    future.default_timed_get();
+
+    // The index on the new shard key is built along with the indexes of the source collection.
+    auto expectedIndexes = indexes;
+    expectedIndexes.push_back(BSON("v" << 2 << "key" << BSON("newKey" << 1) << "name"
+                                       << "newKey_1"));
+    verifyCollectionAndIndexes(kReshardingNss, kReshardingUUID, expectedIndexes);
+    ASSERT_EQ(client.count(kReshardingNss, BSON("a" << 1)), 5);
+    ASSERT_EQ(client.count(kReshardingNss, BSON("b" << BSON("$gte" << 5))), 5);
+}
+
 TEST_F(RecipientServiceExternalStateTest,
        CreatingLocalReshardingCollectionRetriesOnStaleVersionErrors) {
     auto shards = setupNShards(2);
@@ -161,8 +161,9 @@ void onConfigDeleteInvalidateCachedCollectionMetadataAndNotify(OperationContext*
 
 /**
  * If the collection is sharded, finds the chunk that contains the specified document and increments
- * the size tracked for that chunk by the specified amount of data written, in bytes. Returns the
- * number of total bytes on that chunk after the data is written.
+ * the size tracked for that chunk by the specified amount of data written, in bytes. Unless the
+ * write comes from a migration, also counts it towards the load of the chunk reported to the
+ * balancer.
  */
 void incrementChunkOnInsertOrUpdate(OperationContext* opCtx,
                                     const NamespaceString& nss,
@@ -184,6 +185,8 @@ void incrementChunkOnInsertOrUpdate(OperationContext* opCtx,
     // Don't trigger chunk splits from inserts happening due to migration since
     // we don't necessarily own that chunk yet
     if (!fromMigrate) {
+        chunkWritesTracker->addOperation();
+
         const auto balancerConfig = Grid::get(opCtx)->getBalancerConfiguration();
 
         const uint64_t maxChunkSizeBytes = [&] {
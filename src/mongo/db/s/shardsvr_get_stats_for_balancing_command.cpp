@@ -32,8 +32,10 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/s/balancer_stats_registry.h"
+#include "mongo/db/s/collection_sharding_runtime.h"
 #include "mongo/db/s/sharding_state.h"
 #include "mongo/logv2/log.h"
+#include "mongo/s/chunk_writes_tracker.h"
 #include "mongo/s/grid.h"
 #include "mongo/s/request_types/get_stats_for_balancing_gen.h"
 #include "mongo/s/sharding_feature_flags_gen.h"
@@ -89,7 +91,11 @@ public:
             for (const auto& nsWithOptUUID : request().getCollections()) {
                 const auto collDataSizeScaled = static_cast<long long>(
                     _getCollDataSizeBytes(opCtx, nsWithOptUUID) / scaleFactor);
-                collStats.emplace_back(nsWithOptUUID.getNs(), collDataSizeScaled);
+                CollStatsForBalancing stats(nsWithOptUUID.getNs(), collDataSizeScaled);
+                if (request().getIncludeRangeLoad()) {
+                    stats.setRangeLoad(_getRangeLoad(opCtx, nsWithOptUUID));
+                }
+                collStats.push_back(std::move(stats));
             }
             return {std::move(collStats)};
         }
@@ -138,6 +144,46 @@ public:
             return avgObjSizeBytes * (numRecords - numOrphanDocs);
         }
 
+        /**
+         * Returns the number of write operations which targeted each of the ranges owned by this
+         * shard since the previous time their load was reported, and resets it.
+         */
+        std::vector<RangeLoadForBalancing> _getRangeLoad(
+            OperationContext* opCtx, const NamespaceWithOptionalUUID& nsWithOptUUID) const {
+            const auto& ns = nsWithOptUUID.getNs();
+
+            AutoGetCollection autoColl(opCtx, ns, MODE_IS);
+            if (!autoColl) {
+                return {};
+            }
+            if (auto wantedCollUUID = nsWithOptUUID.getUUID()) {
+                if (wantedCollUUID != autoColl->uuid()) {
+                    return {};
+                }
+            }
+
+            const auto metadata =
+                CollectionShardingRuntime::get(opCtx, ns)->getCurrentMetadataIfKnown();
+            if (!metadata || !metadata->isSharded()) {
+                return {};
+            }
+
+            const auto thisShardId = ShardingState::get(opCtx)->shardId();
+            std::vector<RangeLoadForBalancing> rangeLoad;
+            metadata->getChunkManager()->forEachChunk([&](const Chunk& chunk) {
+                if (chunk.getShardId() != thisShardId) {
+                    return true;
+                }
+
+                if (const auto numOps = chunk.getWritesTracker()->clearNumOperations()) {
+                    rangeLoad.emplace_back(
+                        chunk.getMin(), chunk.getMax(), static_cast<long long>(numOps));
+                }
+                return true;
+            });
+            return rangeLoad;
+        }
+
         NamespaceString ns() const override {
             return {request().getDbName(), ""};
         }
@@ -45,50 +45,59 @@ namespace mongo {
 
 namespace {
 using namespace fmt::literals;
+
+// Network counters restart from zero once a stripe exceeds this many bytes.
+constexpr long long kMaxNetworkCount = 1LL << 60;
+
+void hitNetworkCounter(StripedCounter& counter, long long bytes) {
+    if (counter.fetchAndAddOnStripe(bytes) > kMaxNetworkCount) {
+        counter.reset();
+    }
 }
+}  // namespace
 
-void OpCounters::_checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*counter, int n) {
+void OpCounters::_checkWrap(StripedCounter OpCounters::*counter, int n) {
     static constexpr auto maxCount = 1LL << 60;
-    auto oldValue = (this->*counter)->fetchAndAddRelaxed(n);
+    auto oldValue = (this->*counter).fetchAndAddOnStripe(n);
     if (oldValue > maxCount) {
-        _insert->store(0);
-        _query->store(0);
-        _update->store(0);
-        _delete->store(0);
-        _getmore->store(0);
-        _command->store(0);
-
-        _queryDeprecated->store(0);
-
-        _insertOnExistingDoc->store(0);
-        _updateOnMissingDoc->store(0);
-        _deleteWasEmpty->store(0);
-        _deleteFromMissingNamespace->store(0);
-        _acceptableErrorInCommand->store(0);
+        _insert.reset();
+        _query.reset();
+        _update.reset();
+        _delete.reset();
+        _getmore.reset();
+        _command.reset();
+
+        _queryDeprecated.reset();
+
+        _insertOnExistingDoc.reset();
+        _updateOnMissingDoc.reset();
+        _deleteWasEmpty.reset();
+        _deleteFromMissingNamespace.reset();
+        _acceptableErrorInCommand.reset();
     }
 }
 
 BSONObj OpCounters::getObj() const {
     BSONObjBuilder b;
-    b.append("insert", _insert->loadRelaxed());
-    b.append("query", _query->loadRelaxed());
-    b.append("update", _update->loadRelaxed());
-    b.append("delete", _delete->loadRelaxed());
-    b.append("getmore", _getmore->loadRelaxed());
-    b.append("command", _command->loadRelaxed());
-
-    auto queryDep = _queryDeprecated->loadRelaxed();
+    b.append("insert", _insert.load());
+    b.append("query", _query.load());
+    b.append("update", _update.load());
+    b.append("delete", _delete.load());
+    b.append("getmore", _getmore.load());
+    b.append("command", _command.load());
+
+    auto queryDep = _queryDeprecated.load();
     if (queryDep > 0) {
         BSONObjBuilder d(b.subobjStart("deprecated"));
         d.append("query", queryDep);
     }
 
     // Append counters for constraint relaxations, only if they exist.
-    auto insertOnExistingDoc = _insertOnExistingDoc->loadRelaxed();
-    auto updateOnMissingDoc = _updateOnMissingDoc->loadRelaxed();
-    auto deleteWasEmpty = _deleteWasEmpty->loadRelaxed();
-    auto deleteFromMissingNamespace = _deleteFromMissingNamespace->loadRelaxed();
-    auto acceptableErrorInCommand = _acceptableErrorInCommand->loadRelaxed();
+    auto insertOnExistingDoc = _insertOnExistingDoc.load();
+    auto updateOnMissingDoc = _updateOnMissingDoc.load();
+    auto deleteWasEmpty = _deleteWasEmpty.load();
+    auto deleteFromMissingNamespace = _deleteFromMissingNamespace.load();
+    auto acceptableErrorInCommand = _acceptableErrorInCommand.load();
     auto totalRelaxed = insertOnExistingDoc + updateOnMissingDoc + deleteWasEmpty +
         deleteFromMissingNamespace + acceptableErrorInCommand;
 
@@ -105,82 +114,58 @@ BSONObj OpCounters::getObj() const {
 }
 
 void NetworkCounter::hitPhysicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
-    // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesIn->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesIn->store(bytes);
-    } else {
-        _physicalBytesIn->fetchAndAdd(bytes);
-    }
+    hitNetworkCounter(_physicalBytesIn, bytes);
 }
 
 void NetworkCounter::hitPhysicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
-    // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesOut->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesOut->store(bytes);
-    } else {
-        _physicalBytesOut->fetchAndAdd(bytes);
-    }
+    hitNetworkCounter(_physicalBytesOut, bytes);
 }
 
 void NetworkCounter::hitLogicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
-    // don't care about the race as its just a counter
-    const bool overflow = _together->logicalBytesIn.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _together->logicalBytesIn.store(bytes);
-        // The requests field only gets incremented here (and not in hitPhysical) because the
-        // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
-        // functions would double-count the number of operations.
-        _together->requests.store(1);
-    } else {
-        _together->logicalBytesIn.fetchAndAdd(bytes);
-        _together->requests.fetchAndAdd(1);
+    auto& together = _together.forCurrentThread();
+    // The requests field only gets incremented here (and not in hitPhysical) because the
+    // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
+    // functions would double-count the number of operations.
+    together.requests.fetchAndAddRelaxed(1);
+    if (together.logicalBytesIn.fetchAndAddRelaxed(bytes) > kMaxNetworkCount) {
+        _together.forEach([](Together& stripe) {
+            stripe.logicalBytesIn.store(0);
+            stripe.requests.store(0);
+        });
     }
 }
 
 void NetworkCounter::hitLogicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
-    // don't care about the race as its just a counter
-    const bool overflow = _logicalBytesOut->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _logicalBytesOut->store(bytes);
-    } else {
-        _logicalBytesOut->fetchAndAdd(bytes);
-    }
+    hitNetworkCounter(_logicalBytesOut, bytes);
 }
 
 void NetworkCounter::incrementNumSlowDNSOperations() {
-    _numSlowDNSOperations->fetchAndAdd(1);
+    _numSlowDNSOperations.increment();
 }
 
 void NetworkCounter::incrementNumSlowSSLOperations() {
-    _numSlowSSLOperations->fetchAndAdd(1);
+    _numSlowSSLOperations.increment();
 }
 
 void NetworkCounter::acceptedTFOIngress() {
-    _tfoAccepted->fetchAndAddRelaxed(1);
+    _tfoAccepted.increment();
 }
 
 void NetworkCounter::append(BSONObjBuilder& b) {
-    b.append("bytesIn", static_cast<long long>(_together->logicalBytesIn.loadRelaxed()));
-    b.append("bytesOut", static_cast<long long>(_logicalBytesOut->loadRelaxed()));
-    b.append("physicalBytesIn", static_cast<long long>(_physicalBytesIn->loadRelaxed()));
-    b.append("physicalBytesOut", static_cast<long long>(_physicalBytesOut->loadRelaxed()));
-    b.append("numSlowDNSOperations", static_cast<long long>(_numSlowDNSOperations->loadRelaxed()));
-    b.append("numSlowSSLOperations", static_cast<long long>(_numSlowSSLOperations->loadRelaxed()));
-    b.append("numRequests", static_cast<long long>(_together->requests.loadRelaxed()));
+    long long logicalBytesIn = 0;
+    long long requests = 0;
+    _together.forEach([&](const Together& stripe) {
+        logicalBytesIn += stripe.logicalBytesIn.loadRelaxed();
+        requests += stripe.requests.loadRelaxed();
+    });
+
+    b.append("bytesIn", logicalBytesIn);
+    b.append("bytesOut", _logicalBytesOut.load());
+    b.append("physicalBytesIn", _physicalBytesIn.load());
+    b.append("physicalBytesOut", _physicalBytesOut.load());
+    b.append("numSlowDNSOperations", _numSlowDNSOperations.load());
+    b.append("numSlowSSLOperations", _numSlowSSLOperations.load());
+    b.append("numRequests", requests);
 
     BSONObjBuilder tfo;
 #ifdef __linux__
@@ -188,7 +173,7 @@ void NetworkCounter::append(BSONObjBuilder& b) {
 #endif
     tfo.append("serverSupported", _tfoKernelSupportServer);
     tfo.append("clientSupported", _tfoKernelSupportClient);
-    tfo.append("accepted", _tfoAccepted->loadRelaxed());
+    tfo.append("accepted", _tfoAccepted.load());
     b.append("tcpFastOpen", tfo.obj());
 }
 
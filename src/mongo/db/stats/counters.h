@@ -37,16 +37,17 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/basic.h"
 #include "mongo/rpc/message.h"
-#include "mongo/util/aligned.h"
 #include "mongo/util/concurrency/spin_lock.h"
 #include "mongo/util/processinfo.h"
 #include "mongo/util/string_map.h"
+#include "mongo/util/striped_counter.h"
 
 namespace mongo {
 
 /**
  * for storing operation counters
- * note: not thread safe.  ok with that for speed
+ * The counters are striped across threads, so that concurrent operations do not all increment the
+ * same cache line.
  */
 class OpCounters {
 public:
@@ -99,59 +100,59 @@ public:
     }
 
     // thse are used by metrics things, do not remove
-    const AtomicWord<long long>* getInsert() const {
-        return &*_insert;
+    const StripedCounter* getInsert() const {
+        return &_insert;
     }
-    const AtomicWord<long long>* getQuery() const {
-        return &*_query;
+    const StripedCounter* getQuery() const {
+        return &_query;
     }
-    const AtomicWord<long long>* getUpdate() const {
-        return &*_update;
+    const StripedCounter* getUpdate() const {
+        return &_update;
     }
-    const AtomicWord<long long>* getDelete() const {
-        return &*_delete;
+    const StripedCounter* getDelete() const {
+        return &_delete;
     }
-    const AtomicWord<long long>* getGetMore() const {
-        return &*_getmore;
+    const StripedCounter* getGetMore() const {
+        return &_getmore;
     }
-    const AtomicWord<long long>* getCommand() const {
-        return &*_command;
+    const StripedCounter* getCommand() const {
+        return &_command;
     }
-    const AtomicWord<long long>* getInsertOnExistingDoc() const {
-        return &*_insertOnExistingDoc;
+    const StripedCounter* getInsertOnExistingDoc() const {
+        return &_insertOnExistingDoc;
     }
-    const AtomicWord<long long>* getUpdateOnMissingDoc() const {
-        return &*_updateOnMissingDoc;
+    const StripedCounter* getUpdateOnMissingDoc() const {
+        return &_updateOnMissingDoc;
     }
-    const AtomicWord<long long>* getDeleteWasEmpty() const {
-        return &*_deleteWasEmpty;
+    const StripedCounter* getDeleteWasEmpty() const {
+        return &_deleteWasEmpty;
     }
-    const AtomicWord<long long>* getDeleteFromMissingNamespace() const {
-        return &*_deleteFromMissingNamespace;
+    const StripedCounter* getDeleteFromMissingNamespace() const {
+        return &_deleteFromMissingNamespace;
     }
-    const AtomicWord<long long>* getAcceptableErrorInCommand() const {
-        return &*_acceptableErrorInCommand;
+    const StripedCounter* getAcceptableErrorInCommand() const {
+        return &_acceptableErrorInCommand;
     }
 
 private:
-    // Increment member `counter` by `n`, resetting all counters if it was > 2^60.
-    void _checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*counter, int n);
-
-    CacheExclusive<AtomicWord<long long>> _insert;
-    CacheExclusive<AtomicWord<long long>> _query;
-    CacheExclusive<AtomicWord<long long>> _update;
-    CacheExclusive<AtomicWord<long long>> _delete;
-    CacheExclusive<AtomicWord<long long>> _getmore;
-    CacheExclusive<AtomicWord<long long>> _command;
-
-    CacheExclusive<AtomicWord<long long>> _insertOnExistingDoc;
-    CacheExclusive<AtomicWord<long long>> _updateOnMissingDoc;
-    CacheExclusive<AtomicWord<long long>> _deleteWasEmpty;
-    CacheExclusive<AtomicWord<long long>> _deleteFromMissingNamespace;
-    CacheExclusive<AtomicWord<long long>> _acceptableErrorInCommand;
+    // Increment member `counter` by `n`, resetting all counters if its stripe was > 2^60.
+    void _checkWrap(StripedCounter OpCounters::*counter, int n);
+
+    StripedCounter _insert;
+    StripedCounter _query;
+    StripedCounter _update;
+    StripedCounter _delete;
+    StripedCounter _getmore;
+    StripedCounter _command;
+
+    StripedCounter _insertOnExistingDoc;
+    StripedCounter _updateOnMissingDoc;
+    StripedCounter _deleteWasEmpty;
+    StripedCounter _deleteFromMissingNamespace;
+    StripedCounter _acceptableErrorInCommand;
 
     // Counter for the deprecated OP_QUERY opcode.
-    CacheExclusive<AtomicWord<long long>> _queryDeprecated;
+    StripedCounter _queryDeprecated;
 };
 
 extern OpCounters globalOpCounters;
@@ -192,28 +193,24 @@ public:
     void append(BSONObjBuilder& b);
 
 private:
-    CacheExclusive<AtomicWord<long long>> _physicalBytesIn{0};
-    CacheExclusive<AtomicWord<long long>> _physicalBytesOut{0};
+    StripedCounter _physicalBytesIn;
+    StripedCounter _physicalBytesOut;
 
     // These two counters are always incremented at the same time, so
-    // we place them on the same cache line. We use
-    // CacheCombinedExclusive to ensure that they are combined within
-    // the scope of a constructive interference region, and protected
-    // from false sharing by padding out to destructive interference
-    // size.
+    // we keep them together on the same cache line of each stripe.
     struct Together {
         AtomicWord<long long> logicalBytesIn{0};
         AtomicWord<long long> requests{0};
     };
-    CacheCombinedExclusive<Together> _together{};
+    Striped<Together> _together;
 
-    CacheExclusive<AtomicWord<long long>> _logicalBytesOut{0};
+    StripedCounter _logicalBytesOut;
 
-    CacheExclusive<AtomicWord<long long>> _numSlowDNSOperations{0};
-    CacheExclusive<AtomicWord<long long>> _numSlowSSLOperations{0};
+    StripedCounter _numSlowDNSOperations;
+    StripedCounter _numSlowSSLOperations;
 
     // Counter of inbound connections at runtime.
-    CacheExclusive<AtomicWord<std::int64_t>> _tfoAccepted{0};
+    StripedCounter _tfoAccepted;
 
     // TFO info determined at startup.
     std::int64_t _tfoKernelSetting{0};
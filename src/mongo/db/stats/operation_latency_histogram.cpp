@@ -106,7 +106,8 @@ void OperationLatencyHistogram::_append(const HistogramData& data,
     if (includeHistograms) {
         BSONArrayBuilder arrayBuilder(histogramBuilder.subarrayStart("histogram"));
         for (size_t i = 0; i < kMaxBuckets; i++) {
-            if (data.buckets[i] == 0) {
+            const auto count = data.buckets[i].loadRelaxed();
+            if (count == 0) {
                 continue;
             }
 
@@ -116,13 +117,13 @@ void OperationLatencyHistogram::_append(const HistogramData& data,
                     lowestFilteredBound = kLowerBounds[i];
                 }
 
-                filteredCount += data.buckets[i];
+                filteredCount += count;
                 continue;
             }
 
             BSONObjBuilder entryBuilder(arrayBuilder.subobjStart());
             entryBuilder.append("micros", static_cast<long long>(kLowerBounds[i]));
-            entryBuilder.append("count", static_cast<long long>(data.buckets[i]));
+            entryBuilder.append("count", static_cast<long long>(count));
             entryBuilder.doneFast();
         }
 
@@ -139,8 +140,8 @@ void OperationLatencyHistogram::_append(const HistogramData& data,
         arrayBuilder.doneFast();
     }
 
-    histogramBuilder.append("latency", static_cast<long long>(data.sum));
-    histogramBuilder.append("ops", static_cast<long long>(data.entryCount));
+    histogramBuilder.append("latency", static_cast<long long>(data.sum.loadRelaxed()));
+    histogramBuilder.append("ops", static_cast<long long>(data.entryCount.loadRelaxed()));
     histogramBuilder.doneFast();
 }
 
@@ -181,9 +182,9 @@ int OperationLatencyHistogram::_getBucket(uint64_t value) {
 }
 
 void OperationLatencyHistogram::_incrementData(uint64_t latency, int bucket, HistogramData* data) {
-    data->buckets[bucket]++;
-    data->entryCount++;
-    data->sum += latency;
+    data->buckets[bucket].fetchAndAddRelaxed(1);
+    data->entryCount.fetchAndAddRelaxed(1);
+    data->sum.fetchAndAddRelaxed(latency);
 }
 
 void OperationLatencyHistogram::increment(uint64_t latency, Command::ReadWriteType type) {
@@ -206,4 +207,38 @@ void OperationLatencyHistogram::increment(uint64_t latency, Command::ReadWriteTy
     }
 }
 
+void OperationLatencyHistogram::_mergeData(const HistogramData& other, HistogramData* data) {
+    for (size_t i = 0; i < kMaxBuckets; i++) {
+        data->buckets[i].fetchAndAddRelaxed(other.buckets[i].loadRelaxed());
+    }
+    data->entryCount.fetchAndAddRelaxed(other.entryCount.loadRelaxed());
+    data->sum.fetchAndAddRelaxed(other.sum.loadRelaxed());
+}
+
+void OperationLatencyHistogram::_copyData(const HistogramData& other, HistogramData* data) {
+    for (size_t i = 0; i < kMaxBuckets; i++) {
+        data->buckets[i].store(other.buckets[i].loadRelaxed());
+    }
+    data->entryCount.store(other.entryCount.loadRelaxed());
+    data->sum.store(other.sum.loadRelaxed());
+}
+
+void OperationLatencyHistogram::merge(const OperationLatencyHistogram& other) {
+    _mergeData(other._reads, &_reads);
+    _mergeData(other._writes, &_writes);
+    _mergeData(other._commands, &_commands);
+    _mergeData(other._transactions, &_transactions);
+}
+
+OperationLatencyHistogram& OperationLatencyHistogram::operator=(
+    const OperationLatencyHistogram& other) {
+    if (this != &other) {
+        _copyData(other._reads, &_reads);
+        _copyData(other._writes, &_writes);
+        _copyData(other._commands, &_commands);
+        _copyData(other._transactions, &_transactions);
+    }
+    return *this;
+}
+
 }  // namespace mongo
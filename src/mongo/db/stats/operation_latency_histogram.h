@@ -31,6 +31,7 @@
 #include <array>
 
 #include "mongo/db/commands.h"
+#include "mongo/platform/atomic_word.h"
 
 namespace mongo {
 
@@ -40,12 +41,21 @@ class BSONObjBuilder;
  * Stores statistics for latencies of read, write, command, and multi-document transaction
  * operations.
  *
- * Note: This class is not thread-safe.
+ * Operations may be recorded concurrently. A reader racing with increments may observe some of the
+ * counters of an operation without the others.
  */
 class OperationLatencyHistogram {
 public:
     static const int kMaxBuckets = 51;
 
+    OperationLatencyHistogram() = default;
+
+    OperationLatencyHistogram(const OperationLatencyHistogram& other) {
+        merge(other);
+    }
+
+    OperationLatencyHistogram& operator=(const OperationLatencyHistogram& other);
+
     // Inclusive lower bounds of the histogram buckets.
     static const std::array<uint64_t, kMaxBuckets> kLowerBounds;
 
@@ -54,6 +64,11 @@ public:
      */
     void increment(uint64_t latency, Command::ReadWriteType type);
 
+    /**
+     * Adds the operations recorded by 'other' to this histogram.
+     */
+    void merge(const OperationLatencyHistogram& other);
+
     /**
      * Appends the four histograms with latency totals and operation counts.
      */
@@ -61,9 +76,9 @@ public:
 
 private:
     struct HistogramData {
-        std::array<uint64_t, kMaxBuckets> buckets{};
-        uint64_t entryCount = 0;
-        uint64_t sum = 0;
+        std::array<AtomicWord<uint64_t>, kMaxBuckets> buckets;
+        AtomicWord<uint64_t> entryCount;
+        AtomicWord<uint64_t> sum;
     };
 
     static int _getBucket(uint64_t latency);
@@ -78,6 +93,10 @@ private:
 
     void _incrementData(uint64_t latency, int bucket, HistogramData* data);
 
+    static void _mergeData(const HistogramData& other, HistogramData* data);
+
+    static void _copyData(const HistogramData& other, HistogramData* data);
+
     HistogramData _reads, _writes, _commands, _transactions;
 };
 }  // namespace mongo
@@ -64,6 +64,32 @@ TEST(OperationLatencyHistogram, EnsureIncrementsStored) {
     ASSERT_EQUALS(out["transactions"]["ops"].Long(), kMaxBuckets);
 }
 
+TEST(OperationLatencyHistogram, MergeAddsBucketsCountsAndLatencies) {
+    OperationLatencyHistogram merged;
+    OperationLatencyHistogram reads;
+    OperationLatencyHistogram writes;
+    for (int i = 0; i < kMaxBuckets; i++) {
+        merged.increment(kLowerBounds[i], Command::ReadWriteType::kRead);
+        reads.increment(kLowerBounds[i], Command::ReadWriteType::kRead);
+        writes.increment(kLowerBounds[i], Command::ReadWriteType::kWrite);
+    }
+    merged.merge(reads);
+    merged.merge(writes);
+
+    BSONObjBuilder outBuilder;
+    merged.append(true, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    const uint64_t boundsSum = std::accumulate(kLowerBounds.begin(), kLowerBounds.end(), 0ULL);
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), 2 * kMaxBuckets);
+    ASSERT_EQUALS(out["reads"]["latency"].Long(), static_cast<long long>(2 * boundsSum));
+    ASSERT_EQUALS(out["writes"]["ops"].Long(), kMaxBuckets);
+    ASSERT_EQUALS(out["writes"]["latency"].Long(), static_cast<long long>(boundsSum));
+    ASSERT_EQUALS(out["commands"]["ops"].Long(), 0);
+    for (auto&& bucket : out["reads"]["histogram"].Array()) {
+        ASSERT_EQUALS(bucket["count"].Long(), 2);
+    }
+}
+
 TEST(OperationLatencyHistogram, CheckBucketCountsAndTotalLatency) {
     OperationLatencyHistogram hist;
     // Increment at the boundary, boundary+1, and boundary-1.
@@ -53,8 +53,12 @@ const auto getTop = ServiceContext::declareDecoration<Top>();
 
 Top::UsageData::UsageData(const UsageData& older, const UsageData& newer) {
     // this won't be 100% accurate on rollovers and drop(), but at least it won't be negative
-    time = (newer.time >= older.time) ? (newer.time - older.time) : newer.time;
-    count = (newer.count >= older.count) ? (newer.count - older.count) : newer.count;
+    const auto olderTime = older.time.loadRelaxed();
+    const auto newerTime = newer.time.loadRelaxed();
+    const auto olderCount = older.count.loadRelaxed();
+    const auto newerCount = newer.count.loadRelaxed();
+    time.store((newerTime >= olderTime) ? (newerTime - olderTime) : newerTime);
+    count.store((newerCount >= olderCount) ? (newerCount - olderCount) : newerCount);
 }
 
 Top::CollectionData::CollectionData(const CollectionData& older, const CollectionData& newer)
@@ -84,10 +88,20 @@ void Top::record(OperationContext* opCtx,
         return;
 
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    {
+        std::shared_lock lk(_lock);  // NOLINT
+        if (auto it = _usage.find(hashedNs); it != _usage.end()) {
+            _record(opCtx, *it->second, logicalOp, lockType, micros, readWriteType);
+            return;
+        }
+    }
 
-    CollectionData& coll = _usage[hashedNs];
-    _record(opCtx, coll, logicalOp, lockType, micros, readWriteType);
+    std::unique_lock lk(_lock);  // NOLINT
+    auto& coll = _usage[hashedNs];
+    if (!coll) {
+        coll = std::make_unique<CollectionData>();
+    }
+    _record(opCtx, *coll, logicalOp, lockType, micros, readWriteType);
 }
 
 void Top::record(OperationContext* opCtx,
@@ -148,18 +162,22 @@ void Top::_record(OperationContext* opCtx,
 }
 
 void Top::collectionDropped(const NamespaceString& nss) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    std::unique_lock lk(_lock);  // NOLINT
     _usage.erase(nss.ns());
 }
 
 void Top::cloneMap(Top::UsageMap& out) const {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    out = _usage;
+    out.clear();
+    std::shared_lock lk(_lock);  // NOLINT
+    for (auto&& [ns, coll] : _usage) {
+        out.emplace(ns, *coll);
+    }
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _appendToUsageMap(b, _usage);
+    UsageMap usage;
+    cloneMap(usage);
+    _appendToUsageMap(b, usage);
 }
 
 void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
@@ -195,18 +213,23 @@ void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
 
 void Top::_appendStatsEntry(BSONObjBuilder& b, const char* statsName, const UsageData& map) const {
     BSONObjBuilder bb(b.subobjStart(statsName));
-    bb.appendNumber("time", map.time);
-    bb.appendNumber("count", map.count);
+    bb.appendNumber("time", map.time.loadRelaxed());
+    bb.appendNumber("count", map.count.loadRelaxed());
     bb.done();
 }
 
 void Top::appendLatencyStats(const NamespaceString& nss,
                              bool includeHistograms,
                              BSONObjBuilder* builder) {
-    auto hashedNs = UsageMap::hasher().hashed_key(nss.ns());
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    OperationLatencyHistogram histogram;
+    {
+        std::shared_lock lk(_lock);  // NOLINT
+        if (auto it = _usage.find(nss.ns()); it != _usage.end()) {
+            histogram = it->second->opLatencyHistogram;
+        }
+    }
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
+    histogram.append(includeHistograms, false, &latencyStatsBuilder);
     builder->append("ns", nss.ns());
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -217,20 +240,21 @@ void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
     if (!opCtx->shouldIncrementLatencyStats())
         return;
 
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
+    _incrementHistogram(opCtx, latency, &_globalHistogramStats.forCurrentThread(), readWriteType);
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms,
                                    bool slowMSBucketsOnly,
                                    BSONObjBuilder* builder) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder);
+    OperationLatencyHistogram histogram;
+    _globalHistogramStats.forEach(
+        [&](const OperationLatencyHistogram& stripe) { histogram.merge(stripe); });
+    histogram.append(includeHistograms, slowMSBucketsOnly, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(uint64_t latency) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
+    _globalHistogramStats.forCurrentThread().increment(latency,
+                                                       Command::ReadWriteType::kTransaction);
 }
 
 void Top::_incrementHistogram(OperationContext* opCtx,
@@ -34,12 +34,15 @@
  */
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <memory>
+#include <shared_mutex>
 
 #include "mongo/db/commands.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/stats/operation_latency_histogram.h"
-#include "mongo/util/concurrency/mutex.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/string_map.h"
+#include "mongo/util/striped_counter.h"
 
 namespace mongo {
 
@@ -47,6 +50,11 @@ class ServiceContext;
 
 /**
  * tracks usage by collection
+ *
+ * Operations update the counters of their collection atomically while holding the usage map in
+ * shared mode, so that operations completing concurrently don't wait for each other. The map is
+ * only held exclusively to add the first usage of a collection or to drop one. The global latency
+ * histogram is striped across threads, as every operation updates it.
  */
 class Top {
 public:
@@ -55,14 +63,23 @@ public:
     Top() = default;
 
     struct UsageData {
-        UsageData() : time(0), count(0) {}
+        UsageData() = default;
+        UsageData(const UsageData& other)
+            : time(other.time.loadRelaxed()), count(other.count.loadRelaxed()) {}
         UsageData(const UsageData& older, const UsageData& newer);
-        long long time;
-        long long count;
+
+        UsageData& operator=(const UsageData& other) {
+            time.store(other.time.loadRelaxed());
+            count.store(other.count.loadRelaxed());
+            return *this;
+        }
+
+        AtomicWord<long long> time;
+        AtomicWord<long long> count;
 
         void inc(long long micros) {
-            count++;
-            time += micros;
+            count.fetchAndAddRelaxed(1);
+            time.fetchAndAddRelaxed(micros);
         }
     };
 
@@ -164,9 +181,11 @@ private:
                              OperationLatencyHistogram* histogram,
                              Command::ReadWriteType readWriteType);
 
-    mutable SimpleMutex _lock;
-    OperationLatencyHistogram _globalHistogramStats;
-    UsageMap _usage;
+    // Entries are allocated separately so that they stay in place while the map grows.
+    mutable std::shared_mutex _lock;  // NOLINT
+    StringMap<std::unique_ptr<CollectionData>> _usage;
+
+    Striped<OperationLatencyHistogram> _globalHistogramStats;
 };
 
 }  // namespace mongo
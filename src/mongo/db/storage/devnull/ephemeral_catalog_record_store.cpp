@@ -509,6 +509,25 @@ void EphemeralForTestRecordStore::doCappedTruncateAfter(
     }
 }
 
+Status EphemeralForTestRecordStore::doRangeTruncate(OperationContext* opCtx,
+                                                    const RecordId& minRecordId,
+                                                    const RecordId& maxRecordId,
+                                                    int64_t hintDataSizeDiff,
+                                                    int64_t hintNumRecordsDiff) {
+    stdx::lock_guard<stdx::recursive_mutex> lock(_data->recordsMutex);
+    Records::iterator it = _data->records.lower_bound(minRecordId);
+    while (it != _data->records.end() && it->first <= maxRecordId) {
+        auto& id = it->first;
+        EphemeralForTestRecord record = it->second;
+
+        opCtx->recoveryUnit()->registerChange(
+            std::make_unique<RemoveChange>(opCtx, _data, id, record));
+        _data->dataSize -= record.size;
+        _data->records.erase(it++);
+    }
+    return Status::OK();
+}
+
 int64_t EphemeralForTestRecordStore::storageSize(OperationContext* opCtx,
                                                  BSONObjBuilder* extraInfo,
                                                  int infoLevel) const {
@@ -93,6 +93,12 @@ public:
                                bool inclusive,
                                const AboutToDeleteRecordCallback& aboutToDelete) override;
 
+    Status doRangeTruncate(OperationContext* opCtx,
+                           const RecordId& minRecordId,
+                           const RecordId& maxRecordId,
+                           int64_t hintDataSizeDiff,
+                           int64_t hintNumRecordsDiff) override;
+
     virtual void appendNumericCustomStats(OperationContext* opCtx,
                                           BSONObjBuilder* result,
                                           double scale) const {}
@@ -28,12 +28,32 @@
  */
 
 #include "mongo/db/storage/execution_context.h"
+
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
 
 namespace mongo {
+namespace {
+
+CounterMetric operationMemoryPoolBlocksAllocated("storage.operationMemoryPool.blocksAllocated");
+CounterMetric operationMemoryPoolFragmentsBuilt("storage.operationMemoryPool.fragmentsBuilt");
+
+}  // namespace
+
 const OperationContext::Decoration<StorageExecutionContext> StorageExecutionContext::get =
     OperationContext::declareDecoration<StorageExecutionContext>();
 
-StorageExecutionContext::StorageExecutionContext() {}
+StorageExecutionContext::StorageExecutionContext()
+    : _pooledBufferBuilder(
+          gOperationMemoryPoolBlockInitialSizeKB.loadRelaxed() * static_cast<size_t>(1024),
+          SharedBufferFragmentBuilder::DoubleGrowStrategy(
+              gOperationMemoryPoolBlockMaxSizeKB.loadRelaxed() * static_cast<size_t>(1024))) {}
+
+StorageExecutionContext::~StorageExecutionContext() {
+    if (auto fragments = _pooledBufferBuilder.fragmentsBuilt()) {
+        operationMemoryPoolBlocksAllocated.increment(_pooledBufferBuilder.blocksAllocated());
+        operationMemoryPoolFragmentsBuilt.increment(fragments);
+    }
+}
 
 }  // namespace mongo
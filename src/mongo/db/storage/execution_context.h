@@ -33,6 +33,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/key_string.h"
 #include "mongo/util/auto_clear_ptr.h"
+#include "mongo/util/shared_buffer_fragment.h"
 
 namespace mongo {
 
@@ -45,6 +46,7 @@ public:
     static const OperationContext::Decoration<StorageExecutionContext> get;
 
     StorageExecutionContext();
+    ~StorageExecutionContext();
 
     // No copy and no move
     StorageExecutionContext(const StorageExecutionContext&) = delete;
@@ -62,10 +64,20 @@ public:
         return makeAutoClearPtr(&_multikeyPaths);
     }
 
+    /**
+     * Memory pool for the KeyStrings the operation generates while writing documents. Consecutive
+     * keys share the same blocks, which are freed once none of their keys is referenced anymore.
+     * Sized by 'operationMemoryPoolBlockInitialSizeKB' and 'operationMemoryPoolBlockMaxSizeKB'.
+     */
+    SharedBufferFragmentBuilder& pooledBufferBuilder() {
+        return _pooledBufferBuilder;
+    }
+
 private:
     KeyStringSet _keys;
     KeyStringSet _multikeyMetadataKeys;
     MultikeyPaths _multikeyPaths;
+    SharedBufferFragmentBuilder _pooledBufferBuilder;
 };
 
 }  // namespace mongo
@@ -110,6 +110,30 @@ struct KeyStringEntry {
     RecordId loc;
 };
 
+/**
+ * Non-owning view of a KeyStringEntry, such as the current entry of an index cursor. As with
+ * KeyStringEntry, the key bytes always end with the RecordId. The key bytes, TypeBits and RecordId
+ * belong to the cursor and are only valid until it is next moved, saved or destroyed.
+ */
+struct KeyStringEntryView {
+    KeyStringEntryView(const char* buffer,
+                       size_t size,
+                       const KeyString::TypeBits& typeBits,
+                       const RecordId& loc)
+        : buffer(buffer), size(size), typeBits(&typeBits), loc(&loc) {}
+
+    explicit KeyStringEntryView(const KeyStringEntry& entry)
+        : KeyStringEntryView(entry.keyString.getBuffer(),
+                             entry.keyString.getSize(),
+                             entry.keyString.getTypeBits(),
+                             entry.loc) {}
+
+    const char* buffer;
+    size_t size;
+    const KeyString::TypeBits* typeBits;
+    const RecordId* loc;
+};
+
 /**
  * Describes a query that can be compared against an IndexKeyEntry in a way that allows
  * expressing exclusiveness on a prefix of the key. This is mostly used to express a location to
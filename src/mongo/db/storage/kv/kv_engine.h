@@ -434,6 +434,15 @@ public:
         return BSONObj{};
     };
 
+    /**
+     * Returns the fraction of the cache of the storage engine, between 0 and 1, which holds
+     * modified data that has not been written out yet, or boost::none if the storage engine does
+     * not track it.
+     */
+    virtual boost::optional<double> getCacheDirtyRatio() const {
+        return boost::none;
+    }
+
     /**
      * The destructor will never be called from mongod, but may be called from tests.
      * Engines may assume that this will only be called in the case of clean shutdown, even if
@@ -89,6 +89,16 @@ void RecordStore::cappedTruncateAfter(OperationContext* opCtx,
     doCappedTruncateAfter(opCtx, end, inclusive, std::move(aboutToDelete));
 }
 
+Status RecordStore::rangeTruncate(OperationContext* opCtx,
+                                  const RecordId& minRecordId,
+                                  const RecordId& maxRecordId,
+                                  int64_t hintDataSizeDiff,
+                                  int64_t hintNumRecordsDiff) {
+    validateWriteAllowed(opCtx);
+    invariant(minRecordId <= maxRecordId);
+    return doRangeTruncate(opCtx, minRecordId, maxRecordId, hintDataSizeDiff, hintNumRecordsDiff);
+}
+
 bool RecordStore::haveCappedWaiters() const {
     return _cappedInsertNotifier && _cappedInsertNotifier.use_count() > 1;
 }
@@ -539,6 +539,21 @@ public:
                              bool inclusive,
                              const AboutToDeleteRecordCallback& aboutToDelete);
 
+    /**
+     * Removes all records with RecordIds in the inclusive range ['minRecordId', 'maxRecordId']
+     * without reading them. Only valid on record stores keyed by the clustering key of their
+     * records, where a contiguous range of RecordIds maps to a contiguous range of documents.
+     *
+     * Callers must have already counted the records in the range, as 'hintDataSizeDiff' and
+     * 'hintNumRecordsDiff' are applied to the size information of the record store as-is. Both
+     * are expected to be negative or zero.
+     */
+    Status rangeTruncate(OperationContext* opCtx,
+                         const RecordId& minRecordId,
+                         const RecordId& maxRecordId,
+                         int64_t hintDataSizeDiff,
+                         int64_t hintNumRecordsDiff);
+
     /**
      * does this RecordStore support the compact operation?
      *
@@ -709,6 +724,11 @@ protected:
                                        const RecordId& end,
                                        bool inclusive,
                                        const AboutToDeleteRecordCallback& aboutToDelete) = 0;
+    virtual Status doRangeTruncate(OperationContext* opCtx,
+                                   const RecordId& minRecordId,
+                                   const RecordId& maxRecordId,
+                                   int64_t hintDataSizeDiff,
+                                   int64_t hintNumRecordsDiff) = 0;
     virtual Status doCompact(OperationContext* opCtx) {
         MONGO_UNREACHABLE;
     }
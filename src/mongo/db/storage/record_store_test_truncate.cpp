@@ -114,5 +114,66 @@ TEST(RecordStoreTestHarness, TruncateNonEmpty) {
     }
 }
 
+// Insert multiple records, and verify that calling rangeTruncate() removes exactly the records in
+// the inclusive range of RecordIds and applies the size hints.
+TEST(RecordStoreTestHarness, RangeTruncate) {
+    const auto harnessHelper(newRecordStoreHarnessHelper());
+    unique_ptr<RecordStore> rs(harnessHelper->newRecordStore());
+
+    std::vector<RecordId> ids;
+    std::vector<int64_t> sizes;
+    int nToInsert = 10;
+    for (int i = 0; i < nToInsert; i++) {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        {
+            stringstream ss;
+            ss << "record " << i;
+            string data = ss.str();
+
+            WriteUnitOfWork uow(opCtx.get());
+            StatusWith<RecordId> res =
+                rs->insertRecord(opCtx.get(), data.c_str(), data.size() + 1, Timestamp());
+            ASSERT_OK(res.getStatus());
+            uow.commit();
+            ids.push_back(res.getValue());
+            sizes.push_back(data.size() + 1);
+        }
+    }
+
+    int64_t dataSize = 0;
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        ASSERT_EQUALS(nToInsert, rs->numRecords(opCtx.get()));
+        dataSize = rs->dataSize(opCtx.get());
+    }
+
+    int64_t bytesRemoved = sizes[2] + sizes[3] + sizes[4] + sizes[5];
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        {
+            WriteUnitOfWork uow(opCtx.get());
+            ASSERT_OK(rs->rangeTruncate(opCtx.get(), ids[2], ids[5], -bytesRemoved, -4));
+            uow.commit();
+        }
+    }
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        ASSERT_EQUALS(nToInsert - 4, rs->numRecords(opCtx.get()));
+        ASSERT_EQUALS(dataSize - bytesRemoved, rs->dataSize(opCtx.get()));
+
+        auto cursor = rs->getCursor(opCtx.get());
+        for (int i = 0; i < nToInsert; i++) {
+            if (i >= 2 && i <= 5) {
+                continue;
+            }
+            auto record = cursor->next();
+            ASSERT(record);
+            ASSERT_EQUALS(ids[i], record->id);
+        }
+        ASSERT_FALSE(cursor->next());
+    }
+}
+
 }  // namespace
 }  // namespace mongo
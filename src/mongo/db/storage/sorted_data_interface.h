@@ -275,6 +275,13 @@ public:
         virtual boost::optional<IndexKeyEntry> next(RequestedInfo parts = kKeyAndLoc) = 0;
         virtual boost::optional<KeyStringEntry> nextKeyString() = 0;
 
+        /**
+         * Like nextKeyString(), but returns a view of the key held by the cursor rather than a
+         * copy of it. The view is invalidated by the next call that moves, saves or destroys this
+         * cursor.
+         */
+        virtual boost::optional<KeyStringEntryView> nextKeyStringView() = 0;
+
         //
         // Seeking
         //
@@ -286,6 +293,13 @@ public:
         virtual boost::optional<KeyStringEntry> seekForKeyString(
             const KeyString::Value& keyString) = 0;
 
+        /**
+         * Like seekForKeyString(), but returns a view of the key held by the cursor. See
+         * nextKeyStringView() for the lifetime of the view.
+         */
+        virtual boost::optional<KeyStringEntryView> seekForKeyStringView(
+            const KeyString::Value& keyString) = 0;
+
         /**
          * Seeks to the provided keyString and returns the IndexKeyEntry.
          * The provided keyString has discriminator information encoded.
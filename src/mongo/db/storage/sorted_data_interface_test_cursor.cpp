@@ -270,6 +270,49 @@ TEST(SortedDataInterface, ExhaustKeyStringCursorReversed) {
     }
 }
 
+void testExhaustKeyStringViewCursor(bool unique) {
+    const auto harnessHelper(newSortedDataInterfaceHarnessHelper());
+    const std::unique_ptr<SortedDataInterface> sorted(
+        harnessHelper->newSortedDataInterface(unique, /*partial=*/false));
+
+    const ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+    std::vector<KeyString::Value> keyStrings;
+    int nToInsert = 10;
+    for (int i = 0; i < nToInsert; i++) {
+        WriteUnitOfWork uow(opCtx.get());
+        KeyString::Value ks = makeKeyString(sorted.get(), BSON("" << i), RecordId(42, i * 2));
+        keyStrings.push_back(ks);
+        ASSERT_OK(sorted->insert(opCtx.get(), ks, true));
+        uow.commit();
+    }
+
+    const std::unique_ptr<SortedDataInterface::Cursor> cursor(sorted->newCursor(opCtx.get()));
+    for (int i = 0; i < nToInsert; i++) {
+        auto entry = i == 0 ? cursor->seekForKeyStringView(
+                                  makeKeyStringForSeek(sorted.get(), BSONObj(), true, true))
+                            : cursor->nextKeyStringView();
+        ASSERT(entry);
+        const auto& expected = keyStrings.at(i);
+        ASSERT_EQ(0,
+                  KeyString::compare(
+                      entry->buffer, expected.getBuffer(), entry->size, expected.getSize()));
+        ASSERT(entry->typeBits->isAllZeros());
+        ASSERT_EQ(*entry->loc, RecordId(42, i * 2));
+    }
+    ASSERT(!cursor->nextKeyStringView());
+
+    // Cursor at EOF should remain at EOF when advanced
+    ASSERT(!cursor->nextKeyStringView());
+}
+
+TEST(SortedDataInterface, ExhaustKeyStringViewCursor) {
+    testExhaustKeyStringViewCursor(/*unique*/ false);
+}
+
+TEST(SortedDataInterface, ExhaustKeyStringViewCursorUnique) {
+    testExhaustKeyStringViewCursor(/*unique*/ true);
+}
+
 void testBoundaries(bool unique, bool forward, bool inclusive) {
     const auto harnessHelper(newSortedDataInterfaceHarnessHelper());
     const std::unique_ptr<SortedDataInterface> sorted(
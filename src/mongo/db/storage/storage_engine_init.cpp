@@ -196,6 +196,19 @@ StorageEngine::LastShutdownState initializeStorageEngine(OperationContext* opCtx
                     }
                     break;
                 }
+                case QueueingPolicyEnum::AdaptiveQueue: {
+                    LOGV2_DEBUG(7470202, 1, "Using adaptive queue-based ticketing scheduler");
+                    AdaptiveTicketHolder::Options options;
+                    options.readers = readTransactions;
+                    options.writers = writeTransactions;
+                    options.longRunning = gConcurrentLongRunningTransactions;
+                    options.minTickets = gAdaptiveMinTransactions;
+                    options.maxTickets = gAdaptiveMaxTransactions;
+                    options.longRunningAdmissions = gLongRunningAdmissions.load();
+                    auto ticketHolder = std::make_unique<AdaptiveTicketHolder>(options, svcCtx);
+                    TicketHolder::use(svcCtx, std::move(ticketHolder));
+                    break;
+                }
             }
         } else {
             auto ticketHolder = std::make_unique<ReaderWriterTicketHolder>(
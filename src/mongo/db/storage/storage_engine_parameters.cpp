@@ -46,6 +46,8 @@ Status TicketQueueingPolicy::setFromString(const std::string& protocolStr) {
         gTicketQueueingPolicy = QueueingPolicyEnum::FifoQueue;
     } else if (protocolStr == QueueingPolicy_serializer(QueueingPolicyEnum::SchedulingQueue)) {
         gTicketQueueingPolicy = QueueingPolicyEnum::SchedulingQueue;
+    } else if (protocolStr == QueueingPolicy_serializer(QueueingPolicyEnum::AdaptiveQueue)) {
+        gTicketQueueingPolicy = QueueingPolicyEnum::AdaptiveQueue;
     } else {
         return Status{ErrorCodes::BadValue,
                       str::stream() << "Unrecognized ticketQueueingPolicy '" << protocolStr << "'"};
@@ -74,4 +74,23 @@ Status TickerHolderStorageParams::updateConcurrentReadTransactions(const int& ne
     return Status::OK();
 }
 
+Status TickerHolderStorageParams::updateLongRunningAdmissions(const int& newLongRunningAdmissions) {
+    if (auto client = Client::getCurrent()) {
+        if (auto svcCtx = client->getServiceContext()) {
+            if (auto ticketHolder =
+                    dynamic_cast<AdaptiveTicketHolder*>(TicketHolder::get(svcCtx))) {
+                ticketHolder->setLongRunningAdmissions(newLongRunningAdmissions);
+            } else {
+                LOGV2_WARNING(7470201,
+                              "Attempting to update long-running admissions on an incompatible "
+                              "queueing policy");
+                return Status(ErrorCodes::IllegalOperation,
+                              "Attempting to update long-running admissions on an incompatible "
+                              "queueing policy");
+            }
+        }
+    }
+    return Status::OK();
+}
+
 }  // namespace mongo
@@ -914,6 +914,7 @@ public:
           _idx(idx),
           _key(idx.getKeyStringVersion()),
           _typeBits(idx.getKeyStringVersion()),
+          _keyWithRecordId(idx.getKeyStringVersion()),
           _query(idx.getKeyStringVersion()) {
         _cursor.emplace(_idx.uri(), _idx.tableId(), false, _opCtx);
     }
@@ -936,6 +937,13 @@ public:
         return getKeyStringEntry();
     }
 
+    boost::optional<KeyStringEntryView> nextKeyStringView() override {
+        if (!advanceNext() || _eof) {
+            return {};
+        }
+        return getKeyStringEntryView();
+    }
+
     void setEndPosition(const BSONObj& key, bool inclusive) override {
         LOGV2_TRACE_CURSOR(20098,
                            "setEndPosition inclusive: {inclusive} {key}",
@@ -970,6 +978,14 @@ public:
         return getKeyStringEntry();
     }
 
+    boost::optional<KeyStringEntryView> seekForKeyStringView(
+        const KeyString::Value& keyStringValue) override {
+        if (!seekForKeyStringInternal(keyStringValue)) {
+            return boost::none;
+        }
+        return getKeyStringEntryView();
+    }
+
     void save() override {
         WiredTigerIndexCursorGeneric::resetCursor();
 
@@ -1271,6 +1287,23 @@ protected:
         return KeyStringEntry(_key.getValueCopy(), _id);
     }
 
+    KeyStringEntryView getKeyStringEntryView() {
+        // Same contract as getKeyStringEntry(), but the returned key points into this cursor. Keys
+        // without a RecordId are completed in '_keyWithRecordId', whose buffer is reused across
+        // calls, so that no key is ever allocated on the heap.
+        if (_idx.unique() &&
+            (_idx.isIdIndex() ||
+             _key.getSize() ==
+                 KeyString::getKeySize(
+                     _key.getBuffer(), _key.getSize(), _idx.getOrdering(), _typeBits))) {
+            _keyWithRecordId.resetFromBuffer(_key.getBuffer(), _key.getSize());
+            _keyWithRecordId.appendRecordId(_id);
+            return KeyStringEntryView(
+                _keyWithRecordId.getBuffer(), _keyWithRecordId.getSize(), _typeBits, _id);
+        }
+        return KeyStringEntryView(_key.getBuffer(), _key.getSize(), _typeBits, _id);
+    }
+
     const WiredTigerIndex& _idx;  // not owned
 
     // These are where this cursor instance is. They are not changed in the face of a failing
@@ -1279,6 +1312,9 @@ protected:
     KeyString::TypeBits _typeBits;
     RecordId _id;
 
+    // Scratch space for getKeyStringEntryView(), only valid until the cursor next moves.
+    KeyString::Builder _keyWithRecordId;
+
     KeyString::Builder _query;
 
     std::unique_ptr<KeyString::Builder> _endPosition;
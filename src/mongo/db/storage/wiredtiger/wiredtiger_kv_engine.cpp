@@ -2731,4 +2731,17 @@ StatusWith<BSONObj> WiredTigerKVEngine::getStorageMetadata(StringData ident) con
                                 << fileMetadata.getValue());
 }
 
+boost::optional<double> WiredTigerKVEngine::getCacheDirtyRatio() const {
+    auto session = _sessionCache->getSession();
+
+    auto bytesDirty = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    auto bytesMax = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_MAX);
+    if (!bytesDirty.isOK() || !bytesMax.isOK() || bytesMax.getValue() <= 0) {
+        return boost::none;
+    }
+    return static_cast<double>(bytesDirty.getValue()) / bytesMax.getValue();
+}
+
 }  // namespace mongo
@@ -395,6 +395,8 @@ public:
 
     StatusWith<BSONObj> getStorageMetadata(StringData ident) const override;
 
+    boost::optional<double> getCacheDirtyRatio() const override;
+
 private:
     class WiredTigerSessionSweeper;
 
@@ -980,14 +980,67 @@ void WiredTigerRecordStore::checkSize(OperationContext* opCtx) {
                            "ident"_attr = getIdent());
         sizeRecoveryState(getGlobalServiceContext())
             .markCollectionAsAlwaysNeedsSizeAdjustment(getIdent());
-        _sizeInfo->dataSize.store(0);
-        _sizeInfo->numRecords.store(0);
+        _sizeInfo->setDataSize(0);
+        _sizeInfo->setNumRecords(0);
+    } else if (_sizeStorer && !_sizeStorer->contains(opCtx, _uri) &&
+               !sizeRecoveryState(getGlobalServiceContext())
+                    .collectionAlwaysNeedsSizeAdjustment(getIdent())) {
+        // The size of this record store was never recorded, for example because the node shut down
+        // uncleanly before the size storer was first flushed. A size which was recorded, even as
+        // zero, or which recovery is going to adjust is left alone.
+        _estimateSizeFromStatistics(opCtx);
     }
 
     if (_sizeStorer)
         _sizeStorer->store(_uri, _sizeInfo);
 }
 
+void WiredTigerRecordStore::_estimateSizeFromStatistics(OperationContext* opCtx) {
+    if (_isEphemeral) {
+        return;
+    }
+
+    // A tree walk reads the pages of the table without materializing any record, which is much
+    // cheaper than counting the records through a cursor.
+    WiredTigerSession* session = WiredTigerRecoveryUnit::get(opCtx)->getSessionNoTxn();
+    auto entries = WiredTigerUtil::getStatisticsValue(session->getSession(),
+                                                      "statistics:" + getURI(),
+                                                      "statistics=(tree_walk)",
+                                                      WT_STAT_DSRC_BTREE_ENTRIES);
+    if (!entries.isOK() || entries.getValue() <= 0) {
+        LOGV2_FOR_RECOVERY(7470300,
+                           2,
+                           "Unable to estimate the size of a record store from statistics",
+                           "ident"_attr = getIdent(),
+                           "error"_attr = entries.getStatus());
+        return;
+    }
+
+    const long long kSampleSize = 100;
+    long long sampled = 0;
+    long long sampledBytes = 0;
+    auto cursor = getRandomCursor(opCtx);
+    while (sampled < kSampleSize) {
+        auto record = cursor->next();
+        if (!record) {
+            break;
+        }
+        ++sampled;
+        sampledBytes += record->data.size();
+    }
+
+    const long long numRecords = entries.getValue();
+    const long long dataSize = sampled ? numRecords * (sampledBytes / sampled) : 0;
+    LOGV2_FOR_RECOVERY(7470301,
+                       1,
+                       "Estimated the size of a record store without size information",
+                       "ident"_attr = getIdent(),
+                       "numRecords"_attr = numRecords,
+                       "dataSize"_attr = dataSize);
+    _sizeInfo->setNumRecords(numRecords);
+    _sizeInfo->setDataSize(dataSize);
+}
+
 void WiredTigerRecordStore::postConstructorInit(OperationContext* opCtx) {
     // If the server was started in read-only mode, skip calculating the oplog stones. The
     // OplogCapMaintainerThread does not get started in this instance.
@@ -1019,11 +1072,11 @@ KeyFormat WiredTigerRecordStore::keyFormat() const {
 }
 
 long long WiredTigerRecordStore::dataSize(OperationContext* opCtx) const {
-    return _sizeInfo->dataSize.load();
+    return _sizeInfo->dataSize();
 }
 
 long long WiredTigerRecordStore::numRecords(OperationContext* opCtx) const {
-    auto numRecords = _sizeInfo->numRecords.load();
+    auto numRecords = _sizeInfo->numRecords();
     return numRecords > 0 ? numRecords : 0;
 }
 
@@ -1130,8 +1183,7 @@ void WiredTigerRecordStore::doDeleteRecord(OperationContext* opCtx, const Record
     auto keyLength = computeRecordIdSize(id);
     metricsCollector.incrementOneDocWritten(_uri, old_length + keyLength);
 
-    _changeNumRecords(opCtx, -1);
-    _increaseDataSize(opCtx, -old_length);
+    _changeNumRecordsAndDataSize(opCtx, -1, -old_length);
 }
 
 Timestamp WiredTigerRecordStore::getPinnedOplog() const {
@@ -1256,8 +1308,7 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx, Timestamp mayT
             invariantWTOK(cursor->reset(cursor), cursor->session);
             setKey(cursor, &truncateUpToKey);
             invariantWTOK(session->truncate(session, nullptr, nullptr, cursor, nullptr), session);
-            _changeNumRecords(opCtx, -stone->records);
-            _increaseDataSize(opCtx, -stone->bytes);
+            _changeNumRecordsAndDataSize(opCtx, -stone->records, -stone->bytes);
 
             wuow.commit();
 
@@ -1280,8 +1331,8 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx, Timestamp mayT
     LOGV2(22402,
           "WiredTiger record store oplog truncation finished",
           "pinnedOplogTimestamp"_attr = mayTruncateUpTo,
-          "numRecords"_attr = _sizeInfo->numRecords.load(),
-          "dataSize"_attr = _sizeInfo->dataSize.load(),
+          "numRecords"_attr = _sizeInfo->numRecords(),
+          "dataSize"_attr = _sizeInfo->dataSize(),
           "duration"_attr = Milliseconds(elapsedMillis));
 }
 
@@ -1401,8 +1452,7 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
         }
     }
 
-    _changeNumRecords(opCtx, nRecords);
-    _increaseDataSize(opCtx, totalLength);
+    _changeNumRecordsAndDataSize(opCtx, nRecords, totalLength);
 
     if (_oplogStones) {
         _oplogStones->updateCurrentStoneAfterInsertOnCommit(
@@ -1580,7 +1630,7 @@ Status WiredTigerRecordStore::doUpdateRecord(OperationContext* opCtx,
     }
     invariantWTOK(ret, c->session);
 
-    _increaseDataSize(opCtx, len - old_length);
+    _changeNumRecordsAndDataSize(opCtx, 0, len - old_length);
     return Status::OK();
 }
 
@@ -1721,8 +1771,7 @@ Status WiredTigerRecordStore::doTruncate(OperationContext* opCtx) {
     WT_SESSION* session = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
     invariantWTOK(WT_OP_CHECK(session->truncate(session, nullptr, start, nullptr, nullptr)),
                   session);
-    _changeNumRecords(opCtx, -numRecords(opCtx));
-    _increaseDataSize(opCtx, -dataSize(opCtx));
+    _changeNumRecordsAndDataSize(opCtx, -numRecords(opCtx), -dataSize(opCtx));
 
     if (_oplogStones) {
         _oplogStones->clearStonesOnCommit(opCtx);
@@ -1731,6 +1780,33 @@ Status WiredTigerRecordStore::doTruncate(OperationContext* opCtx) {
     return Status::OK();
 }
 
+Status WiredTigerRecordStore::doRangeTruncate(OperationContext* opCtx,
+                                              const RecordId& minRecordId,
+                                              const RecordId& maxRecordId,
+                                              int64_t hintDataSizeDiff,
+                                              int64_t hintNumRecordsDiff) {
+    // The truncate only removes records between the keys of the start and stop cursors, so the
+    // cursors need not be positioned on existing records.
+    WiredTigerCursor startWrap(_uri, _tableId, true, opCtx);
+    WT_CURSOR* start = startWrap.get();
+    CursorKey startKey = makeCursorKey(minRecordId, _keyFormat);
+    setKey(start, &startKey);
+
+    WiredTigerCursor stopWrap(_uri, _tableId, true, opCtx);
+    WT_CURSOR* stop = stopWrap.get();
+    CursorKey stopKey = makeCursorKey(maxRecordId, _keyFormat);
+    setKey(stop, &stopKey);
+
+    WT_SESSION* session = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
+    int ret = WT_OP_CHECK(session->truncate(session, nullptr, start, stop, nullptr));
+    Status status = wtRCToStatus(ret, session, "WiredTigerRecordStore::rangeTruncate");
+    if (!status.isOK()) {
+        return status;
+    }
+    _changeNumRecordsAndDataSize(opCtx, hintNumRecordsDiff, hintDataSizeDiff);
+    return Status::OK();
+}
+
 Status WiredTigerRecordStore::doCompact(OperationContext* opCtx) {
     dassert(opCtx->lockState()->isWriteLocked());
 
@@ -1869,8 +1945,8 @@ void WiredTigerRecordStore::updateStatsAfterRepair(OperationContext* opCtx,
     sizeRecoveryState(getGlobalServiceContext())
         .markCollectionAsAlwaysNeedsSizeAdjustment(getIdent());
 
-    _sizeInfo->numRecords.store(std::max(numRecords, 0ll));
-    _sizeInfo->dataSize.store(std::max(dataSize, 0ll));
+    _sizeInfo->setNumRecords(std::max(numRecords, 0ll));
+    _sizeInfo->setDataSize(std::max(dataSize, 0ll));
 
     // If we have a WiredTigerSizeStorer, but our size info is not currently cached, add it.
     if (_sizeStorer)
@@ -1965,7 +2041,9 @@ long long WiredTigerRecordStore::_reserveIdBlock(OperationContext* opCtx, size_t
     return _nextIdNum.fetchAndAdd(nRecords);
 }
 
-void WiredTigerRecordStore::_changeNumRecords(OperationContext* opCtx, int64_t diff) {
+void WiredTigerRecordStore::_changeNumRecordsAndDataSize(OperationContext* opCtx,
+                                                         int64_t numRecordsDiff,
+                                                         int64_t dataSizeDiff) {
     if (!_tracksSizeAdjustments) {
         return;
     }
@@ -1974,36 +2052,22 @@ void WiredTigerRecordStore::_changeNumRecords(OperationContext* opCtx, int64_t d
         return;
     }
 
-    opCtx->recoveryUnit()->onRollback([this, diff]() {
-        LOGV2_DEBUG(
-            22404, 3, "WiredTigerRecordStore: rolling back NumRecordsChange", "diff"_attr = -diff);
-        _sizeInfo->numRecords.addAndFetch(-diff);
+    opCtx->recoveryUnit()->onRollback([this, numRecordsDiff, dataSizeDiff]() {
+        LOGV2_DEBUG(22404,
+                    3,
+                    "WiredTigerRecordStore: rolling back NumRecordsChange and DataSizeChange",
+                    "numRecordsDiff"_attr = -numRecordsDiff,
+                    "dataSizeDiff"_attr = -dataSizeDiff);
+        _sizeInfo->add(-numRecordsDiff, -dataSizeDiff);
     });
-    _sizeInfo->numRecords.addAndFetch(diff);
-}
-
-void WiredTigerRecordStore::_increaseDataSize(OperationContext* opCtx, int64_t amount) {
-    if (!_tracksSizeAdjustments) {
-        return;
-    }
-
-    if (!sizeRecoveryState(getGlobalServiceContext()).collectionNeedsSizeAdjustment(getIdent())) {
-        return;
-    }
-
-    if (opCtx)
-        opCtx->recoveryUnit()->onRollback(
-            [this, amount]() { _increaseDataSize(nullptr, -amount); });
-
-    if (_sizeInfo->dataSize.fetchAndAdd(amount) < 0)
-        _sizeInfo->dataSize.store(std::max(amount, int64_t(0)));
+    _sizeInfo->add(numRecordsDiff, dataSizeDiff);
 
     if (_sizeStorer)
         _sizeStorer->store(_uri, _sizeInfo);
 }
 
 void WiredTigerRecordStore::setNumRecords(long long numRecords) {
-    _sizeInfo->numRecords.store(std::max(numRecords, 0ll));
+    _sizeInfo->setNumRecords(std::max(numRecords, 0ll));
 
     if (!_sizeStorer) {
         return;
@@ -2016,7 +2080,7 @@ void WiredTigerRecordStore::setNumRecords(long long numRecords) {
 }
 
 void WiredTigerRecordStore::setDataSize(long long dataSize) {
-    _sizeInfo->dataSize.store(std::max(dataSize, 0ll));
+    _sizeInfo->setDataSize(std::max(dataSize, 0ll));
 
     if (!_sizeStorer) {
         return;
@@ -2084,8 +2148,7 @@ void WiredTigerRecordStore::doCappedTruncateAfter(
     WT_SESSION* session = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
     invariantWTOK(session->truncate(session, nullptr, start, nullptr, nullptr), session);
 
-    _changeNumRecords(opCtx, -recordsRemoved);
-    _increaseDataSize(opCtx, -bytesRemoved);
+    _changeNumRecordsAndDataSize(opCtx, -recordsRemoved, -bytesRemoved);
 
     wuow.commit();
 
@@ -203,6 +203,12 @@ public:
                                bool inclusive,
                                const AboutToDeleteRecordCallback& aboutToDelete) final;
 
+    Status doRangeTruncate(OperationContext* opCtx,
+                           const RecordId& minRecordId,
+                           const RecordId& maxRecordId,
+                           int64_t hintDataSizeDiff,
+                           int64_t hintNumRecordsDiff) final;
+
     virtual void updateStatsAfterRepair(OperationContext* opCtx,
                                         long long numRecords,
                                         long long dataSize);
@@ -221,7 +227,9 @@ public:
     /*
      * Check the size information for this RecordStore. This function opens a cursor on the
      * RecordStore to determine if it is empty. If it is empty, it will mark the collection as
-     * needing size adjustment as a result of a rollback or storage recovery event.
+     * needing size adjustment as a result of a rollback or storage recovery event. If it is not
+     * empty but its size was never recorded, such as after an unclean shutdown which happened
+     * before the size storer was first flushed, the size is estimated from WiredTiger statistics.
      */
     void checkSize(OperationContext* opCtx);
 
@@ -294,9 +302,16 @@ private:
     void _initNextIdIfNeeded(OperationContext* opCtx);
 
     /**
-     * Adjusts the record count and data size metadata for this record store, respectively. These
-     * functions consult the SizeRecoveryState to determine whether or not to actually change the
-     * size metadata if the server is undergoing recovery.
+     * Estimates the record count from WiredTiger statistics and the data size from a random sample
+     * of records, for a record store whose size was never recorded. Leaves the size information
+     * unchanged if the statistics are unavailable.
+     */
+    void _estimateSizeFromStatistics(OperationContext* opCtx);
+
+    /**
+     * Adjusts the record count and data size metadata for this record store, registering a single
+     * rollback handler for both. This function consults the SizeRecoveryState to determine whether
+     * or not to actually change the size metadata if the server is undergoing recovery.
      *
      * For most record stores, we will not update the size metadata during recovery, as we trust
      * that the values in the SizeStorer are accurate with respect to the end state of recovery.
@@ -310,8 +325,9 @@ private:
      *      are pending writes to this ident as part of the recovery process, and so we must
      *      always adjust size metadata for these idents.
      */
-    void _changeNumRecords(OperationContext* opCtx, int64_t diff);
-    void _increaseDataSize(OperationContext* opCtx, int64_t amount);
+    void _changeNumRecordsAndDataSize(OperationContext* opCtx,
+                                      int64_t numRecordsDiff,
+                                      int64_t dataSizeDiff);
 
     const std::string _uri;
     const uint64_t _tableId;  // not persisted
@@ -391,25 +391,33 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 
 
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
-    }
+    _pools.forEach([&](SessionPool& pool) {
+        stdx::lock_guard<Latch> lock(pool.lock);
+        for (auto session : pool.sessions) {
+            session->closeAllCursors(uri);
+        }
+    });
 }
 
 void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
-    }
+    _pools.forEach([&](SessionPool& pool) {
+        stdx::lock_guard<Latch> lock(pool.lock);
+        for (auto session : pool.sessions) {
+            session->closeCursorsForQueuedDrops(_engine);
+        }
+    });
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    _pools.forEach([&](SessionPool& pool) {
+        stdx::lock_guard<Latch> lock(pool.lock);
+        count += pool.sessions.size();
+    });
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -421,22 +429,22 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+    _pools.forEach([&](SessionPool& pool) {
+        stdx::lock_guard<Latch> lock(pool.lock);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = pool.sessions.begin(); it != pool.sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = pool.sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
             }
         }
-    }
+    });
 
-    // Closing expired idle sessions is expensive, so do it outside of the cache mutex. This helps
+    // Closing expired idle sessions is expensive, so do it outside of the pool mutexes. This helps
     // to avoid periodic operation latency spikes as seen in SERVER-52879.
     for (auto session : sessionsToClose) {
         delete session;
@@ -444,14 +452,17 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
+    // Increment the epoch as we are now closing all sessions with this epoch. Sessions are only
+    // returned to a pool after rechecking the epoch under the pool's lock, so once the epoch has
+    // moved on no session of an older epoch can be added to a pool we already emptied.
     SessionCache swap;
+    _epoch.fetchAndAdd(1);
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
-    }
+    _pools.forEach([&](SessionPool& pool) {
+        stdx::lock_guard<Latch> lock(pool.lock);
+        swap.insert(swap.end(), pool.sessions.begin(), pool.sessions.end());
+        pool.sessions.clear();
+    });
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
         delete (*i);
@@ -467,24 +478,38 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
-            // Get the most recently used session so that if we discard sessions, we're
-            // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
-            // Reset the idle time
-            cachedSession->setIdleExpireTime(Date_t::min());
-            return UniqueWiredTigerSession(cachedSession);
-        }
+    // Prefer the pool of this thread's stripe, then the pools of its nearest neighbors, before
+    // opening a new session.
+    WiredTigerSession* cachedSession = _takeSession(_pools.forCurrentThread());
+    for (std::size_t distance = 1; !cachedSession && distance <= kNumNeighborPoolsToSearch;
+         ++distance) {
+        cachedSession = _takeSession(_pools.forNeighborOfCurrentThread(distance));
+    }
+
+    if (cachedSession) {
+        // Reset the idle time
+        cachedSession->setIdleExpireTime(Date_t::min());
+        return UniqueWiredTigerSession(cachedSession);
     }
 
-    // Outside of the cache partition lock, but on release will be put back on the cache
+    // Outside of the pool locks, but on release will be put back in a pool
     return UniqueWiredTigerSession(
         new WiredTigerSession(_conn, this, _epoch.load(), _cursorEpoch.load()));
 }
 
+WiredTigerSession* WiredTigerSessionCache::_takeSession(SessionPool& pool) {
+    stdx::lock_guard<Latch> lock(pool.lock);
+    if (pool.sessions.empty()) {
+        return nullptr;
+    }
+
+    // Get the most recently used session so that if we discard sessions, we're discarding older
+    // ones
+    WiredTigerSession* session = pool.sessions.back();
+    pool.sessions.pop_back();
+    return session;
+}
+
 void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     invariant(session);
     // We might have skipped releasing some cursors during the shutdown.
@@ -535,10 +560,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        auto& pool = _pools.forCurrentThread();
+        stdx::lock_guard<Latch> lock(pool.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            pool.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
@@ -39,6 +39,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/util/concurrency/spin_lock.h"
+#include "mongo/util/striped_counter.h"
 
 namespace mongo {
 
@@ -394,12 +395,21 @@ private:
     AtomicWord<unsigned> _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // Idle sessions are pooled per stripe of threads, so that operations starting and finishing
+    // on different threads rarely take the same lock. A thread whose own pool is empty looks into
+    // the pools of the next kNumNeighborPoolsToSearch stripes before opening a new session, rather
+    // than taking the lock of every pool.
+    struct SessionPool {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::SessionPool::lock");
+        SessionCache sessions;
+    };
+    static constexpr std::size_t kNumNeighborPoolsToSearch = 2;
+    Striped<SessionPool> _pools;
 
     // Bumped when all open sessions need to be closed
-    AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
+    AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the locks
 
     // Bumped when all open cursors need to be closed
     AtomicWord<unsigned long long> _cursorEpoch;  // atomic so we can check it outside of the lock
@@ -433,6 +443,12 @@ private:
      * session and releasing it, the session is directly released. This method is thread safe.
      */
     void releaseSession(WiredTigerSession* session);
+
+    /**
+     * Removes and returns the most recently released session of 'pool', or nullptr if the pool is
+     * empty.
+     */
+    WiredTigerSession* _takeSession(SessionPool& pool);
 };
 
 /**
@@ -29,13 +29,16 @@
 
 #include "mongo/platform/basic.h"
 
+#include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/temp_dir.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/system_clock_source.h"
@@ -114,6 +117,42 @@ TEST(WiredTigerSessionCacheTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
 }
 
+TEST(WiredTigerSessionCacheTest, ReusesSessionsReleasedByOtherThreads) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+    const size_t numSessions = 4;
+
+    std::set<WiredTigerSession*> released;
+    std::vector<stdx::thread> threads;
+    for (size_t i = 0; i < numSessions; ++i) {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        released.insert(session.get());
+        // Each thread returns its session to the pool of its own stripe.
+        threads.emplace_back([session = std::move(session)]() mutable { session.reset(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), numSessions);
+
+    // This thread takes the idle sessions from whichever pools hold them before opening new ones.
+    std::vector<UniqueWiredTigerSession> sessions;
+    for (size_t i = 0; i < numSessions; ++i) {
+        sessions.push_back(sessionCache->getSession());
+        ASSERT_EQUALS(released.count(sessions.back().get()), 1U);
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+    sessions.clear();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), numSessions);
+
+    // Sessions of an older epoch are closed rather than returned to a pool.
+    UniqueWiredTigerSession session = sessionCache->getSession();
+    sessionCache->closeAll();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+    session.reset();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+}
+
 TEST(WiredTigerSessionCacheTest, ReleaseCursorDuringShutdown) {
     WiredTigerSessionCacheHarnessHelper harnessHelper("");
     WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
@@ -30,6 +30,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
 #include <wiredtiger.h>
 
 #include "mongo/bson/bsonobj.h"
@@ -49,6 +50,44 @@
 
 namespace mongo {
 
+long long WiredTigerSizeStorer::SizeInfo::numRecords() const {
+    long long numRecords = _numRecords.load();
+    _deltas.forEach(
+        [&](const Deltas& deltas) { numRecords += deltas.numRecords.loadRelaxed(); });
+    return numRecords;
+}
+
+long long WiredTigerSizeStorer::SizeInfo::dataSize() const {
+    long long dataSize = _dataSize.load();
+    _deltas.forEach([&](const Deltas& deltas) { dataSize += deltas.dataSize.loadRelaxed(); });
+    return std::max(dataSize, 0ll);
+}
+
+void WiredTigerSizeStorer::SizeInfo::setNumRecords(long long numRecords) {
+    _deltas.forEach([](Deltas& deltas) { deltas.numRecords.swap(0); });
+    _numRecords.store(numRecords);
+}
+
+void WiredTigerSizeStorer::SizeInfo::setDataSize(long long dataSize) {
+    _deltas.forEach([](Deltas& deltas) { deltas.dataSize.swap(0); });
+    _dataSize.store(dataSize);
+}
+
+void WiredTigerSizeStorer::SizeInfo::_reconcile() {
+    long long numRecordsDiff = 0;
+    long long dataSizeDiff = 0;
+    _deltas.forEach([&](Deltas& deltas) {
+        numRecordsDiff += deltas.numRecords.swap(0);
+        dataSizeDiff += deltas.dataSize.swap(0);
+    });
+    _numRecords.fetchAndAdd(numRecordsDiff);
+
+    // Writes that were rolled back or raced with a call to setDataSize() may leave the data size
+    // below zero, in which case reset it.
+    if (_dataSize.addAndFetch(dataSizeDiff) < 0)
+        _dataSize.store(0);
+}
+
 WiredTigerSizeStorer::WiredTigerSizeStorer(WT_CONNECTION* conn, const std::string& storageUri)
     : _conn(conn), _storageUri(storageUri), _tableId(WiredTigerSession::genTableId()) {
     std::string config = WiredTigerCustomizationHooks::get(getGlobalServiceContext())
@@ -60,7 +99,7 @@ WiredTigerSizeStorer::WiredTigerSizeStorer(WT_CONNECTION* conn, const std::strin
         session.getSession());
 }
 
-void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeInfo) {
+void WiredTigerSizeStorer::store(StringData uri, const std::shared_ptr<SizeInfo>& sizeInfo) {
     // If the SizeInfo is still dirty, we're done.
     if (sizeInfo->_dirty.load())
         return;
@@ -78,8 +117,8 @@ void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeI
                 2,
                 "WiredTigerSizeStorer::store",
                 "uri"_attr = uri,
-                "numRecords"_attr = sizeInfo->numRecords.load(),
-                "dataSize"_attr = sizeInfo->dataSize.load(),
+                "numRecords"_attr = sizeInfo->numRecords(),
+                "dataSize"_attr = sizeInfo->dataSize(),
                 "entryUseCount"_attr = entry.use_count());
 }
 
@@ -114,6 +153,23 @@ std::shared_ptr<WiredTigerSizeStorer::SizeInfo> WiredTigerSizeStorer::load(Opera
                                       data["dataSize"].safeNumberLong());
 }
 
+bool WiredTigerSizeStorer::contains(OperationContext* opCtx, StringData uri) const {
+    {
+        stdx::lock_guard<Latch> bufferLock(_bufferMutex);
+        if (_buffer.find(uri) != _buffer.end())
+            return true;
+    }
+
+    WiredTigerCursor cursor(_storageUri, _tableId, /*allowOverwrite=*/false, opCtx);
+    WT_ITEM key = {uri.rawData(), uri.size()};
+    cursor->set_key(cursor.get(), &key);
+    int ret = cursor->search(cursor.get());
+    if (ret == WT_NOTFOUND)
+        return false;
+    invariantWTOK(ret, cursor->session);
+    return true;
+}
+
 void WiredTigerSizeStorer::flush(bool syncToDisk) {
     Buffer buffer;
     {
@@ -160,8 +216,9 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
             // still be written back. So, the required order is to clear the dirty flag first.
             SizeInfo& sizeInfo = *it->second;
             sizeInfo._dirty.store(false);
-            BSONObj data = BSON("numRecords" << sizeInfo.numRecords.load() << "dataSize"
-                                             << sizeInfo.dataSize.load());
+            sizeInfo._reconcile();
+            BSONObj data = BSON("numRecords" << sizeInfo._numRecords.load() << "dataSize"
+                                             << sizeInfo._dataSize.load());
 
             auto& uri = it->first;
             LOGV2_DEBUG(22425,
@@ -38,6 +38,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/util/string_map.h"
+#include "mongo/util/striped_counter.h"
 
 namespace mongo {
 
@@ -60,19 +61,63 @@ public:
      * ownership. The SizeInfo may still be updated after it is stored in the SizeStorer.
      * The 'dirty' field is used by the size storer to cheaply merge duplicate stores of the same
      * SizeInfo.
+     *
+     * Changes made by writers are accumulated in per-thread stripes, so that concurrent inserts and
+     * deletes on the same collection do not all write to the same cache line. The stripes are only
+     * folded into the base values when the SizeInfo is flushed or set, and reads sum them.
      */
     struct SizeInfo {
         SizeInfo() = default;
-        SizeInfo(long long records, long long size) : numRecords(records), dataSize(size) {}
+        SizeInfo(long long records, long long size) : _numRecords(records), _dataSize(size) {}
 
         ~SizeInfo() {
             invariant(!_dirty.load());
         }
-        AtomicWord<long long> numRecords;
-        AtomicWord<long long> dataSize;
+
+        /**
+         * Return the last values set plus all changes added since. Changes added concurrently with
+         * the read may only be partially reflected. The data size is never negative.
+         */
+        long long numRecords() const;
+        long long dataSize() const;
+
+        /**
+         * Adds to the number of records and data size. Only writes to the calling thread's stripe.
+         */
+        void add(long long numRecordsDiff, long long dataSizeDiff) {
+            auto& deltas = _deltas.forCurrentThread();
+            if (numRecordsDiff)
+                deltas.numRecords.fetchAndAddRelaxed(numRecordsDiff);
+            if (dataSizeDiff)
+                deltas.dataSize.fetchAndAddRelaxed(dataSizeDiff);
+        }
+
+        /**
+         * Overwrite the number of records or data size, discarding changes added before the call.
+         */
+        void setNumRecords(long long numRecords);
+        void setDataSize(long long dataSize);
 
     private:
         friend WiredTigerSizeStorer;
+
+        struct Deltas {
+            AtomicWord<long long> numRecords;
+            AtomicWord<long long> dataSize;
+        };
+
+        /**
+         * Folds the changes of every stripe into '_numRecords' and '_dataSize'.
+         */
+        void _reconcile();
+
+        AtomicWord<long long> _numRecords;
+        AtomicWord<long long> _dataSize;
+
+        // Every collection has a SizeInfo, so keep the number of stripes small enough that the
+        // footprint of deployments with many collections remains modest.
+        Striped<Deltas, 4> _deltas;
+
         AtomicWord<bool> _dirty;
     };
 
@@ -83,10 +128,16 @@ public:
      * Ensure that the shared SizeInfo will be stored by the next call to flush.
      * Values stored are no older than the values at time of this call, but may be newer.
      */
-    void store(StringData uri, std::shared_ptr<SizeInfo> sizeInfo);
+    void store(StringData uri, const std::shared_ptr<SizeInfo>& sizeInfo);
 
     std::shared_ptr<SizeInfo> load(OperationContext* opCtx, StringData uri) const;
 
+    /**
+     * Returns whether size information was ever stored for 'uri', either flushed to the underlying
+     * table or still waiting for the next flush. load() returns an empty SizeInfo when it was not.
+     */
+    bool contains(OperationContext* opCtx, StringData uri) const;
+
     /**
      * Writes all changes to the underlying table.
      */
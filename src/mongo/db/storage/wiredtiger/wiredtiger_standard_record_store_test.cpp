@@ -33,18 +33,21 @@
 #include <sstream>
 #include <string>
 #include <time.h>
+#include <vector>
 
 #include "mongo/base/checked_cast.h"
 #include "mongo/base/init.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/json.h"
+#include "mongo/db/server_recovery.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store_test_harness.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
@@ -98,7 +101,7 @@ TEST(WiredTigerRecordStoreTest, SizeStorer1) {
     {
         ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
         auto& info = *ss.load(opCtx.get(), uri);
-        ASSERT_EQUALS(N, info.numRecords.load());
+        ASSERT_EQUALS(N, info.numRecords());
     }
 
     {
@@ -144,7 +147,7 @@ TEST(WiredTigerRecordStoreTest, SizeStorer1) {
         ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
         WiredTigerSizeStorer ss2(harnessHelper->conn(), indexUri);
         auto info = ss2.load(opCtx.get(), uri);
-        ASSERT_EQUALS(N, info->numRecords.load());
+        ASSERT_EQUALS(N, info->numRecords());
     }
 
     rs.reset(nullptr);  // this has to be deleted before ss
@@ -171,11 +174,11 @@ private:
 
 protected:
     long long getNumRecords(OperationContext* opCtx) const {
-        return sizeStorer->load(opCtx, uri)->numRecords.load();
+        return sizeStorer->load(opCtx, uri)->numRecords();
     }
 
     long long getDataSize(OperationContext* opCtx) const {
-        return sizeStorer->load(opCtx, uri)->dataSize.load();
+        return sizeStorer->load(opCtx, uri)->dataSize();
     }
 
     std::unique_ptr<WiredTigerHarnessHelper> harnessHelper;
@@ -194,5 +197,109 @@ TEST_F(SizeStorerUpdateTest, Basic) {
     ASSERT_EQUALS(getDataSize(opCtx.get()), val);
 }
 
+// Changes made on several threads are all reflected in reads and in the flushed size information.
+TEST_F(SizeStorerUpdateTest, ConcurrentChangesAreFlushed) {
+    auto sizeInfo = std::make_shared<WiredTigerSizeStorer::SizeInfo>(10, 100);
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < 1000; ++j) {
+                sizeInfo->add(1, 10);
+                sizeInfo->add(-1, -5);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQUALS(sizeInfo->numRecords(), 10);
+    ASSERT_EQUALS(sizeInfo->dataSize(), 100 + 8 * 1000 * 5);
+
+    sizeStorer->store(uri, sizeInfo);
+    sizeStorer->flush(false);
+    sizeInfo->setNumRecords(3);
+    ASSERT_EQUALS(sizeInfo->numRecords(), 3);
+
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+    ASSERT_EQUALS(getNumRecords(opCtx.get()), 10);
+    ASSERT_EQUALS(getDataSize(opCtx.get()), 100 + 8 * 1000 * 5);
+}
+
+// An empty record store has its size reset, and is marked as needing size adjustment so that the
+// writes replayed during recovery are counted.
+TEST_F(SizeStorerUpdateTest, CheckSizeResetsEmptyRecordStore) {
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+    WiredTigerRecordStore* wtrs = checked_cast<WiredTigerRecordStore*>(rs.get());
+    wtrs->setNumRecords(5);
+    wtrs->setDataSize(50);
+    ASSERT_FALSE(sizeRecoveryState(getGlobalServiceContext())
+                     .collectionAlwaysNeedsSizeAdjustment(ident));
+
+    wtrs->checkSize(opCtx.get());
+    ASSERT_EQUALS(rs->numRecords(opCtx.get()), 0);
+    ASSERT_EQUALS(rs->dataSize(opCtx.get()), 0);
+    ASSERT_TRUE(sizeRecoveryState(getGlobalServiceContext())
+                    .collectionAlwaysNeedsSizeAdjustment(ident));
+}
+
+// A non-empty record store keeps the size recorded for it, even if it is zero.
+TEST_F(SizeStorerUpdateTest, CheckSizeKeepsRecordedSize) {
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+    WiredTigerRecordStore* wtrs = checked_cast<WiredTigerRecordStore*>(rs.get());
+    {
+        WriteUnitOfWork uow(opCtx.get());
+        for (int i = 0; i < 3; i++) {
+            ASSERT_OK(rs->insertRecord(opCtx.get(), "abc", 4, Timestamp()).getStatus());
+        }
+        uow.commit();
+    }
+    ASSERT_EQUALS(rs->numRecords(opCtx.get()), 3);
+    ASSERT_EQUALS(rs->dataSize(opCtx.get()), 12);
+
+    wtrs->checkSize(opCtx.get());
+    ASSERT_EQUALS(rs->numRecords(opCtx.get()), 3);
+    ASSERT_EQUALS(rs->dataSize(opCtx.get()), 12);
+
+    wtrs->setNumRecords(0);
+    wtrs->setDataSize(0);
+    wtrs->checkSize(opCtx.get());
+    ASSERT_EQUALS(rs->numRecords(opCtx.get()), 0);
+    ASSERT_EQUALS(rs->dataSize(opCtx.get()), 0);
+    ASSERT_FALSE(sizeRecoveryState(getGlobalServiceContext())
+                     .collectionAlwaysNeedsSizeAdjustment(ident));
+}
+
+// A non-empty record store whose size was never recorded has it estimated from statistics.
+TEST_F(SizeStorerUpdateTest, CheckSizeEstimatesSizeNeverRecorded) {
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+    WiredTigerRecordStore* wtrs = checked_cast<WiredTigerRecordStore*>(rs.get());
+    {
+        WriteUnitOfWork uow(opCtx.get());
+        for (int i = 0; i < 3; i++) {
+            ASSERT_OK(rs->insertRecord(opCtx.get(), "abc", 4, Timestamp()).getStatus());
+        }
+        uow.commit();
+    }
+
+    // Lose the size information, as an unclean shutdown before the first flush would.
+    sizeStorer->flush(false);
+    wtrs->setSizeStorer(nullptr);
+    wtrs->setNumRecords(0);
+    wtrs->setDataSize(0);
+    WiredTigerSizeStorer emptySizeStorer(harnessHelper->conn(),
+                                         WiredTigerKVEngine::kTableUriPrefix + "emptySizeStorer");
+    ASSERT_FALSE(emptySizeStorer.contains(opCtx.get(), uri));
+    wtrs->setSizeStorer(&emptySizeStorer);
+    ON_BLOCK_EXIT([&] {
+        wtrs->setSizeStorer(sizeStorer.get());
+        emptySizeStorer.flush(false);
+    });
+
+    wtrs->checkSize(opCtx.get());
+    ASSERT_GT(rs->numRecords(opCtx.get()), 0);
+    ASSERT_EQUALS(rs->dataSize(opCtx.get()), rs->numRecords(opCtx.get()) * 4);
+    ASSERT_TRUE(emptySizeStorer.contains(opCtx.get(), uri));
+}
+
 }  // namespace
 }  // namespace mongo
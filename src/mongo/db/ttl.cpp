@@ -34,12 +34,16 @@
 #include "mongo/db/auth/user_name.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_catalog.h"
+#include "mongo/db/catalog/collection_write_path.h"
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/client.h"
 #include "mongo/db/commands/fsync_locked.h"
+#include "mongo/db/commands/server_status.h"
 #include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/exec/batched_delete_stage_gen.h"
 #include "mongo/db/exec/delete_stage.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/namespace_string.h"
@@ -48,6 +52,7 @@
 #include "mongo/db/record_id_helpers.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/tenant_migration_access_blocker_registry.h"
+#include "mongo/db/s/collection_sharding_state.h"
 #include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/s/shard_filtering_metadata_refresh.h"
 #include "mongo/db/service_context.h"
@@ -189,6 +194,7 @@ const IndexDescriptor* getValidTTLIndex(OperationContext* opCtx,
 
 MONGO_FAIL_POINT_DEFINE(hangTTLMonitorWithLock);
 MONGO_FAIL_POINT_DEFINE(hangTTLMonitorBetweenPasses);
+MONGO_FAIL_POINT_DEFINE(ttlMonitorPacingUnderPressure);
 
 // A TTL pass completes when there are no more expired documents to remove. A single TTL pass may
 // consist of multiple sub-passes. Each sub-pass deletes all the expired documents it can up to
@@ -197,6 +203,7 @@ MONGO_FAIL_POINT_DEFINE(hangTTLMonitorBetweenPasses);
 CounterMetric ttlPasses("ttl.passes");
 CounterMetric ttlSubPasses("ttl.subPasses");
 CounterMetric ttlDeletedDocuments("ttl.deletedDocuments");
+CounterMetric ttlPacingDelayMillis("ttl.pacingDelayMillis");
 
 using MtabType = TenantMigrationAccessBlocker::BlockerType;
 
@@ -286,6 +293,13 @@ void TTLMonitor::_doTTLPass() {
     // Increment the metric after the TTL work has been finished.
     ON_BLOCK_EXIT([&] { ttlPasses.increment(); });
 
+    {
+        stdx::lock_guard<Latch> lk(_stateMutex);
+        for (auto& [key, backlog] : _backlogs) {
+            backlog.deletedInPass = 0;
+        }
+    }
+
     bool moreToDelete = true;
     while (moreToDelete) {
         // Sub-passes may not delete all documents in the interest of fairness. If a sub-pass
@@ -311,6 +325,19 @@ bool TTLMonitor::_doTTLSubPass(OperationContext* opCtx) {
     // during a long running pass.
     TTLCollectionCache::InfoMap work = ttlCollectionCache.getTTLInfos();
 
+    {
+        // Forget the backlog of TTL indexes which no longer exist.
+        stdx::lock_guard<Latch> lk(_stateMutex);
+        for (auto it = _backlogs.begin(); it != _backlogs.end();) {
+            auto infos = work.find(it->first.first);
+            bool found = infos != work.end() &&
+                std::any_of(infos->second.begin(), infos->second.end(), [&](const auto& info) {
+                             return _backlogKey(infos->first, info) == it->first;
+                         });
+            it = found ? std::next(it) : _backlogs.erase(it);
+        }
+    }
+
     // When batching is enabled, _doTTLIndexDelete will limit the amount of work it
     // performs in both time and the number of documents it deletes. If it reaches one
     // of these limits on an index, it will return moreToDelete as true, and we will
@@ -319,15 +346,29 @@ bool TTLMonitor::_doTTLSubPass(OperationContext* opCtx) {
     //
     // When batching is disabled, _doTTLIndexDelete will delete as many documents as
     // possible without limit.
+    //
+    // When 'ttlMonitorPaceDeletes' is enabled, the most overdue TTL indexes are visited first and
+    // each batch is followed by a delay which keeps the TTL monitor within its duty cycle and backs
+    // off while replication or the storage engine is under pressure.
+    const bool paceDeletes = ttlMonitorPaceDeletes.load() && ttlMonitorBatchDeletes.load();
     Timer timer;
     do {
         TTLCollectionCache::InfoMap moreWork;
-        for (const auto& [uuid, infos] : work) {
-            for (const auto& info : infos) {
-                bool moreToDelete = _doTTLIndexDelete(opCtx, &ttlCollectionCache, uuid, info);
-                if (moreToDelete) {
-                    moreWork[uuid].push_back(info);
-                }
+        for (const auto& [uuid, info] : _orderWork(work)) {
+            const auto deletedBefore = ttlDeletedDocuments.get();
+            Timer batchTimer;
+            bool moreToDelete = _doTTLIndexDelete(opCtx, &ttlCollectionCache, uuid, info);
+            const auto batchTime = Milliseconds(batchTimer.millis());
+            const auto deleted = ttlDeletedDocuments.get() - deletedBefore;
+
+            _recordBatch(opCtx, uuid, info, deleted, moreToDelete);
+            if (moreToDelete) {
+                moreWork[uuid].push_back(info);
+            }
+
+            if (paceDeletes && deleted > 0 &&
+                !_sleepForPacing(opCtx, _pacingDelay(opCtx, batchTime))) {
+                return false;
             }
         }
 
@@ -339,6 +380,147 @@ bool TTLMonitor::_doTTLSubPass(OperationContext* opCtx) {
     return !work.empty();
 }
 
+TTLMonitor::BacklogKey TTLMonitor::_backlogKey(const UUID& uuid,
+                                               const TTLCollectionCache::Info& info) {
+    return {uuid,
+            stdx::visit(OverloadedVisitor{
+                            [](const TTLCollectionCache::ClusteredId&) { return std::string(); },
+                            [](const TTLCollectionCache::IndexName& indexName) {
+                                return std::string(indexName);
+                            },
+                        },
+                        info)};
+}
+
+std::vector<std::pair<UUID, TTLCollectionCache::Info>> TTLMonitor::_orderWork(
+    const TTLCollectionCache::InfoMap& work) const {
+    std::vector<std::pair<UUID, TTLCollectionCache::Info>> ordered;
+    for (const auto& [uuid, infos] : work) {
+        for (const auto& info : infos) {
+            ordered.emplace_back(uuid, info);
+        }
+    }
+
+    if (!ttlMonitorPaceDeletes.load()) {
+        return ordered;
+    }
+
+    // Indexes which are not overdue sort after the overdue ones, as if they had just become
+    // overdue.
+    struct Priority {
+        Date_t overdueSince = Date_t::max();
+        long long deletedInLastBatch = 0;
+    };
+    std::map<BacklogKey, Priority> priorities;
+    {
+        stdx::lock_guard<Latch> lk(_stateMutex);
+        for (const auto& [uuid, info] : ordered) {
+            auto key = _backlogKey(uuid, info);
+            auto it = _backlogs.find(key);
+            Priority priority;
+            if (it != _backlogs.end()) {
+                if (it->second.overdueSince != Date_t()) {
+                    priority.overdueSince = it->second.overdueSince;
+                }
+                priority.deletedInLastBatch = it->second.deletedInLastBatch;
+            }
+            priorities.emplace(std::move(key), priority);
+        }
+    }
+
+    std::stable_sort(ordered.begin(), ordered.end(), [&](const auto& lhs, const auto& rhs) {
+        const auto& lhsPriority = priorities.at(_backlogKey(lhs.first, lhs.second));
+        const auto& rhsPriority = priorities.at(_backlogKey(rhs.first, rhs.second));
+        if (lhsPriority.overdueSince != rhsPriority.overdueSince) {
+            return lhsPriority.overdueSince < rhsPriority.overdueSince;
+        }
+        return lhsPriority.deletedInLastBatch > rhsPriority.deletedInLastBatch;
+    });
+    return ordered;
+}
+
+void TTLMonitor::_recordBatch(OperationContext* opCtx,
+                              const UUID& uuid,
+                              const TTLCollectionCache::Info& info,
+                              long long deleted,
+                              bool moreToDelete) {
+    auto nss = CollectionCatalog::get(opCtx)->lookupNSSByUUID(opCtx, uuid);
+    const auto now = Date_t::now();
+
+    stdx::lock_guard<Latch> lk(_stateMutex);
+    auto& backlog = _backlogs[_backlogKey(uuid, info)];
+    if (nss) {
+        backlog.nss = *nss;
+    }
+    if (!moreToDelete) {
+        backlog.overdueSince = Date_t();
+    } else if (backlog.overdueSince == Date_t()) {
+        backlog.overdueSince = now;
+    }
+    backlog.deletedInPass += deleted;
+    backlog.deletedInLastBatch = deleted;
+    backlog.lastBatch = now;
+}
+
+Milliseconds TTLMonitor::_pacingDelay(OperationContext* opCtx, Milliseconds batchTime) {
+    BatchedDeletePacer::Options options;
+    options.dutyCyclePercent = ttlMonitorPacingDutyCyclePercent.load();
+    // Never wait longer than the TTL monitor would between passes.
+    options.maxDelay = Seconds(ttlMonitorSleepSecs.load());
+    options.maxReplicationLag = Seconds(ttlMonitorPacingMaxReplicationLagSecs.load());
+    options.maxDirtyCachePercent = ttlMonitorPacingMaxDirtyCachePercent.load();
+    options.checkTicketQueue = true;
+
+    const bool underPressure = BatchedDeletePacer::isUnderPressure(opCtx, options) ||
+        MONGO_unlikely(ttlMonitorPacingUnderPressure.shouldFail());
+
+    stdx::lock_guard<Latch> lk(_stateMutex);
+    return _pacer.delayAfterBatch(batchTime, underPressure, options);
+}
+
+bool TTLMonitor::_sleepForPacing(OperationContext* opCtx, Milliseconds delay) {
+    if (delay <= Milliseconds(0)) {
+        return true;
+    }
+    ttlPacingDelayMillis.increment(durationCount<Milliseconds>(delay));
+
+    // Waits on the shutdown condition rather than sleeping, so that neither a shutdown nor an
+    // interruption of the operation waits for the end of the delay.
+    const auto deadline = Date_t::now() + delay;
+    stdx::unique_lock<Latch> lk(_stateMutex);
+
+    MONGO_IDLE_THREAD_BLOCK;
+    opCtx->waitForConditionOrInterruptUntil(
+        _shuttingDownCV, lk, deadline, [&] { return _shuttingDown; });
+    return !_shuttingDown;
+}
+
+void TTLMonitor::appendBacklogStats(BSONObjBuilder* builder) const {
+    const auto now = Date_t::now();
+
+    stdx::lock_guard<Latch> lk(_stateMutex);
+    BSONArrayBuilder indexes(builder->subarrayStart("indexes"));
+    for (const auto& [key, backlog] : _backlogs) {
+        BSONObjBuilder index(indexes.subobjStart());
+        index.append("ns", backlog.nss.ns());
+        key.first.appendToBuilder(&index, "uuid");
+        if (key.second.empty()) {
+            index.append("clustered", true);
+        } else {
+            index.append("index", key.second);
+        }
+        if (backlog.overdueSince != Date_t()) {
+            index.append("overdueSince", backlog.overdueSince);
+            index.append("overdueMillis", durationCount<Milliseconds>(now - backlog.overdueSince));
+        }
+        index.append("deletedInPass", backlog.deletedInPass);
+        index.append("deletedInLastBatch", backlog.deletedInLastBatch);
+        index.append("lastBatch", backlog.lastBatch);
+    }
+    indexes.done();
+    builder->append("pacingBackoff", _pacer.getBackoff());
+}
+
 bool TTLMonitor::_doTTLIndexDelete(OperationContext* opCtx,
                                    TTLCollectionCache* ttlCollectionCache,
                                    const UUID& uuid,
@@ -592,6 +774,15 @@ bool TTLMonitor::_deleteExpiredWithCollscan(OperationContext* opCtx,
     // BatchedDeleteStageStats from a non-batched delete.
     bool batchingEnabled = isBatchingEnabled();
 
+    if (ttlMonitorTruncateClusteredCollections.load() &&
+        collection_internal::canTruncateRange(opCtx, collection) &&
+        !CollectionShardingState::get(opCtx, collection->ns())
+             ->getCollectionDescription(opCtx)
+             .isSharded()) {
+        return _truncateExpiredWithRange(
+            opCtx, collection, startId.recordId(), endId.recordId(), batchingEnabled);
+    }
+
     // Deletes records using a bounded collection scan from the beginning of time to the
     // expiration time (inclusive).
     Timer timer;
@@ -635,6 +826,77 @@ bool TTLMonitor::_deleteExpiredWithCollscan(OperationContext* opCtx,
     return false;
 }
 
+bool TTLMonitor::_truncateExpiredWithRange(OperationContext* opCtx,
+                                           const CollectionPtr& collection,
+                                           const RecordId& startId,
+                                           const RecordId& endId,
+                                           bool batchingEnabled) {
+    // Like the batches of a batched delete, every truncate removes a bounded number of documents
+    // in its own WriteUnitOfWork, so that neither the storage transaction nor the time spent
+    // counting the documents under it grows with the number of expired documents.
+    const long long batchDocs = gBatchedDeletesTargetBatchDocs.load();
+    const long long targetPassDocs = batchingEnabled ? ttlIndexDeleteTargetDocs.load() : 0;
+    const Milliseconds targetPassTime =
+        batchingEnabled ? Milliseconds(ttlIndexDeleteTargetTimeMS.load()) : Milliseconds(0);
+
+    Timer timer;
+    long long numDeleted = 0;
+    bool moreToDelete = false;
+    while (true) {
+        long long maxDocs = batchDocs;
+        if (targetPassDocs > 0) {
+            const long long remainingPassDocs = targetPassDocs - numDeleted;
+            maxDocs = maxDocs > 0 ? std::min(maxDocs, remainingPassDocs) : remainingPassDocs;
+        }
+
+        // The documents removed by the previous truncates are gone, so every truncate starts
+        // from the beginning of the expired range again.
+        const auto batchDeleted =
+            writeConflictRetry(opCtx, "ttlTruncateRange", collection->ns().ns(), [&] {
+                WriteUnitOfWork wuow(opCtx);
+                const auto batchDeleted =
+                    collection_internal::truncateRange(opCtx,
+                                                       collection,
+                                                       startId,
+                                                       endId,
+                                                       true /* includeMax */,
+                                                       maxDocs,
+                                                       false /* fromMigrate */);
+                wuow.commit();
+                return batchDeleted;
+            });
+        numDeleted += batchDeleted;
+        ttlDeletedDocuments.increment(batchDeleted);
+
+        if (maxDocs == 0 || batchDeleted < maxDocs) {
+            // There are no expired documents left in the range.
+            break;
+        }
+        if ((targetPassDocs > 0 && numDeleted >= targetPassDocs) ||
+            (targetPassTime > Milliseconds(0) && Milliseconds(timer.millis()) >= targetPassTime)) {
+            // Reaching a target implies there may be more work to be done on the collection.
+            moreToDelete = true;
+            break;
+        }
+        opCtx->checkForInterrupt();
+    }
+
+    const auto duration = Milliseconds(timer.millis());
+    if (shouldLogSlowOpWithSampling(opCtx,
+                                    logv2::LogComponent::kIndex,
+                                    duration,
+                                    Milliseconds(serverGlobalParams.slowMS))
+            .first) {
+        LOGV2(7470302,
+              "Deleted expired documents by truncating a range of the collection",
+              logAttrs(collection->ns()),
+              "numDeleted"_attr = numDeleted,
+              "duration"_attr = duration);
+    }
+
+    return moreToDelete;
+}
+
 void startTTLMonitor(ServiceContext* serviceContext) {
     std::unique_ptr<TTLMonitor> ttlMonitor = std::make_unique<TTLMonitor>();
     ttlMonitor->go();
@@ -650,6 +912,27 @@ void shutdownTTLMonitor(ServiceContext* serviceContext) {
     }
 }
 
+namespace {
+
+class TTLBacklogSSS : public ServerStatusSection {
+public:
+    TTLBacklogSSS() : ServerStatusSection("ttlBacklog") {}
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        BSONObjBuilder bob;
+        if (auto ttlMonitor = TTLMonitor::get(opCtx->getServiceContext())) {
+            ttlMonitor->appendBacklogStats(&bob);
+        }
+        return bob.obj();
+    }
+} ttlBacklogSSS;
+
+}  // namespace
+
 long long TTLMonitor::getTTLPasses_forTest() {
     return ttlPasses.get();
 }
@@ -29,8 +29,17 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <utility>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/batched_delete_pacer.h"
+#include "mongo/db/namespace_string.h"
 #include "mongo/db/ttl_collection_cache.h"
 #include "mongo/util/background.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -66,6 +75,12 @@ public:
      */
     void shutdown();
 
+    /**
+     * Appends the expiry backlog of every TTL index the monitor visited, for the 'ttlBacklog'
+     * serverStatus section.
+     */
+    void appendBacklogStats(BSONObjBuilder* builder) const;
+
     long long getTTLPasses_forTest();
     long long getTTLSubPasses_forTest();
 
@@ -140,6 +155,73 @@ private:
                                     TTLCollectionCache* ttlCollectionCache,
                                     const CollectionPtr& collection);
 
+    /*
+     * Removes the expired documents of a clustered collection with RecordIds in ['startId',
+     * 'endId'] by truncating the range, when 'ttlMonitorTruncateClusteredCollections' is enabled
+     * and the collection supports it. The range is truncated in bounded batches of
+     * 'batchedDeletesTargetBatchDocs' documents, each in its own WriteUnitOfWork. When batching is
+     * enabled, batches stop once 'ttlIndexDeleteTargetDocs' documents were removed or
+     * 'ttlIndexDeleteTargetTimeMS' elapsed.
+     *
+     * Returns true if there may be more expired documents to remove at this time. False otherwise.
+     */
+    bool _truncateExpiredWithRange(OperationContext* opCtx,
+                                   const CollectionPtr& collection,
+                                   const RecordId& startId,
+                                   const RecordId& endId,
+                                   bool batchingEnabled);
+
+    /**
+     * The expiry backlog of a TTL index, or of the clustered index of a TTL collection.
+     */
+    struct Backlog {
+        NamespaceString nss;
+
+        // When a batched delete on the index first left expired documents behind, or Date_t() if
+        // all of them have been removed since.
+        Date_t overdueSince;
+
+        long long deletedInPass = 0;
+        long long deletedInLastBatch = 0;
+        Date_t lastBatch;
+    };
+
+    // A TTL index is identified by the UUID of its collection and its name, which is empty for
+    // the clustered index.
+    using BacklogKey = std::pair<UUID, std::string>;
+
+    static BacklogKey _backlogKey(const UUID& uuid, const TTLCollectionCache::Info& info);
+
+    /**
+     * Returns the TTL indexes of 'work' in the order a sub-pass should visit them. When
+     * 'ttlMonitorPaceDeletes' is enabled, the indexes which have been overdue for the longest come
+     * first, followed by the ones whose last batch deleted the most documents.
+     */
+    std::vector<std::pair<UUID, TTLCollectionCache::Info>> _orderWork(
+        const TTLCollectionCache::InfoMap& work) const;
+
+    /**
+     * Records that a batched delete on a TTL index removed 'deleted' documents and whether it left
+     * expired documents behind.
+     */
+    void _recordBatch(OperationContext* opCtx,
+                      const UUID& uuid,
+                      const TTLCollectionCache::Info& info,
+                      long long deleted,
+                      bool moreToDelete);
+
+    /**
+     * Returns how long to wait after a batched delete which took 'batchTime' when
+     * 'ttlMonitorPaceDeletes' is enabled.
+     */
+    Milliseconds _pacingDelay(OperationContext* opCtx, Milliseconds batchTime);
+
+    /**
+     * Waits for 'delay' unless the monitor is shut down first. Returns false if it was. Throws if
+     * 'opCtx' is interrupted.
+     */
+    bool _sleepForPacing(OperationContext* opCtx, Milliseconds delay);
+
     // Protects the state below.
     mutable Mutex _stateMutex = MONGO_MAKE_LATCH("TTLMonitorStateMutex");
 
@@ -148,6 +230,11 @@ private:
     mutable stdx::condition_variable _shuttingDownCV;
 
     bool _shuttingDown = false;
+
+    std::map<BacklogKey, Backlog> _backlogs;
+
+    // Computes the pacing delays, which grow while the node is under pressure.
+    BatchedDeletePacer _pacer;
 };
 
 }  // namespace mongo
@@ -32,6 +32,7 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/catalog/create_collection.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/index_build_entry_helpers.h"
 #include "mongo/db/index_builds_coordinator.h"
@@ -42,6 +43,8 @@
 #include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/fail_point.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -159,6 +162,17 @@ public:
         _client.createCollection(nss.toString());
     }
 
+    void createClusteredCollection(const NamespaceString& nss, Seconds expireAfterSeconds) {
+        BSONObj info;
+        ASSERT(_client.runCommand(
+            nss.db().toString(),
+            BSON("create" << nss.coll() << "clusteredIndex"
+                          << BSON("key" << BSON("_id" << 1) << "unique" << true)
+                          << "expireAfterSeconds" << durationCount<Seconds>(expireAfterSeconds)),
+            info))
+            << info;
+    }
+
 private:
     DBDirectClient _client;
     OperationContext* _opCtx;
@@ -520,5 +534,193 @@ TEST_F(TTLTest, TTLSubPassesStartRemovingFromNewTTLIndex) {
     ASSERT_EQ(getTTLSubPasses(), 5 + nInitialSubPasses);
 }
 
+TEST_F(TTLTest, TTLPacedSubPassesRecordExpiryBacklog) {
+    RAIIServerParameterControllerForTest featureFlagController("featureFlagBatchMultiDeletes",
+                                                               true);
+    RAIIServerParameterControllerForTest ttlBatchDeletesController("ttlMonitorBatchDeletes", true);
+    RAIIServerParameterControllerForTest ttlPaceDeletesController("ttlMonitorPaceDeletes", true);
+
+    // A full duty cycle without any pressure signals keeps the sub-passes from waiting between
+    // batches.
+    RAIIServerParameterControllerForTest dutyCycleController("ttlMonitorPacingDutyCyclePercent",
+                                                             100);
+    RAIIServerParameterControllerForTest replicationLagController(
+        "ttlMonitorPacingMaxReplicationLagSecs", 0);
+    RAIIServerParameterControllerForTest dirtyCacheController(
+        "ttlMonitorPacingMaxDirtyCachePercent", 0);
+
+    RAIIServerParameterControllerForTest ttlMonitorSubPassTargetSecsController(
+        "ttlMonitorSubPassTargetSecs", 0);
+    auto ttlIndexDeleteTargetDocs = 20;
+    RAIIServerParameterControllerForTest ttlIndexDeleteTargetDocsController(
+        "ttlIndexDeleteTargetDocs", ttlIndexDeleteTargetDocs);
+
+    SimpleClient client(opCtx());
+
+    NamespaceString nss("testDB.coll");
+
+    client.createCollection(nss);
+
+    createIndex(nss, BSON("x" << 1), "testIndexX", Seconds(1));
+    createIndex(nss, BSON("y" << 1), "testIndexY", Seconds(1));
+
+    int xExpiredDocs = ttlIndexDeleteTargetDocs * 3 - 1;
+    int yExpiredDocs = 1;
+    client.insertExpiredDocs(nss, "x", xExpiredDocs);
+    client.insertExpiredDocs(nss, "y", yExpiredDocs);
+
+    auto getBacklog = [&] {
+        BSONObjBuilder bob;
+        TTLMonitor::get(getGlobalServiceContext())->appendBacklogStats(&bob);
+        StringMap<BSONObj> backlog;
+        for (auto&& index : bob.obj()["indexes"].Obj()) {
+            ASSERT_EQ(index["ns"].String(), nss.ns());
+            backlog[index["index"].String()] = index.Obj().getOwned();
+        }
+        return backlog;
+    };
+
+    ASSERT_TRUE(doTTLSubPassForTest(opCtx()));
+    auto backlog = getBacklog();
+    ASSERT_EQ(backlog.size(), 2U);
+    ASSERT_TRUE(backlog["testIndexX"].hasField("overdueSince"));
+    ASSERT_EQ(backlog["testIndexX"]["deletedInLastBatch"].numberLong(), ttlIndexDeleteTargetDocs);
+    ASSERT_FALSE(backlog["testIndexY"].hasField("overdueSince"));
+    ASSERT_EQ(backlog["testIndexY"]["deletedInLastBatch"].numberLong(), yExpiredDocs);
+
+    while (doTTLSubPassForTest(opCtx())) {
+    }
+
+    ASSERT_EQ(client.count(nss), 0);
+    backlog = getBacklog();
+    ASSERT_FALSE(backlog["testIndexX"].hasField("overdueSince"));
+    ASSERT_EQ(backlog["testIndexX"]["deletedInPass"].numberLong(), xExpiredDocs);
+    ASSERT_EQ(backlog["testIndexY"]["deletedInPass"].numberLong(), yExpiredDocs);
+}
+
+TEST_F(TTLTest, TTLPacedSubPassesBackOffUnderPressure) {
+    RAIIServerParameterControllerForTest featureFlagController("featureFlagBatchMultiDeletes",
+                                                               true);
+    RAIIServerParameterControllerForTest ttlBatchDeletesController("ttlMonitorBatchDeletes", true);
+    RAIIServerParameterControllerForTest ttlPaceDeletesController("ttlMonitorPaceDeletes", true);
+
+    // Every batch is followed by a delay as long as the batch, which grows while the node is under
+    // pressure.
+    RAIIServerParameterControllerForTest dutyCycleController("ttlMonitorPacingDutyCyclePercent",
+                                                             50);
+    RAIIServerParameterControllerForTest ttlMonitorSubPassTargetSecsController(
+        "ttlMonitorSubPassTargetSecs", 0);
+    auto ttlIndexDeleteTargetDocs = 20;
+    RAIIServerParameterControllerForTest ttlIndexDeleteTargetDocsController(
+        "ttlIndexDeleteTargetDocs", ttlIndexDeleteTargetDocs);
+
+    SimpleClient client(opCtx());
+
+    NamespaceString nss("testDB.coll");
+
+    client.createCollection(nss);
+
+    createIndex(nss, BSON("x" << 1), "testIndexX", Seconds(1));
+
+    int xExpiredDocs = ttlIndexDeleteTargetDocs * 3 + 1;
+    client.insertExpiredDocs(nss, "x", xExpiredDocs);
+
+    auto getBackoff = [&] {
+        BSONObjBuilder bob;
+        TTLMonitor::get(getGlobalServiceContext())->appendBacklogStats(&bob);
+        return bob.obj()["pacingBackoff"].numberInt();
+    };
+    ASSERT_EQ(getBackoff(), 1);
+
+    {
+        FailPointEnableBlock fp("ttlMonitorPacingUnderPressure");
+        for (int i = 1; i <= 3; ++i) {
+            ASSERT_TRUE(doTTLSubPassForTest(opCtx()));
+            ASSERT_EQ(getBackoff(), 1 << i);
+        }
+    }
+
+    // The delays shrink back once the pressure is relieved.
+    ASSERT_FALSE(doTTLSubPassForTest(opCtx()));
+    ASSERT_EQ(getBackoff(), 4);
+    ASSERT_EQ(client.count(nss), 0);
+}
+
+TEST_F(TTLTest, TTLPacedSubPassesWaitUnderPressureWithFullDutyCycle) {
+    RAIIServerParameterControllerForTest featureFlagController("featureFlagBatchMultiDeletes",
+                                                               true);
+    RAIIServerParameterControllerForTest ttlBatchDeletesController("ttlMonitorBatchDeletes", true);
+    RAIIServerParameterControllerForTest ttlPaceDeletesController("ttlMonitorPaceDeletes", true);
+
+    // The duty cycle alone never waits, so any wait comes from the backoff, even for batches which
+    // complete in under a millisecond.
+    RAIIServerParameterControllerForTest dutyCycleController("ttlMonitorPacingDutyCyclePercent",
+                                                             100);
+    RAIIServerParameterControllerForTest ttlMonitorSubPassTargetSecsController(
+        "ttlMonitorSubPassTargetSecs", 0);
+    auto ttlIndexDeleteTargetDocs = 20;
+    RAIIServerParameterControllerForTest ttlIndexDeleteTargetDocsController(
+        "ttlIndexDeleteTargetDocs", ttlIndexDeleteTargetDocs);
+
+    SimpleClient client(opCtx());
+
+    NamespaceString nss("testDB.coll");
+
+    client.createCollection(nss);
+
+    createIndex(nss, BSON("x" << 1), "testIndexX", Seconds(1));
+
+    client.insertExpiredDocs(nss, "x", ttlIndexDeleteTargetDocs * 2 + 1);
+
+    auto getPacingDelayMillis = [] {
+        BSONObjBuilder bob;
+        globalMetricTree()->appendTo(bob);
+        return bob.obj()["metrics"]["ttl"]["pacingDelayMillis"].numberLong();
+    };
+
+    const auto pacingDelayMillisBefore = getPacingDelayMillis();
+    {
+        FailPointEnableBlock fp("ttlMonitorPacingUnderPressure");
+        ASSERT_TRUE(doTTLSubPassForTest(opCtx()));
+    }
+    ASSERT_GT(getPacingDelayMillis(), pacingDelayMillisBefore);
+}
+
+TEST_F(TTLTest, TTLSubPassesTruncateClusteredCollectionInBatches) {
+    RAIIServerParameterControllerForTest featureFlagController("featureFlagBatchMultiDeletes",
+                                                               true);
+    RAIIServerParameterControllerForTest ttlBatchDeletesController("ttlMonitorBatchDeletes", true);
+    RAIIServerParameterControllerForTest truncateRangeController("featureFlagTruncateRange", true);
+    RAIIServerParameterControllerForTest ttlTruncateController(
+        "ttlMonitorTruncateClusteredCollections", true);
+
+    // Every sub-pass stops after a single pass over the collection, which truncates batches of at
+    // most 'batchedDeletesTargetBatchDocs' until 'ttlIndexDeleteTargetDocs' are removed.
+    RAIIServerParameterControllerForTest ttlMonitorSubPassTargetSecsController(
+        "ttlMonitorSubPassTargetSecs", 0);
+    RAIIServerParameterControllerForTest batchDocsController("batchedDeletesTargetBatchDocs", 10);
+    auto ttlIndexDeleteTargetDocs = 25;
+    RAIIServerParameterControllerForTest ttlIndexDeleteTargetDocsController(
+        "ttlIndexDeleteTargetDocs", ttlIndexDeleteTargetDocs);
+
+    SimpleClient client(opCtx());
+
+    NamespaceString nss("testDB.clustered");
+    client.createClusteredCollection(nss, Seconds(1));
+
+    int expiredDocs = ttlIndexDeleteTargetDocs * 2 + 5;
+    client.insertExpiredDocs(nss, "_id", expiredDocs);
+    ASSERT_EQ(client.count(nss), expiredDocs);
+
+    ASSERT_TRUE(doTTLSubPassForTest(opCtx()));
+    ASSERT_EQ(client.count(nss), expiredDocs - ttlIndexDeleteTargetDocs);
+
+    ASSERT_TRUE(doTTLSubPassForTest(opCtx()));
+    ASSERT_EQ(client.count(nss), expiredDocs - 2 * ttlIndexDeleteTargetDocs);
+
+    ASSERT_FALSE(doTTLSubPassForTest(opCtx()));
+    ASSERT_EQ(client.count(nss), 0);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -185,6 +185,10 @@ TEST_F(SharedBufferTest, SharedBufferFragmentBuilder) {
     verifyFragment(fragment1, one);
     verifyFragment(fragment2, two);
     verifyFragment(fragment3, three);
+
+    // Discarded fragments are not counted, and growing allocated a second block.
+    ASSERT_EQ(builder.fragmentsBuilt(), 3);
+    ASSERT_EQ(builder.blocksAllocated(), 2);
 }
 
 }  // namespace
@@ -895,6 +895,46 @@ COMMON_EXECUTOR_TEST(ScheduleExhaustRemoteCommandSwallowsErrorsWhenMoreToComeFla
     joinExecutorThread();
 }
 
+COMMON_EXECUTOR_TEST(ScheduleExhaustRemoteCommandRunsCallbackForEveryResponseInOrder) {
+    TaskExecutor& executor = getExecutor();
+
+    std::vector<int> responsesSeen;
+    TaskExecutor::CallbackHandle cbHandle =
+        unittest::assertGet(executor.scheduleExhaustRemoteCommand(
+            kDummyRequest, [&](const TaskExecutor::RemoteCommandCallbackArgs& cbData) {
+                responsesSeen.push_back(cbData.response.data["n"].numberInt());
+            }));
+
+    launchExecutorThread();
+
+    auto net = getNet();
+
+    net->enterNetwork();
+    // Deliver every response before any of their callbacks can run.
+    ASSERT(net->hasReadyRequests());
+    NetworkInterfaceMock::NetworkOperationIterator noi = net->getNextReadyRequest();
+    const Date_t startTime = net->now();
+    const int numResponses = 5;
+    for (int i = 0; i < numResponses; ++i) {
+        net->scheduleResponse(
+            noi,
+            startTime,
+            RemoteCommandResponse(BSON("n" << i), Microseconds(), i + 1 < numResponses));
+    }
+    net->runUntil(startTime + Milliseconds(1));
+    ASSERT(!net->hasReadyRequests());
+    net->exitNetwork();
+
+    executor.wait(cbHandle);
+    ASSERT_EQUALS(responsesSeen.size(), static_cast<size_t>(numResponses));
+    for (int i = 0; i < numResponses; ++i) {
+        ASSERT_EQUALS(responsesSeen[i], i);
+    }
+
+    shutdownExecutorThread();
+    joinExecutorThread();
+}
+
 COMMON_EXECUTOR_TEST(
     ScheduleExhaustRemoteCommandFutureIsResolvedWhenMoreToComeFlagIsFalseOnFirstResponse) {
     TaskExecutor& executor = getExecutor();
@@ -33,6 +33,7 @@
 #include "mongo/executor/thread_pool_task_executor.h"
 
 #include <boost/optional.hpp>
+#include <deque>
 #include <iterator>
 #include <utility>
 
@@ -97,8 +98,16 @@ public:
     AtomicWord<unsigned> canceled{0U};
     WorkQueue::iterator iter;
     boost::optional<WorkQueue::iterator> exhaustIter;  // Used only in the exhaust path
+    // Used only in the exhaust path. The callbacks for the replies received so far which have not
+    // run yet, in the order in which the replies were received.
+    std::deque<CallbackFn> exhaustCallbacks;
+    // Used only in the exhaust path. Held while running the callbacks of the request, so that they
+    // run one at a time and in order, even though they are scheduled into the pool independently.
+    Mutex exhaustCallbacksMutex =
+        MONGO_MAKE_LATCH("ThreadPoolTaskExecutor::CallbackState::exhaustCallbacksMutex");
     Date_t readyDate;
     bool isNetworkOperation = false;
+    bool isExhaustOperation = false;
     bool isTimerOperation = false;
     AtomicWord<bool> isFinished{false};
     boost::optional<stdx::condition_variable> finishedCondition;
@@ -651,6 +660,13 @@ void ThreadPoolTaskExecutor::runCallback(std::shared_ptr<CallbackState> cbStateA
                       cbStateArg->canceled.load() ? kCallbackCanceledErrorStatus : Status::OK());
     invariant(!cbStateArg->isFinished.load());
     {
+        // The final reply of an exhaust request must not overtake the replies before it.
+        boost::optional<stdx::lock_guard<Latch>> exhaustCallbacksLk;
+        if (cbStateArg->isExhaustOperation) {
+            exhaustCallbacksLk.emplace(cbStateArg->exhaustCallbacksMutex);
+            runPendingExhaustCallbacks(cbStateArg, *exhaustCallbacksLk);
+        }
+
         // After running callback function, clear 'cbStateArg->callback' to release any resources
         // that might be held by this function object.
         // Swap 'cbStateArg->callback' with temporary copy before running callback for exception
@@ -688,6 +704,7 @@ StatusWith<TaskExecutor::CallbackHandle> ThreadPoolTaskExecutor::scheduleExhaust
         },
         baton);
     wq.front()->isNetworkOperation = true;
+    wq.front()->isExhaustOperation = true;
     stdx::unique_lock<Latch> lk(_mutex);
     auto swCbHandle = enqueueCallbackState_inlock(&_networkInProgressQueue, &wq);
     if (!swCbHandle.isOK())
@@ -735,6 +752,7 @@ StatusWith<TaskExecutor::CallbackHandle> ThreadPoolTaskExecutor::scheduleExhaust
                 // Release any resources the callback function is holding
                 TaskExecutor::CallbackFn callback = [](const CallbackArgs&) {};
                 std::swap(cbState->callback, callback);
+                cbState->exhaustCallbacks.clear();
 
                 _networkInProgressQueue.erase(cbState->iter);
                 cbState->exhaustErased.store(1);
@@ -747,15 +765,14 @@ StatusWith<TaskExecutor::CallbackHandle> ThreadPoolTaskExecutor::scheduleExhaust
                 return;
             }
 
-            // Swap the callback function with the new one
             CallbackFn newCb = [cb, scheduledRequest, response](const CallbackArgs& cbData) {
                 remoteCommandFinished(cbData, cb, scheduledRequest, response);
             };
-            swap(cbState->callback, newCb);
 
             // If this is the last response, invoke the non-exhaust path. This will mark cbState as
             // finished and remove the task from _networkInProgressQueue
             if (!response.moreToCome) {
+                swap(cbState->callback, newCb);
                 _networkInProgressQueue.erase(cbState->iter);
                 cbState->exhaustErased.store(1);
 
@@ -767,6 +784,9 @@ StatusWith<TaskExecutor::CallbackHandle> ThreadPoolTaskExecutor::scheduleExhaust
                 return;
             }
 
+            // Replies can arrive faster than their callbacks run, so each one is queued rather
+            // than replacing the callback of the reply before it.
+            cbState->exhaustCallbacks.push_back(std::move(newCb));
             scheduleExhaustIntoPool_inlock(cbState, std::move(lk));
         },
         baton);
@@ -821,26 +841,11 @@ void ThreadPoolTaskExecutor::scheduleExhaustIntoPool_inlock(std::shared_ptr<Call
 
 void ThreadPoolTaskExecutor::runCallbackExhaust(std::shared_ptr<CallbackState> cbState,
                                                 WorkQueue::iterator expectedExhaustIter) {
-    CallbackHandle cbHandle;
-    setCallbackForHandle(&cbHandle, cbState);
-    CallbackArgs args(this,
-                      std::move(cbHandle),
-                      cbState->canceled.load() ? kCallbackCanceledErrorStatus : Status::OK());
-
     if (!cbState->isFinished.load()) {
-        TaskExecutor::CallbackFn callback = [](const CallbackArgs&) {};
-        {
-            auto lk = stdx::lock_guard(_mutex);
-            std::swap(cbState->callback, callback);
-        }
-        callback(std::move(args));
-
-        // Leave the empty callback function if the request has been marked canceled or finished
-        // while running the callback to avoid leaking resources.
-        if (!cbState->canceled.load() && !cbState->isFinished.load()) {
-            auto lk = stdx::lock_guard(_mutex);
-            std::swap(callback, cbState->callback);
-        }
+        // Every reply schedules one run, but a run may find that the callbacks of the replies
+        // before it are still queued, or that an earlier run already ran its own callback.
+        stdx::lock_guard<Latch> exhaustCallbacksLk(cbState->exhaustCallbacksMutex);
+        runPendingExhaustCallbacks(cbState, exhaustCallbacksLk);
     }
 
     // Do not mark cbState as finished. It will be marked as finished on the last reply which is
@@ -864,6 +869,28 @@ void ThreadPoolTaskExecutor::runCallbackExhaust(std::shared_ptr<CallbackState> c
     }
 }
 
+void ThreadPoolTaskExecutor::runPendingExhaustCallbacks(std::shared_ptr<CallbackState> cbState,
+                                                        WithLock) {
+    while (true) {
+        TaskExecutor::CallbackFn callback;
+        {
+            auto lk = stdx::lock_guard(_mutex);
+            if (cbState->exhaustCallbacks.empty()) {
+                return;
+            }
+            callback = std::move(cbState->exhaustCallbacks.front());
+            cbState->exhaustCallbacks.pop_front();
+        }
+
+        CallbackHandle cbHandle;
+        setCallbackForHandle(&cbHandle, cbState);
+        callback(CallbackArgs(this,
+                              std::move(cbHandle),
+                              cbState->canceled.load() ? kCallbackCanceledErrorStatus
+                                                       : Status::OK()));
+    }
+}
+
 bool ThreadPoolTaskExecutor::hasTasks() {
     stdx::unique_lock<Latch> lk(_mutex);
     if (!_poolInProgressQueue.empty() || !_networkInProgressQueue.empty() ||
@@ -37,6 +37,7 @@
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/transport/baton.h"
+#include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/hierarchical_acquisition.h"
 
@@ -201,6 +202,12 @@ private:
     void runCallbackExhaust(std::shared_ptr<CallbackState> cbState,
                             WorkQueue::iterator expectedExhaustIter);
 
+    /**
+     * Runs, in order, the callbacks queued for the replies of the exhaust request specified by
+     * "cbState". Must be called with cbState's 'exhaustCallbacksMutex' held.
+     */
+    void runPendingExhaustCallbacks(std::shared_ptr<CallbackState> cbState, WithLock);
+
     bool _inShutdown_inlock() const;
     void _setState_inlock(State newState);
     stdx::unique_lock<Latch> _join(stdx::unique_lock<Latch> lk);
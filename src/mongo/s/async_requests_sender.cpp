@@ -42,6 +42,8 @@
 #include "mongo/s/client/shard_registry.h"
 #include "mongo/s/grid.h"
 #include "mongo/s/hedge_options_util.h"
+#include "mongo/s/host_latency_tracker.h"
+#include "mongo/s/mongos_server_parameters_gen.h"
 #include "mongo/transport/baton.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/util/assert_util.h"
@@ -203,6 +205,10 @@ auto AsyncRequestsSender::RemoteData::scheduleRequest()
         })
         .thenRunOn(*_ars->_subBaton)
         .then([this](auto&& hostAndPorts) {
+            if (gPreferLowTailLatencyHosts.load()) {
+                HostLatencyTracker::get(getGlobalServiceContext())
+                    ->preferLowTailLatencyHost(&hostAndPorts);
+            }
             _shardHostAndPort.emplace(hostAndPorts.front());
             return scheduleRemoteCommand(std::move(hostAndPorts));
         })
@@ -253,6 +259,13 @@ auto AsyncRequestsSender::RemoteData::handleResponse(RemoteCommandOnAnyCallbackA
     -> SemiFuture<RemoteCommandOnAnyCallbackArgs> {
     if (rcr.response.target) {
         _shardHostAndPort = rcr.response.target;
+
+        // Failures to reach the host often return early, so only the latency of the commands which
+        // the host answered says how quickly it serves them.
+        if (rcr.response.isOK() && rcr.response.elapsed) {
+            HostLatencyTracker::get(getGlobalServiceContext())
+                ->recordLatency(*rcr.response.target, *rcr.response.elapsed);
+        }
     }
 
     auto status = rcr.response.status;
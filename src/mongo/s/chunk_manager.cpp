@@ -32,6 +32,10 @@
 
 #include "mongo/s/chunk_manager.h"
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/matcher/extensions_callback_noop.h"
 #include "mongo/db/query/collation/collation_index_key.h"
@@ -40,6 +44,7 @@
 #include "mongo/db/query/query_planner_common.h"
 #include "mongo/db/storage/key_string.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/endian.h"
 #include "mongo/s/chunk_writes_tracker.h"
 #include "mongo/s/mongod_and_mongos_server_parameters_gen.h"
 #include "mongo/s/shard_invalidated_for_targeting_exception.h"
@@ -112,6 +117,25 @@ std::vector<std::shared_ptr<ChunkInfo>> flatten(const std::vector<ChunkType>& ch
     return flattened;
 }
 
+void checkChunksAreContiguous(const ChunkInfo& chunk, const ChunkInfo& nextChunk) {
+    const auto& lastMax = chunk.getMax();
+    const auto& rangeMin = nextChunk.getMin();
+    if (SimpleBSONObjComparator::kInstance.evaluate(lastMax == rangeMin)) {
+        return;
+    }
+
+    if (SimpleBSONObjComparator::kInstance.evaluate(lastMax < rangeMin))
+        uasserted(ErrorCodes::ConflictingOperationInProgress,
+                  str::stream() << "Gap exists in the routing table between chunks "
+                                << chunk.getRange().toString() << " and "
+                                << nextChunk.getRange().toString());
+    else
+        uasserted(ErrorCodes::ConflictingOperationInProgress,
+                  str::stream() << "Overlap exists in the routing table between chunks "
+                                << chunk.getRange().toString() << " and "
+                                << nextChunk.getRange().toString());
+}
+
 void validateChunkIsNotOlderThan(const std::shared_ptr<ChunkInfo>& chunk,
                                  const ChunkVersion& version) {
     uassert(ErrorCodes::ConflictingOperationInProgress,
@@ -130,143 +154,206 @@ void validateChunkIsNotOlderThan(const std::shared_ptr<ChunkInfo>& chunk,
 
 }  // namespace
 
+void ChunkMaxKeyIndex::reserve(size_t numKeys) {
+    _prefixes.reserve(numKeys);
+    _ends.reserve(numKeys);
+}
+
+void ChunkMaxKeyIndex::pushBack(const std::string& maxKeyString) {
+    _prefixes.push_back(_prefixOf(maxKeyString.data(), maxKeyString.size()));
+    _keys.insert(_keys.end(), maxKeyString.begin(), maxKeyString.end());
+    _ends.push_back(_keys.size());
+}
+
+void ChunkMaxKeyIndex::popBack() {
+    invariant(!_prefixes.empty());
+    _prefixes.pop_back();
+    _ends.pop_back();
+    _keys.resize(_ends.empty() ? 0 : _ends.back());
+}
+
+void ChunkMaxKeyIndex::append(const ChunkMaxKeyIndex& other, size_t begin, size_t end) {
+    invariant(begin <= end && end <= other.size());
+    if (begin == end) {
+        return;
+    }
+
+    const size_t sourceStart = begin == 0 ? 0 : other._ends[begin - 1];
+    const size_t destinationStart = _keys.size();
+    _prefixes.insert(
+        _prefixes.end(), other._prefixes.begin() + begin, other._prefixes.begin() + end);
+    _keys.insert(_keys.end(),
+                 other._keys.begin() + sourceStart,
+                 other._keys.begin() + other._ends[end - 1]);
+    for (size_t pos = begin; pos < end; ++pos) {
+        _ends.push_back(other._ends[pos] - sourceStart + destinationStart);
+    }
+}
+
+size_t ChunkMaxKeyIndex::upperBound(const std::string& keyString, size_t begin) const {
+    const auto prefix = _prefixOf(keyString.data(), keyString.size());
+    size_t low = begin;
+    size_t high = size();
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (_compare(mid, prefix, keyString.data(), keyString.size()) > 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low;
+}
+
+size_t ChunkMaxKeyIndex::lowerBound(const std::string& keyString, size_t begin) const {
+    const auto prefix = _prefixOf(keyString.data(), keyString.size());
+    size_t low = begin;
+    size_t high = size();
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (_compare(mid, prefix, keyString.data(), keyString.size()) >= 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low;
+}
+
+uint64_t ChunkMaxKeyIndex::_prefixOf(const char* data, size_t size) {
+    uint64_t prefix = 0;
+    std::memcpy(&prefix, data, std::min(size, sizeof(prefix)));
+    return endian::bigToNative(prefix);
+}
+
+int ChunkMaxKeyIndex::_compare(size_t pos, uint64_t prefix, const char* data, size_t size) const {
+    if (_prefixes[pos] != prefix) {
+        return _prefixes[pos] < prefix ? -1 : 1;
+    }
+
+    // Same ordering as comparing the keys as std::strings, which is how ChunkInfo compares them.
+    const size_t start = pos == 0 ? 0 : _ends[pos - 1];
+    const size_t keySize = _ends[pos] - start;
+    const int cmp = std::memcmp(_keys.data() + start, data, std::min(keySize, size));
+    if (cmp != 0) {
+        return cmp;
+    }
+    return keySize < size ? -1 : (keySize > size ? 1 : 0);
+}
+
 ChunkMap::ChunkMap(OID epoch, const Timestamp& timestamp, size_t initialCapacity)
     : _collectionVersion({epoch, timestamp}, {0, 0}) {
-    _chunkMap.reserve(initialCapacity);
+    _segments.reserve(initialCapacity / kMinSegmentSize + 1);
+    _segmentMaxKeyIndex.reserve(initialCapacity / kMinSegmentSize + 1);
 }
 
 ShardVersionMap ChunkMap::constructShardVersionMap() const {
     ShardVersionMap shardVersions;
-    ChunkVector::const_iterator current = _chunkMap.cbegin();
-
-    boost::optional<BSONObj> firstMin = boost::none;
-    boost::optional<BSONObj> lastMax = boost::none;
-
-    while (current != _chunkMap.cend()) {
-        const auto& firstChunkInRange = *current;
-        const auto& currentRangeShardId = firstChunkInRange->getShardIdAt(boost::none);
-
-        // Tracks the max shard version for the shard on which the current range will reside
-        auto shardVersionIt = shardVersions.find(currentRangeShardId);
-        if (shardVersionIt == shardVersions.end()) {
-            shardVersionIt = shardVersions
-                                 .emplace(std::piecewise_construct,
-                                          std::forward_as_tuple(currentRangeShardId),
-                                          std::forward_as_tuple(_collectionVersion.epoch(),
-                                                                _collectionVersion.getTimestamp()))
-                                 .first;
-        }
 
-        auto& maxShardVersion = shardVersionIt->second.shardVersion;
-
-        current =
-            std::find_if(current,
-                         _chunkMap.cend(),
-                         [&currentRangeShardId, &maxShardVersion](const auto& currentChunk) {
-                             if (currentChunk->getShardIdAt(boost::none) != currentRangeShardId)
-                                 return true;
-
-                             if (maxShardVersion.isOlderThan(currentChunk->getLastmod()))
-                                 maxShardVersion = currentChunk->getLastmod();
-
-                             return false;
-                         });
-
-        const auto rangeLast = *std::prev(current);
-
-        const auto& rangeMin = firstChunkInRange->getMin();
-        const auto& rangeMax = rangeLast->getMax();
-
-        // Check the continuity of the chunks map
-        if (lastMax && !SimpleBSONObjComparator::kInstance.evaluate(*lastMax == rangeMin)) {
-            if (SimpleBSONObjComparator::kInstance.evaluate(*lastMax < rangeMin))
-                uasserted(ErrorCodes::ConflictingOperationInProgress,
-                          str::stream() << "Gap exists in the routing table between chunks "
-                                        << findIntersectingChunk(*lastMax)->getRange().toString()
-                                        << " and " << rangeLast->getRange().toString());
-            else
-                uasserted(ErrorCodes::ConflictingOperationInProgress,
-                          str::stream() << "Overlap exists in the routing table between chunks "
-                                        << findIntersectingChunk(*lastMax)->getRange().toString()
-                                        << " and " << rangeLast->getRange().toString());
+    // The chunks within each segment were checked for continuity when the segment was built, so
+    // only the boundaries between segments remain to be checked.
+    const ChunkInfo* lastChunk = nullptr;
+    for (const auto& segment : _segments) {
+        const auto& firstChunk = *segment->chunks.front();
+        if (lastChunk &&
+            lastChunk->getShardIdAt(boost::none) != firstChunk.getShardIdAt(boost::none)) {
+            checkChunksAreContiguous(*lastChunk, firstChunk);
         }
+        lastChunk = segment->chunks.back().get();
+
+        for (const auto& [shardId, segmentShardVersion] : segment->shardVersions) {
+            // Tracks the max shard version for the shard
+            auto shardVersionIt = shardVersions.find(shardId);
+            if (shardVersionIt == shardVersions.end()) {
+                shardVersionIt = shardVersions
+                                     .emplace(std::piecewise_construct,
+                                              std::forward_as_tuple(shardId),
+                                              std::forward_as_tuple(
+                                                  _collectionVersion.epoch(),
+                                                  _collectionVersion.getTimestamp()))
+                                     .first;
+            }
 
-        if (!firstMin)
-            firstMin = rangeMin;
-
-        lastMax = rangeMax;
+            auto& maxShardVersion = shardVersionIt->second.shardVersion;
+            if (maxShardVersion.isOlderThan(segmentShardVersion))
+                maxShardVersion = segmentShardVersion;
 
-        // If a shard has chunks it must have a shard version, otherwise we have an invalid chunk
-        // somewhere, which should have been caught at chunk load time
-        invariant(maxShardVersion.isSet());
+            // If a shard has chunks it must have a shard version, otherwise we have an invalid
+            // chunk somewhere, which should have been caught at chunk load time
+            invariant(maxShardVersion.isSet());
+        }
     }
 
-    if (!_chunkMap.empty()) {
+    if (!_segments.empty()) {
         invariant(!shardVersions.empty());
-        invariant(firstMin.has_value());
-        invariant(lastMax.has_value());
 
-        checkAllElementsAreOfType(MinKey, firstMin.value());
-        checkAllElementsAreOfType(MaxKey, lastMax.value());
+        checkAllElementsAreOfType(MinKey, _segments.front()->chunks.front()->getMin());
+        checkAllElementsAreOfType(MaxKey, _segments.back()->chunks.back()->getMax());
     }
 
     return shardVersions;
 }
 
-void ChunkMap::appendChunk(const std::shared_ptr<ChunkInfo>& chunk) {
-    appendChunkTo(_chunkMap, chunk);
-    const auto chunkVersion = chunk->getLastmod();
-    if (_collectionVersion.isOlderThan(chunkVersion)) {
-        _collectionVersion = chunkVersion;
-    }
-}
-
 std::shared_ptr<ChunkInfo> ChunkMap::findIntersectingChunk(const BSONObj& shardKey) const {
-    const auto it = _findIntersectingChunk(shardKey);
+    const auto pos = _findIntersectingChunk(shardKey);
 
-    if (it != _chunkMap.end())
-        return *it;
+    if (pos.segment < _segments.size())
+        return _segments[pos.segment]->chunks[pos.chunk];
 
     return std::shared_ptr<ChunkInfo>();
 }
 
+std::vector<ChunkInfo*> ChunkMap::findIntersectingChunks(
+    const std::vector<std::string>& sortedKeyStrings) const {
+    std::vector<ChunkInfo*> chunks;
+    chunks.reserve(sortedKeyStrings.size());
+
+    Position pos{0, 0};
+    ChunkInfo* chunk = nullptr;
+    for (const auto& keyString : sortedKeyStrings) {
+        if (!chunk || chunk->getMaxKeyString() <= keyString) {
+            pos = _upperBound(keyString, pos);
+            chunk = pos.segment < _segments.size() ? _segments[pos.segment]->chunks[pos.chunk].get()
+                                                   : nullptr;
+        }
+        chunks.push_back(chunk);
+    }
+
+    return chunks;
+}
+
 ChunkMap ChunkMap::createMerged(
     const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks) const {
-    size_t chunkMapIndex = 0;
-    size_t changedChunkIndex = 0;
-
     ChunkMap updatedChunkMap(
-        getVersion().epoch(), getVersion().getTimestamp(), _chunkMap.size() + changedChunks.size());
+        getVersion().epoch(), getVersion().getTimestamp(), size() + changedChunks.size());
 
-    while (chunkMapIndex < _chunkMap.size() || changedChunkIndex < changedChunks.size()) {
-        if (chunkMapIndex >= _chunkMap.size()) {
-            validateChunkIsNotOlderThan(changedChunks[changedChunkIndex], getVersion());
-            updatedChunkMap.appendChunk(changedChunks[changedChunkIndex++]);
-            continue;
-        }
-
-        if (changedChunkIndex >= changedChunks.size()) {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
-            continue;
-        }
-
-        auto overlap = _chunkMap[chunkMapIndex]->getRange().overlaps(
-            changedChunks[changedChunkIndex]->getRange());
+    // Position of the first chunk of this map which hasn't been carried over yet.
+    Position carriedOver{0, 0};
 
-        if (overlap) {
-            auto& changedChunk = changedChunks[changedChunkIndex++];
-            auto& chunkInfo = _chunkMap[chunkMapIndex];
+    for (const auto& changedChunk : changedChunks) {
+        // The chunks which end at or before the start of the changed chunk are unaffected by it, so
+        // they are carried over, sharing the segments they fill entirely.
+        const auto firstOverlapping =
+            _upperBound(ShardKeyPattern::toKeyString(changedChunk->getMin()), carriedOver);
+        updatedChunkMap._appendChunks(*this, carriedOver, firstOverlapping);
+        carriedOver = firstOverlapping;
 
-            auto bytesInReplacedChunk = chunkInfo->getWritesTracker()->getBytesWritten();
-            changedChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
+        if (firstOverlapping.segment < _segments.size()) {
+            auto& chunkInfo = _segments[firstOverlapping.segment]->chunks[firstOverlapping.chunk];
 
-            validateChunkIsNotOlderThan(changedChunk, getVersion());
-            updatedChunkMap.appendChunk(changedChunk);
-        } else {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
+            if (chunkInfo->getRange().overlaps(changedChunk->getRange())) {
+                auto bytesInReplacedChunk = chunkInfo->getWritesTracker()->getBytesWritten();
+                changedChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
+            }
         }
+
+        validateChunkIsNotOlderThan(changedChunk, getVersion());
+        updatedChunkMap._appendChunk(changedChunk);
     }
 
+    updatedChunkMap._appendChunks(*this, carriedOver, _end());
+    updatedChunkMap._sealOpenSegment();
+
     return updatedChunkMap;
 }
 
@@ -274,50 +361,216 @@ BSONObj ChunkMap::toBSON() const {
     BSONObjBuilder builder;
 
     getVersion().serialize("startingVersion"_sd, &builder);
-    builder.append("chunkCount", static_cast<int64_t>(_chunkMap.size()));
+    builder.append("chunkCount", static_cast<int64_t>(size()));
 
     {
         BSONArrayBuilder arrayBuilder(builder.subarrayStart("chunks"_sd));
-        for (const auto& chunk : _chunkMap) {
+        forEach([&arrayBuilder](const auto& chunk) {
             arrayBuilder.append(chunk->toString());
-        }
+            return true;
+        });
     }
 
     return builder.obj();
 }
 
-ChunkMap::ChunkVector::const_iterator ChunkMap::_findIntersectingChunk(const BSONObj& shardKey,
-                                                                       bool isMaxInclusive) const {
-    auto shardKeyString = ShardKeyPattern::toKeyString(shardKey);
-
-    if (!isMaxInclusive) {
-        return std::lower_bound(_chunkMap.begin(),
-                                _chunkMap.end(),
-                                shardKey,
-                                [&shardKeyString](const auto& chunkInfo, const BSONObj& shardKey) {
-                                    return chunkInfo->getMaxKeyString() < shardKeyString;
-                                });
-    } else {
-        return std::upper_bound(_chunkMap.begin(),
-                                _chunkMap.end(),
-                                shardKey,
-                                [&shardKeyString](const BSONObj& shardKey, const auto& chunkInfo) {
-                                    return shardKeyString < chunkInfo->getMaxKeyString();
-                                });
+ChunkMap::Position ChunkMap::_upperBound(const std::string& keyString,
+                                         Position begin,
+                                         bool isMaxInclusive) const {
+    const auto segment = isMaxInclusive
+        ? _segmentMaxKeyIndex.upperBound(keyString, begin.segment)
+        : _segmentMaxKeyIndex.lowerBound(keyString, begin.segment);
+    if (segment == _segments.size()) {
+        return _end();
     }
+
+    // The last chunk of the segment is past 'keyString', so the position is within the segment.
+    const auto& maxKeyIndex = _segments[segment]->maxKeyIndex;
+    const size_t firstChunk = segment == begin.segment ? begin.chunk : 0;
+    return {segment,
+            isMaxInclusive ? maxKeyIndex.upperBound(keyString, firstChunk)
+                           : maxKeyIndex.lowerBound(keyString, firstChunk)};
+}
+
+ChunkMap::Position ChunkMap::_findIntersectingChunk(const BSONObj& shardKey,
+                                                    bool isMaxInclusive) const {
+    return _upperBound(ShardKeyPattern::toKeyString(shardKey), {0, 0}, isMaxInclusive);
 }
 
-std::pair<ChunkMap::ChunkVector::const_iterator, ChunkMap::ChunkVector::const_iterator>
-ChunkMap::_overlappingBounds(const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const {
+std::pair<ChunkMap::Position, ChunkMap::Position> ChunkMap::_overlappingBounds(
+    const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const {
     const auto itMin = _findIntersectingChunk(min);
     const auto itMax = [&]() {
         auto it = _findIntersectingChunk(max, isMaxInclusive);
-        return it == _chunkMap.end() ? it : ++it;
+        return it.segment == _segments.size() ? it : _next(it);
     }();
 
     return {itMin, itMax};
 }
 
+void ChunkMap::_appendChunk(const std::shared_ptr<ChunkInfo>& chunk) {
+    const auto lastChunk = _lastChunk();
+    if (lastChunk && chunk->getRange().overlaps(lastChunk->getRange())) {
+        // Of two overlapping chunks only the newer one is kept.
+        if (lastChunk->getLastmod().isOlderThan(chunk->getLastmod())) {
+            if (!_openSegment || _openSegment->chunks.empty()) {
+                _reopenLastSegment();
+            }
+            _openSegment->chunks.back() = chunk;
+            _openSegment->maxKeyIndex.popBack();
+            _openSegment->maxKeyIndex.pushBack(chunk->getMaxKeyString());
+        }
+    } else {
+        auto& segment = _openSegmentWithRoom();
+        segment.chunks.push_back(chunk);
+        segment.maxKeyIndex.pushBack(chunk->getMaxKeyString());
+    }
+
+    const auto chunkVersion = chunk->getLastmod();
+    if (_collectionVersion.isOlderThan(chunkVersion)) {
+        _collectionVersion = chunkVersion;
+    }
+}
+
+void ChunkMap::_appendChunks(const ChunkMap& other, Position begin, Position end) {
+    for (; begin.segment < end.segment; begin = {begin.segment + 1, 0}) {
+        const auto& segment = other._segments[begin.segment];
+        const auto openSegmentSize = _openSegment ? _openSegment->chunks.size() : 0;
+        const auto lastChunk = _lastChunk();
+
+        // A segment is shared unless only part of it is carried over, its first chunk may be
+        // replaced by the last chunk appended, or it is merged into a small open segment.
+        if (begin.chunk > 0 ||
+            (lastChunk && segment->chunks.front()->getRange().overlaps(lastChunk->getRange())) ||
+            (openSegmentSize > 0 && openSegmentSize < kMinSegmentSize)) {
+            _copyChunks(other, *segment, begin.chunk, segment->chunks.size());
+            continue;
+        }
+
+        _sealOpenSegment();
+        _segmentMaxKeyIndex.pushBack(segment->chunks.back()->getMaxKeyString());
+        _size += segment->chunks.size();
+        _segments.push_back(segment);
+
+        // No chunk of 'other' is newer than its collection version.
+        if (_collectionVersion.isOlderThan(other._collectionVersion)) {
+            _collectionVersion = other._collectionVersion;
+        }
+    }
+
+    if (begin.segment < other._segments.size()) {
+        _copyChunks(other, *other._segments[begin.segment], begin.chunk, end.chunk);
+    }
+}
+
+void ChunkMap::_copyChunks(const ChunkMap& other,
+                           const Segment& segment,
+                           size_t begin,
+                           size_t end) {
+    // The first chunks may overlap the last chunk appended, if it is a changed chunk which replaces
+    // them, in which case _appendChunk() decides which one to keep. The chunks after them cannot
+    // overlap anything already appended.
+    while (begin < end) {
+        const auto lastChunk = _lastChunk();
+        if (!lastChunk || !segment.chunks[begin]->getRange().overlaps(lastChunk->getRange())) {
+            break;
+        }
+        _appendChunk(segment.chunks[begin++]);
+    }
+    if (begin == end) {
+        return;
+    }
+
+    while (begin < end) {
+        auto& openSegment = _openSegmentWithRoom();
+        const auto count = std::min(end - begin, kMaxSegmentSize - openSegment.chunks.size());
+        openSegment.chunks.insert(openSegment.chunks.end(),
+                                  segment.chunks.begin() + begin,
+                                  segment.chunks.begin() + begin + count);
+        openSegment.maxKeyIndex.append(segment.maxKeyIndex, begin, begin + count);
+        begin += count;
+    }
+
+    // No chunk of 'other' is newer than its collection version.
+    if (_collectionVersion.isOlderThan(other._collectionVersion)) {
+        _collectionVersion = other._collectionVersion;
+    }
+}
+
+const ChunkInfo* ChunkMap::_lastChunk() const {
+    if (_openSegment && !_openSegment->chunks.empty()) {
+        return _openSegment->chunks.back().get();
+    }
+    if (!_segments.empty()) {
+        return _segments.back()->chunks.back().get();
+    }
+    return nullptr;
+}
+
+ChunkMap::Segment& ChunkMap::_openSegmentWithRoom() {
+    if (!_openSegment) {
+        _openSegment = std::make_shared<Segment>();
+    } else if (_openSegment->chunks.size() == kMaxSegmentSize) {
+        // Only seal the front of a full segment, so that the open segment keeps enough chunks for
+        // the segments which follow to be shared rather than merged into it.
+        const auto full = std::move(_openSegment);
+        const auto sealedSize = kMaxSegmentSize - kMinSegmentSize;
+
+        _openSegment = std::make_shared<Segment>();
+        _openSegment->chunks.assign(full->chunks.begin(), full->chunks.begin() + sealedSize);
+        _openSegment->maxKeyIndex.append(full->maxKeyIndex, 0, sealedSize);
+        _sealOpenSegment();
+
+        _openSegment = std::make_shared<Segment>();
+        _openSegment->chunks.assign(full->chunks.begin() + sealedSize, full->chunks.end());
+        _openSegment->maxKeyIndex.append(full->maxKeyIndex, sealedSize, kMaxSegmentSize);
+    }
+    return *_openSegment;
+}
+
+void ChunkMap::_reopenLastSegment() {
+    invariant(!_openSegment || _openSegment->chunks.empty());
+
+    _openSegment = std::make_shared<Segment>(*_segments.back());
+    _openSegment->shardVersions.clear();
+
+    _size -= _segments.back()->chunks.size();
+    _segmentMaxKeyIndex.popBack();
+    _segments.pop_back();
+}
+
+void ChunkMap::_sealOpenSegment() {
+    if (!_openSegment) {
+        return;
+    }
+
+    auto segment = std::move(_openSegment);
+    if (segment->chunks.empty()) {
+        return;
+    }
+
+    stdx::unordered_map<ShardId, ChunkVersion, ShardId::Hasher> shardVersions;
+    for (size_t i = 0; i < segment->chunks.size(); ++i) {
+        const auto& chunk = segment->chunks[i];
+        const auto& shardId = chunk->getShardIdAt(boost::none);
+
+        // Check the continuity of the chunks map wherever the owning shard changes
+        if (i > 0 && segment->chunks[i - 1]->getShardIdAt(boost::none) != shardId) {
+            checkChunksAreContiguous(*segment->chunks[i - 1], *chunk);
+        }
+
+        auto [it, inserted] = shardVersions.emplace(shardId, chunk->getLastmod());
+        if (!inserted && it->second.isOlderThan(chunk->getLastmod())) {
+            it->second = chunk->getLastmod();
+        }
+    }
+    segment->shardVersions.assign(shardVersions.begin(), shardVersions.end());
+
+    _segmentMaxKeyIndex.pushBack(segment->chunks.back()->getMaxKeyString());
+    _size += segment->chunks.size();
+    _segments.push_back(std::move(segment));
+}
+
 ShardVersionTargetingInfo::ShardVersionTargetingInfo(const OID& epoch, const Timestamp& timestamp)
     : shardVersion({epoch, timestamp}, {0, 0}) {}
 
@@ -361,6 +614,46 @@ void RoutingTableHistory::setAllShardsRefreshed() {
     }
 }
 
+std::vector<Chunk> ChunkManager::findIntersectingChunksWithSimpleCollation(
+    const std::vector<BSONObj>& shardKeys) const {
+    std::vector<std::string> keyStrings;
+    keyStrings.reserve(shardKeys.size());
+    for (const auto& shardKey : shardKeys) {
+        keyStrings.push_back(ShardKeyPattern::toKeyString(shardKey));
+    }
+
+    std::vector<size_t> order(shardKeys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return keyStrings[lhs] < keyStrings[rhs];
+    });
+
+    std::vector<std::string> sortedKeyStrings;
+    sortedKeyStrings.reserve(order.size());
+    for (const auto i : order) {
+        sortedKeyStrings.push_back(std::move(keyStrings[i]));
+    }
+
+    const auto sortedChunks = _rt->optRt->findIntersectingChunks(sortedKeyStrings);
+
+    std::vector<ChunkInfo*> chunkInfos(shardKeys.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        uassert(ErrorCodes::ShardKeyNotFound,
+                str::stream() << "Cannot target single shard using key " << shardKeys[order[i]]
+                              << " for namespace " << _rt->optRt->nss(),
+                sortedChunks[i]);
+        chunkInfos[order[i]] = sortedChunks[i];
+    }
+
+    std::vector<Chunk> chunks;
+    chunks.reserve(chunkInfos.size());
+    for (auto chunkInfo : chunkInfos) {
+        chunks.emplace_back(*chunkInfo, _clusterTime);
+    }
+
+    return chunks;
+}
+
 Chunk ChunkManager::findIntersectingChunk(const BSONObj& shardKey,
                                           const BSONObj& collation,
                                           bool bypassIsFieldHashedCheck) const {
@@ -65,20 +65,99 @@ struct ShardVersionTargetingInfo {
 // shard is currently marked as needing a catalog cache refresh (stale).
 using ShardVersionMap = stdx::unordered_map<ShardId, ShardVersionTargetingInfo, ShardId::Hasher>;
 
+/**
+ * Flat index over the KeyString encodings of the max bounds of the chunks in a ChunkMap, kept in the
+ * same order as the chunks. The encodings are stored back to back in a single buffer, alongside the
+ * big-endian value of their first 8 bytes, so that targeting binary searches contiguous memory and
+ * resolves most comparisons with a single integer compare, only dereferencing the ChunkInfo it
+ * lands on.
+ */
+class ChunkMaxKeyIndex {
+public:
+    size_t size() const {
+        return _prefixes.size();
+    }
+
+    void reserve(size_t numKeys);
+
+    void pushBack(const std::string& maxKeyString);
+    void popBack();
+
+    /**
+     * Appends the keys in positions [begin, end) of 'other'.
+     */
+    void append(const ChunkMaxKeyIndex& other, size_t begin, size_t end);
+
+    /**
+     * Returns the position of the first key in [begin, size()) which is greater than 'keyString'.
+     */
+    size_t upperBound(const std::string& keyString, size_t begin = 0) const;
+
+    /**
+     * Returns the position of the first key in [begin, size()) which is not less than 'keyString'.
+     */
+    size_t lowerBound(const std::string& keyString, size_t begin = 0) const;
+
+private:
+    static uint64_t _prefixOf(const char* data, size_t size);
+
+    /**
+     * Compares the key at 'pos' with the key 'data' of length 'size' whose prefix is 'prefix'.
+     */
+    int _compare(size_t pos, uint64_t prefix, const char* data, size_t size) const;
+
+    // The big-endian value of the first 8 bytes of each key, padded with zeroes. Comparing two of
+    // these orders the keys the same way as comparing the keys themselves, unless they are equal.
+    std::vector<uint64_t> _prefixes;
+
+    // The end offset of each key in '_keys'. Each key starts where the previous one ends.
+    std::vector<size_t> _ends;
+
+    std::vector<char> _keys;
+};
+
 /**
  * This class serves as a Facade around how the mapping of ranges to chunks is represented. It also
  * provides a simpler, high-level interface for domain specific operations without exposing the
  * underlying implementation.
+ *
+ * The chunks are stored in immutable segments of consecutive chunks. The maps created by
+ * createMerged() share the segments which none of the changed chunks touch with the map they were
+ * created from, so a refresh only copies the segments it changes and the list of segments, and the
+ * routing tables held by in-flight operations share most of their memory with the newer ones.
  */
 class ChunkMap {
     // Vector of chunks ordered by max key.
     using ChunkVector = std::vector<std::shared_ptr<ChunkInfo>>;
 
+    struct Segment {
+        ChunkVector chunks;
+
+        // Index of the max bounds of 'chunks', used for targeting.
+        ChunkMaxKeyIndex maxKeyIndex;
+
+        // Max chunk version of each shard which owns chunks in the segment.
+        std::vector<std::pair<ShardId, ChunkVersion>> shardVersions;
+    };
+
+    // Position of a chunk in the map. The position past the last chunk is {_segments.size(), 0}.
+    struct Position {
+        size_t segment;
+        size_t chunk;
+    };
+
 public:
+    // Bounds on the number of chunks in the segments built by createMerged(). Once a segment being
+    // built reaches kMaxSegmentSize chunks, all but its last kMinSegmentSize chunks are sealed. A
+    // segment being built with fewer than kMinSegmentSize chunks absorbs the next segment rather
+    // than being sealed this small, so only the first and last segments may be smaller.
+    static constexpr size_t kMaxSegmentSize = 1024;
+    static constexpr size_t kMinSegmentSize = kMaxSegmentSize / 4;
+
     ChunkMap(OID epoch, const Timestamp& timestamp, size_t initialCapacity = 0);
 
     size_t size() const {
-        return _chunkMap.size();
+        return _size;
     }
 
     ChunkVersion getVersion() const {
@@ -87,12 +166,9 @@ public:
 
     template <typename Callable>
     void forEach(Callable&& handler, const BSONObj& shardKey = BSONObj()) const {
-        auto it = shardKey.isEmpty() ? _chunkMap.begin() : _findIntersectingChunk(shardKey);
-
-        for (; it != _chunkMap.end(); ++it) {
-            if (!handler(*it))
-                break;
-        }
+        _forEachInRange(shardKey.isEmpty() ? Position{0, 0} : _findIntersectingChunk(shardKey),
+                        _end(),
+                        std::forward<Callable>(handler));
     }
 
     template <typename Callable>
@@ -101,29 +177,101 @@ public:
                                  bool isMaxInclusive,
                                  Callable&& handler) const {
         const auto bounds = _overlappingBounds(min, max, isMaxInclusive);
-
-        for (auto it = bounds.first; it != bounds.second; ++it) {
-            if (!handler(*it))
-                break;
-        }
+        _forEachInRange(bounds.first, bounds.second, std::forward<Callable>(handler));
     }
 
     ShardVersionMap constructShardVersionMap() const;
     std::shared_ptr<ChunkInfo> findIntersectingChunk(const BSONObj& shardKey) const;
 
-    void appendChunk(const std::shared_ptr<ChunkInfo>& chunk);
+    /**
+     * Returns the chunk containing each of the shard keys whose KeyString encodings are given in
+     * ascending order. The chunks are walked alongside the keys, so each key only searches the
+     * chunks past the one containing the previous key, and consecutive keys which fall within the
+     * same chunk need no search at all.
+     */
+    std::vector<ChunkInfo*> findIntersectingChunks(
+        const std::vector<std::string>& sortedKeyStrings) const;
 
     ChunkMap createMerged(const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks) const;
 
     BSONObj toBSON() const;
 
+    /**
+     * Returns the segments of the map, so that tests can check which ones maps share.
+     */
+    const auto& getSegments_ForTest() const {
+        return _segments;
+    }
+
 private:
-    ChunkVector::const_iterator _findIntersectingChunk(const BSONObj& shardKey,
-                                                       bool isMaxInclusive = true) const;
-    std::pair<ChunkVector::const_iterator, ChunkVector::const_iterator> _overlappingBounds(
-        const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const;
+    template <typename Callable>
+    void _forEachInRange(Position begin, Position end, Callable&& handler) const {
+        for (; begin.segment < _segments.size() && begin.segment <= end.segment;
+             begin = {begin.segment + 1, 0}) {
+            const auto& chunks = _segments[begin.segment]->chunks;
+            const auto last = begin.segment == end.segment ? end.chunk : chunks.size();
+            for (auto chunk = begin.chunk; chunk < last; ++chunk) {
+                if (!handler(chunks[chunk]))
+                    return;
+            }
+        }
+    }
+
+    Position _end() const {
+        return {_segments.size(), 0};
+    }
+
+    Position _next(Position pos) const {
+        return ++pos.chunk < _segments[pos.segment]->chunks.size() ? pos
+                                                                    : Position{pos.segment + 1, 0};
+    }
+
+    /**
+     * Returns the position of the first chunk at or after 'begin' whose max bound is greater than
+     * (or, if 'isMaxInclusive' is false, not less than) 'keyString'.
+     */
+    Position _upperBound(const std::string& keyString,
+                         Position begin = {0, 0},
+                         bool isMaxInclusive = true) const;
+
+    Position _findIntersectingChunk(const BSONObj& shardKey, bool isMaxInclusive = true) const;
+    std::pair<Position, Position> _overlappingBounds(const BSONObj& min,
+                                                     const BSONObj& max,
+                                                     bool isMaxInclusive) const;
+
+    /**
+     * The functions below build the map, appending to an open segment which is sealed, and from
+     * then on shared, once full or once the build is done.
+     */
+    void _appendChunk(const std::shared_ptr<ChunkInfo>& chunk);
+
+    /**
+     * Appends the chunks in [begin, end) of 'other', sharing its segments which the range covers
+     * entirely where possible.
+     */
+    void _appendChunks(const ChunkMap& other, Position begin, Position end);
+
+    /**
+     * Copies the chunks in positions [begin, end) of 'segment', which belongs to 'other', together
+     * with their index entries.
+     */
+    void _copyChunks(const ChunkMap& other, const Segment& segment, size_t begin, size_t end);
+
+    const ChunkInfo* _lastChunk() const;
+    Segment& _openSegmentWithRoom();
+    void _reopenLastSegment();
+    void _sealOpenSegment();
 
-    ChunkVector _chunkMap;
+    std::vector<std::shared_ptr<const Segment>> _segments;
+
+    // Index of the max bounds of the last chunks of '_segments', used for targeting.
+    ChunkMaxKeyIndex _segmentMaxKeyIndex;
+
+    // Total number of chunks in '_segments'
+    size_t _size{0};
+
+    // Segment being appended to, only set while the map is being built
+    std::shared_ptr<Segment> _openSegment;
 
     // Max version across all chunks
     ChunkVersion _collectionVersion;
@@ -256,6 +404,11 @@ public:
         return _chunkMap.findIntersectingChunk(shardKey);
     }
 
+    std::vector<ChunkInfo*> findIntersectingChunks(
+        const std::vector<std::string>& sortedKeyStrings) const {
+        return _chunkMap.findIntersectingChunks(sortedKeyStrings);
+    }
+
     /**
      * Returns the ids of all shards on which the collection has any chunks.
      */
@@ -606,6 +759,16 @@ public:
         return findIntersectingChunk(shardKey, CollationSpec::kSimpleSpec);
     }
 
+    /**
+     * Same as findIntersectingChunkWithSimpleCollation, for a batch of shard keys extracted from
+     * documents, in any order. Returns the chunks in the same order as the keys.
+     *
+     * The keys are sorted and merged with the chunks, so that the routing table is walked once for
+     * the whole batch rather than searched for every key.
+     */
+    std::vector<Chunk> findIntersectingChunksWithSimpleCollation(
+        const std::vector<BSONObj>& shardKeys) const;
+
     /**
      * Finds the shard id of the shard that owns the chunk minKey belongs to, assuming the simple
      * collation because shard keys do not support non-simple collations.
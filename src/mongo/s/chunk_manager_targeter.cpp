@@ -331,33 +331,85 @@ BSONObj ChunkManagerTargeter::extractBucketsShardKeyFromTimeseriesDoc(
 
 ShardEndpoint ChunkManagerTargeter::targetInsert(OperationContext* opCtx,
                                                  const BSONObj& doc) const {
-    BSONObj shardKey;
+    if (!_cm.isSharded()) {
+        return _targetDbPrimary();
+    }
 
-    if (_cm.isSharded()) {
-        const auto& shardKeyPattern = _cm.getShardKeyPattern();
-        if (_isRequestOnTimeseriesViewNamespace) {
-            auto tsFields = _cm.getTimeseriesFields();
-            tassert(5743701, "Missing timeseriesFields on buckets collection", tsFields);
-            shardKey = extractBucketsShardKeyFromTimeseriesDoc(
-                doc, shardKeyPattern, tsFields->getTimeseriesOptions());
-        } else {
-            shardKey = shardKeyPattern.extractShardKeyFromDoc(doc);
+    const auto shardKey = _extractShardKeyForInsert(doc);
+
+    // The shard key would only be empty after extraction if we encountered an error case, such as
+    // the shard key possessing an array value or array descendants. If the shard key presented to
+    // the targeter was empty, we would emplace the missing fields, and the extracted key here would
+    // *not* be empty.
+    uassert(ErrorCodes::ShardKeyNotFound,
+            "Shard key cannot contain array values or array descendants.",
+            !shardKey.isEmpty());
+
+    return uassertStatusOK(_targetShardKey(shardKey, CollationSpec::kSimpleSpec));
+}
+
+std::vector<boost::optional<ShardEndpoint>> ChunkManagerTargeter::targetInserts(
+    OperationContext* opCtx, const std::vector<BSONObj>& docs) const {
+    if (!_cm.isSharded()) {
+        return std::vector<boost::optional<ShardEndpoint>>(docs.size(), _targetDbPrimary());
+    }
+
+    std::vector<boost::optional<ShardEndpoint>> endpoints(docs.size());
+
+    // Documents whose shard key cannot be extracted keep no endpoint, so that targetInsert reports
+    // the error for each of them
+    std::vector<BSONObj> shardKeys;
+    std::vector<size_t> docIndexes;
+    shardKeys.reserve(docs.size());
+    docIndexes.reserve(docs.size());
+    for (size_t i = 0; i < docs.size(); ++i) {
+        try {
+            auto shardKey = _extractShardKeyForInsert(docs[i]);
+            if (!shardKey.isEmpty()) {
+                shardKeys.push_back(std::move(shardKey));
+                docIndexes.push_back(i);
+            }
+        } catch (const DBException&) {
         }
+    }
 
-        // The shard key would only be empty after extraction if we encountered an error case, such
-        // as the shard key possessing an array value or array descendants. If the shard key
-        // presented to the targeter was empty, we would emplace the missing fields, and the
-        // extracted key here would *not* be empty.
-        uassert(ErrorCodes::ShardKeyNotFound,
-                "Shard key cannot contain array values or array descendants.",
-                !shardKey.isEmpty());
+    std::vector<Chunk> chunks;
+    try {
+        chunks = _cm.findIntersectingChunksWithSimpleCollation(shardKeys);
+    } catch (const ExceptionFor<ErrorCodes::ShardKeyNotFound>&) {
+        return endpoints;
+    }
+
+    // All the documents which go to the same shard share the same endpoint
+    std::map<ShardId, ShardEndpoint> shardEndpoints;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const auto& shardId = chunks[i].getShardId();
+        auto it = shardEndpoints.find(shardId);
+        if (it == shardEndpoints.end()) {
+            it = shardEndpoints
+                     .emplace(shardId,
+                              ShardEndpoint(shardId, _cm.getVersion(shardId), boost::none))
+                     .first;
+        }
+        endpoints[docIndexes[i]] = it->second;
     }
 
-    // Target the shard key or database primary
-    if (!shardKey.isEmpty()) {
-        return uassertStatusOK(_targetShardKey(shardKey, CollationSpec::kSimpleSpec));
+    return endpoints;
+}
+
+BSONObj ChunkManagerTargeter::_extractShardKeyForInsert(const BSONObj& doc) const {
+    const auto& shardKeyPattern = _cm.getShardKeyPattern();
+    if (_isRequestOnTimeseriesViewNamespace) {
+        auto tsFields = _cm.getTimeseriesFields();
+        tassert(5743701, "Missing timeseriesFields on buckets collection", tsFields);
+        return extractBucketsShardKeyFromTimeseriesDoc(
+            doc, shardKeyPattern, tsFields->getTimeseriesOptions());
     }
 
+    return shardKeyPattern.extractShardKeyFromDoc(doc);
+}
+
+ShardEndpoint ChunkManagerTargeter::_targetDbPrimary() const {
     // TODO (SERVER-51070): Remove the boost::none when the config server can support shardVersion
     // in commands
     return ShardEndpoint(
@@ -77,6 +77,9 @@ public:
 
     ShardEndpoint targetInsert(OperationContext* opCtx, const BSONObj& doc) const override;
 
+    std::vector<boost::optional<ShardEndpoint>> targetInserts(
+        OperationContext* opCtx, const std::vector<BSONObj>& docs) const override;
+
     std::vector<ShardEndpoint> targetUpdate(OperationContext* opCtx,
                                             const BatchItemRef& itemRef) const override;
 
@@ -134,6 +137,18 @@ private:
         const BSONObj& query,
         const BSONObj& collation) const;
 
+    /**
+     * Extracts the shard key of a document to insert into the sharded collection. Returns an empty
+     * object if the document has an array value in or under any of the shard key fields.
+     */
+    BSONObj _extractShardKeyForInsert(const BSONObj& doc) const;
+
+    /**
+     * Returns the ShardEndpoint for writes to an unsharded collection, which go to the primary
+     * shard of the database.
+     */
+    ShardEndpoint _targetDbPrimary() const;
+
     /**
      * Returns a ShardEndpoint for an exact shard key query.
      *
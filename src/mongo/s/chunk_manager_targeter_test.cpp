@@ -120,6 +120,42 @@ TEST_F(ChunkManagerTargeterTest, TargetInsertWithRangePrefixHashedShardKey) {
                        ErrorCodes::ShardKeyNotFound);
 }
 
+TEST_F(ChunkManagerTargeterTest, TargetInsertsInBulkMatchesTargetingEachInsert) {
+    std::vector<BSONObj> splitPoints = {
+        BSON("a.b" << BSONNULL), BSON("a.b" << -100), BSON("a.b" << 0), BSON("a.b" << 100)};
+    auto cmTargeter = prepare(BSON("a.b" << 1 << "c.d"
+                                         << "hashed"),
+                              splitPoints);
+
+    // Documents in no particular order, several of them falling within the same chunk
+    std::vector<BSONObj> docs;
+    for (int i = 0; i < 100; i++) {
+        docs.push_back(BSON("a" << BSON("b" << (i * 37) % 400 - 200) << "c" << BSON("d" << i)));
+    }
+    docs.push_back(BSONObj());
+    docs.push_back(fromjson("{a: [1,2]}"));
+    docs.push_back(fromjson("{a: {b: 1000}, c: null, d: {}}"));
+
+    const auto endpoints = cmTargeter.targetInserts(operationContext(), docs);
+    ASSERT_EQ(docs.size(), endpoints.size());
+
+    for (size_t i = 0; i < docs.size(); i++) {
+        if (i == docs.size() - 2) {
+            // Documents which cannot be targeted are left to targetInsert, which reports the error
+            ASSERT_FALSE(endpoints[i]);
+            ASSERT_THROWS_CODE(cmTargeter.targetInsert(operationContext(), docs[i]),
+                               DBException,
+                               ErrorCodes::ShardKeyNotFound);
+            continue;
+        }
+
+        const auto expected = cmTargeter.targetInsert(operationContext(), docs[i]);
+        ASSERT(endpoints[i]);
+        ASSERT_EQ(expected.shardName, endpoints[i]->shardName);
+        ASSERT_EQ(*expected.shardVersion, *endpoints[i]->shardVersion);
+    }
+}
+
 TEST_F(ChunkManagerTargeterTest, TargetInsertsWithVaryingHashedPrefixAndConstantRangedSuffix) {
     // Create 4 chunks and 4 shards such that shardId '0' has chunk [MinKey, -2^62), '1' has chunk
     // [-2^62, 0), '2' has chunk ['0', 2^62) and '3' has chunk [2^62, MaxKey).
@@ -27,6 +27,8 @@
  *    it in the license file.
  */
 
+#include <algorithm>
+
 #include "mongo/s/chunk_manager.h"
 #include "mongo/unittest/unittest.h"
 
@@ -134,6 +136,49 @@ TEST_F(ChunkMapTest, TestIntersectingChunk) {
                                                        BSON("a" << 100)));
 }
 
+TEST_F(ChunkMapTest, TestIntersectingChunksOfSortedKeys) {
+    const OID epoch = OID::gen();
+    ChunkMap chunkMap{epoch, Timestamp(1, 1)};
+    ChunkVersion version({epoch, Timestamp(1, 1)}, {1, 0});
+
+    auto newChunkMap = chunkMap.createMerged(
+        {std::make_shared<ChunkInfo>(
+             ChunkType{uuid(),
+                       ChunkRange{getShardKeyPattern().globalMin(), BSON("a" << 0)},
+                       version,
+                       kThisShard}),
+
+         std::make_shared<ChunkInfo>(
+             ChunkType{uuid(), ChunkRange{BSON("a" << 0), BSON("a" << 100)}, version, kThisShard}),
+
+         std::make_shared<ChunkInfo>(
+             ChunkType{uuid(),
+                       ChunkRange{BSON("a" << 100), getShardKeyPattern().globalMax()},
+                       version,
+                       kThisShard})});
+
+    const std::vector<BSONObj> shardKeys{BSON("a" << -5),
+                                         BSON("a" << -1),
+                                         BSON("a" << 0),
+                                         BSON("a" << 50),
+                                         BSON("a" << 99),
+                                         BSON("a" << 100),
+                                         BSON("a" << 1000)};
+    std::vector<std::string> keyStrings;
+    for (const auto& shardKey : shardKeys) {
+        keyStrings.push_back(ShardKeyPattern::toKeyString(shardKey));
+    }
+
+    const auto intersectingChunks = newChunkMap.findIntersectingChunks(keyStrings);
+    ASSERT_EQ(intersectingChunks.size(), shardKeys.size());
+    for (size_t i = 0; i < shardKeys.size(); ++i) {
+        ASSERT(intersectingChunks[i]);
+        ASSERT(intersectingChunks[i]->containsKey(shardKeys[i]))
+            << shardKeys[i] << " " << intersectingChunks[i]->toString();
+        ASSERT_EQ(intersectingChunks[i], newChunkMap.findIntersectingChunk(shardKeys[i]).get());
+    }
+}
+
 TEST_F(ChunkMapTest, TestEnumerateOverlappingChunks) {
     const OID epoch = OID::gen();
     ChunkMap chunkMap{epoch, Timestamp(1, 1)};
@@ -167,4 +212,185 @@ TEST_F(ChunkMapTest, TestEnumerateOverlappingChunks) {
     ASSERT_EQ(count, 3);
 }
 
+TEST_F(ChunkMapTest, TestIntersectingChunkAfterIncrementalRefresh) {
+    const OID epoch = OID::gen();
+    ChunkMap chunkMap{epoch, Timestamp(1, 1)};
+    ChunkVersion version({epoch, Timestamp(1, 1)}, {1, 0});
+
+    std::vector<std::shared_ptr<ChunkInfo>> initialChunks;
+    auto lastMax = getShardKeyPattern().globalMin();
+    for (int i = 10; i <= 100; i += 10) {
+        initialChunks.push_back(std::make_shared<ChunkInfo>(
+            ChunkType{uuid(), ChunkRange{lastMax, BSON("a" << i)}, version, kThisShard}));
+        version.incMinor();
+        lastMax = BSON("a" << i);
+    }
+    initialChunks.push_back(std::make_shared<ChunkInfo>(ChunkType{
+        uuid(), ChunkRange{lastMax, getShardKeyPattern().globalMax()}, version, kThisShard}));
+    auto initialChunkMap = chunkMap.createMerged(initialChunks);
+    ASSERT_EQ(initialChunkMap.size(), 11);
+
+    // Split [20, 30) at 25 and merge [50, 60) with [60, 70).
+    version.incMajor();
+    std::vector<std::shared_ptr<ChunkInfo>> changedChunks;
+    changedChunks.push_back(std::make_shared<ChunkInfo>(
+        ChunkType{uuid(), ChunkRange{BSON("a" << 20), BSON("a" << 25)}, version, kThisShard}));
+    version.incMinor();
+    changedChunks.push_back(std::make_shared<ChunkInfo>(
+        ChunkType{uuid(), ChunkRange{BSON("a" << 25), BSON("a" << 30)}, version, kThisShard}));
+    version.incMinor();
+    changedChunks.push_back(std::make_shared<ChunkInfo>(
+        ChunkType{uuid(), ChunkRange{BSON("a" << 50), BSON("a" << 70)}, version, kThisShard}));
+    auto updatedChunkMap = initialChunkMap.createMerged(changedChunks);
+    ASSERT_EQ(updatedChunkMap.size(), 11);
+    ASSERT_EQ(updatedChunkMap.getVersion(), version);
+
+    // Every key must land on the chunk which contains it, which must be the same chunk reached by
+    // walking the map in order.
+    for (int key = -5; key <= 105; ++key) {
+        const auto shardKey = BSON("a" << key);
+        auto chunk = updatedChunkMap.findIntersectingChunk(shardKey);
+        ASSERT(chunk);
+        ASSERT(chunk->containsKey(shardKey)) << shardKey << " " << chunk->toString();
+
+        std::shared_ptr<ChunkInfo> expected;
+        updatedChunkMap.forEach([&](const auto& chunkInfo) {
+            if (chunkInfo->containsKey(shardKey)) {
+                expected = chunkInfo;
+                return false;
+            }
+            return true;
+        });
+        ASSERT_EQ(chunk, expected);
+    }
+
+    auto chunk = updatedChunkMap.findIntersectingChunk(BSON("a" << 60));
+    ASSERT_BSONOBJ_EQ(chunk->getMin(), BSON("a" << 50));
+    ASSERT_BSONOBJ_EQ(chunk->getMax(), BSON("a" << 70));
+}
+
+TEST_F(ChunkMapTest, IncrementalRefreshOfManyChunksLeavesPreviousMapIntact) {
+    const OID epoch = OID::gen();
+    ChunkVersion version({epoch, Timestamp(1, 1)}, {1, 0});
+    const int numChunks = 10 * ChunkMap::kMaxSegmentSize;
+
+    std::vector<std::shared_ptr<ChunkInfo>> chunks;
+    for (int i = 0; i < numChunks; ++i) {
+        const auto min = i == 0 ? getShardKeyPattern().globalMin() : BSON("a" << i * 10);
+        const auto max =
+            i == numChunks - 1 ? getShardKeyPattern().globalMax() : BSON("a" << (i + 1) * 10);
+        chunks.push_back(std::make_shared<ChunkInfo>(
+            ChunkType{uuid(), ChunkRange{min, max}, version, kThisShard}));
+        version.incMinor();
+    }
+    const auto initialChunkMap = ChunkMap{epoch, Timestamp(1, 1)}.createMerged(chunks);
+    ASSERT_EQ(initialChunkMap.size(), numChunks);
+
+    // Split a chunk in the middle of the map and move the last chunk.
+    const ShardId otherShard("otherShard");
+    const int splitChunk = numChunks / 2;
+    version.incMajor();
+    std::vector<std::shared_ptr<ChunkInfo>> changedChunks;
+    changedChunks.push_back(std::make_shared<ChunkInfo>(
+        ChunkType{uuid(),
+                  ChunkRange{BSON("a" << splitChunk * 10), BSON("a" << splitChunk * 10 + 5)},
+                  version,
+                  kThisShard}));
+    version.incMinor();
+    changedChunks.push_back(std::make_shared<ChunkInfo>(
+        ChunkType{uuid(),
+                  ChunkRange{BSON("a" << splitChunk * 10 + 5), BSON("a" << (splitChunk + 1) * 10)},
+                  version,
+                  kThisShard}));
+    version.incMinor();
+    changedChunks.push_back(std::make_shared<ChunkInfo>(
+        ChunkType{uuid(), chunks.back()->getRange(), version, otherShard}));
+
+    const auto updatedChunkMap = initialChunkMap.createMerged(changedChunks);
+    ASSERT_EQ(updatedChunkMap.size(), numChunks + 1);
+    ASSERT_EQ(updatedChunkMap.getVersion(), version);
+
+    const auto shardVersions = updatedChunkMap.constructShardVersionMap();
+    ASSERT_EQ(shardVersions.size(), 2U);
+    ASSERT_EQ(shardVersions.at(otherShard).shardVersion, version);
+
+    for (int key = 0; key < numChunks * 10; key += 5) {
+        const auto shardKey = BSON("a" << key);
+        const auto chunk = updatedChunkMap.findIntersectingChunk(shardKey);
+        ASSERT(chunk->containsKey(shardKey)) << shardKey << " " << chunk->toString();
+
+        // The map which was refreshed still routes with the chunks it was built from.
+        ASSERT_EQ(initialChunkMap.findIntersectingChunk(shardKey), chunks[key / 10]);
+    }
+
+    // The segments which hold none of the changed chunks are shared by both maps rather than
+    // copied. The segment which follows the split one may be merged into it.
+    const auto& initialSegments = initialChunkMap.getSegments_ForTest();
+    const auto& updatedSegments = updatedChunkMap.getSegments_ForTest();
+    ASSERT_GT(initialSegments.size(), 3U);
+    const auto holdsChunk = [](const auto& segment, const std::shared_ptr<ChunkInfo>& chunk) {
+        return std::find(segment->chunks.begin(), segment->chunks.end(), chunk) !=
+            segment->chunks.end();
+    };
+    size_t numShared = 0;
+    for (size_t i = 0; i < initialSegments.size(); ++i) {
+        const auto& segment = initialSegments[i];
+        if (holdsChunk(segment, chunks[splitChunk]) ||
+            (i > 0 && holdsChunk(initialSegments[i - 1], chunks[splitChunk])) ||
+            holdsChunk(segment, chunks.back())) {
+            continue;
+        }
+        ASSERT(std::find(updatedSegments.begin(), updatedSegments.end(), segment) !=
+               updatedSegments.end())
+            << "segment " << i << " was copied";
+        ASSERT_GT(segment.use_count(), 1);
+        ++numShared;
+    }
+    ASSERT_GTE(numShared, initialSegments.size() - 3);
+
+    int count = 0;
+    BSONObj lastMax = getShardKeyPattern().globalMin();
+    updatedChunkMap.forEach([&](const auto& chunk) {
+        ASSERT_BSONOBJ_EQ(chunk->getMin(), lastMax);
+        lastMax = chunk->getMax();
+        ++count;
+        return true;
+    });
+    ASSERT_EQ(count, numChunks + 1);
+}
+
+TEST(ChunkMaxKeyIndexTest, KeysWithCommonPrefixes) {
+    // Keys sharing their first 8 bytes must be told apart by the full comparison.
+    std::vector<std::string> keys;
+    for (const auto& value : {"aaaaaaaaaaaa1", "aaaaaaaaaaaa2", "aaaaaaaaaaaa2x", "aaaaaaab"}) {
+        keys.push_back(ShardKeyPattern::toKeyString(BSON("a" << value)));
+    }
+
+    ChunkMaxKeyIndex index;
+    for (const auto& key : keys) {
+        index.pushBack(key);
+    }
+    index.pushBack("tmp");
+    index.popBack();
+    ASSERT_EQ(index.size(), keys.size());
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(index.lowerBound(keys[i]), i);
+        ASSERT_EQ(index.upperBound(keys[i]), i + 1);
+    }
+    ASSERT_EQ(index.upperBound(ShardKeyPattern::toKeyString(BSON("a" << "aaaaaaaaaaaa"))), 0U);
+    ASSERT_EQ(index.upperBound(ShardKeyPattern::toKeyString(BSON("a" << "z"))), keys.size());
+
+    // Appending a slice of another index preserves the keys and their order.
+    ChunkMaxKeyIndex sliced;
+    sliced.pushBack(keys[0]);
+    sliced.append(index, 2, 4);
+    ASSERT_EQ(sliced.size(), 3U);
+    ASSERT_EQ(sliced.lowerBound(keys[0]), 0U);
+    ASSERT_EQ(sliced.lowerBound(keys[1]), 1U);
+    ASSERT_EQ(sliced.lowerBound(keys[2]), 1U);
+    ASSERT_EQ(sliced.lowerBound(keys[3]), 2U);
+    ASSERT_EQ(sliced.upperBound(keys[3], 1), 3U);
+}
+
 }  // namespace mongo
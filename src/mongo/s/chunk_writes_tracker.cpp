@@ -44,6 +44,10 @@ uint64_t ChunkWritesTracker::clearBytesWritten() {
     return _bytesWritten.swap(0);
 }
 
+uint64_t ChunkWritesTracker::clearNumOperations() {
+    return _numOperations.swap(0);
+}
+
 bool ChunkWritesTracker::shouldSplit(uint64_t maxChunkSize) {
     if (_isLockedForSplitting) {
         return false;
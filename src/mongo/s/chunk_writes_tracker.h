@@ -62,6 +62,28 @@ public:
      */
     uint64_t clearBytesWritten();
 
+    /**
+     * Records one more write operation which targeted the chunk. Used by the balancer to estimate
+     * the load each chunk puts on its shard.
+     */
+    void addOperation() {
+        _numOperations.fetchAndAdd(1);
+    }
+
+    /**
+     * Returns the number of write operations which targeted the chunk since the last time they
+     * were cleared.
+     */
+    uint64_t getNumOperations() {
+        return _numOperations.loadRelaxed();
+    }
+
+    /**
+     * Sets the number of operations in the tracker to zero and returns the number of operations in
+     * the tracker prior to clearing it.
+     */
+    uint64_t clearNumOperations();
+
     /**
      * Returns whether or not this chunk is ready to be split based on the
      * maximum allowable size of a chunk.
@@ -86,6 +108,12 @@ private:
      */
     AtomicWord<unsigned long long> _bytesWritten{0};
 
+    /**
+     * The number of write operations which targeted this chunk. May be modified concurrently by
+     * several threads.
+     */
+    AtomicWord<unsigned long long> _numOperations{0};
+
     /**
      * Protects _splitState when starting a split.
      */
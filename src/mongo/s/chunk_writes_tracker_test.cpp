@@ -64,6 +64,16 @@ TEST(ChunkWritesTrackerTest, ClearBytesWrittenReturnsBytesWrittenBeforeClearing)
     ASSERT_EQ(previousBytesWritten, bytesToAdd);
 }
 
+TEST(ChunkWritesTrackerTest, ClearNumOperationsReturnsNumOperationsBeforeClearing) {
+    ChunkWritesTracker wt;
+    ASSERT_EQ(wt.getNumOperations(), 0ull);
+    wt.addOperation();
+    wt.addOperation();
+    ASSERT_EQ(wt.getNumOperations(), 2ull);
+    ASSERT_EQ(wt.clearNumOperations(), 2ull);
+    ASSERT_EQ(wt.getNumOperations(), 0ull);
+}
+
 TEST(ChunkWritesTrackerTest, ShouldSplitReturnsTrueWithBytesWrittenAndMaxChunkSizeZero) {
     ChunkWritesTracker wt;
     wt.addBytesWritten(4ull);
@@ -38,6 +38,8 @@
 #include "mongo/db/not_primary_error_tracker.h"
 #include "mongo/s/chunk_manager_targeter.h"
 #include "mongo/s/grid.h"
+#include "mongo/s/query/cluster_query_result_cache.h"
+#include "mongo/util/scopeguard.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kSharding
 
@@ -50,6 +52,12 @@ void write(OperationContext* opCtx,
            BatchWriteExecStats* stats,
            BatchedCommandResponse* response,
            boost::optional<OID> targetEpoch) {
+    ON_BLOCK_EXIT([&] {
+        if (ClusterQueryResultCache::isEnabled()) {
+            ClusterQueryResultCache::get(opCtx)->onWrite(request.getNS());
+        }
+    });
+
     if (request.hasEncryptionInformation()) {
         FLEBatchResult result = processFLEBatch(opCtx, request, stats, response, targetEpoch);
         if (result == FLEBatchResult::kProcessed) {
@@ -58,11 +58,13 @@
 #include "mongo/s/commands/strategy.h"
 #include "mongo/s/grid.h"
 #include "mongo/s/multi_statement_transaction_requests_sender.h"
+#include "mongo/s/query/cluster_query_result_cache.h"
 #include "mongo/s/session_catalog_router.h"
 #include "mongo/s/stale_exception.h"
 #include "mongo/s/transaction_router.h"
 #include "mongo/s/transaction_router_resource_yielder.h"
 #include "mongo/s/would_change_owning_shard_exception.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kSharding
@@ -467,6 +469,11 @@ public:
              const BSONObj& cmdObj,
              BSONObjBuilder& result) override {
         const NamespaceString nss(CommandHelpers::parseNsCollectionRequired(dbName, cmdObj));
+        ON_BLOCK_EXIT([&] {
+            if (ClusterQueryResultCache::isEnabled()) {
+                ClusterQueryResultCache::get(opCtx)->onWrite(nss);
+            }
+        });
 
         if (processFLEFindAndModify(opCtx, cmdObj, result) == FLEBatchResult::kProcessed) {
             return true;
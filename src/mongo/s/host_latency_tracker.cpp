@@ -0,0 +1,118 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/s/host_latency_tracker.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+namespace {
+
+const auto getHostLatencyTracker = ServiceContext::declareDecoration<HostLatencyTracker>();
+
+}  // namespace
+
+HostLatencyTracker* HostLatencyTracker::get(ServiceContext* serviceContext) {
+    return &getHostLatencyTracker(serviceContext);
+}
+
+void HostLatencyTracker::recordLatency(const HostAndPort& host, Microseconds latency, Date_t now) {
+    auto estimate = _find(host);
+    if (!estimate) {
+        std::unique_lock lk(_mutex);  // NOLINT
+        auto& entry = _estimates[host];
+        if (!entry) {
+            entry = std::make_shared<Estimate>();
+        }
+        estimate = entry;
+    }
+
+    // Concurrent updates of the same host may overwrite each other, which only drops samples from
+    // the estimate.
+    const auto sample = durationCount<Microseconds>(latency);
+    const auto smoothed = estimate->smoothedMicros.load();
+    if (smoothed < 0) {
+        estimate->deviationMicros.store(sample / 2);
+        estimate->smoothedMicros.store(sample);
+    } else {
+        const auto deviation = estimate->deviationMicros.load();
+        estimate->deviationMicros.store((3 * deviation + std::llabs(smoothed - sample)) / 4);
+        estimate->smoothedMicros.store((7 * smoothed + sample) / 8);
+    }
+    estimate->lastUpdateMillis.store(now.toMillisSinceEpoch());
+}
+
+boost::optional<Microseconds> HostLatencyTracker::getTailLatency(const HostAndPort& host,
+                                                                 Date_t now) const {
+    auto estimate = _find(host);
+    if (!estimate) {
+        return boost::none;
+    }
+
+    const auto smoothed = estimate->smoothedMicros.load();
+    const auto lastUpdate = Date_t::fromMillisSinceEpoch(estimate->lastUpdateMillis.load());
+    if (smoothed < 0 || now - lastUpdate > kMaxEstimateAge) {
+        return boost::none;
+    }
+    return Microseconds(smoothed + 4 * estimate->deviationMicros.load());
+}
+
+void HostLatencyTracker::preferLowTailLatencyHost(std::vector<HostAndPort>* hosts,
+                                                  Date_t now) const {
+    if (hosts->size() < 2) {
+        return;
+    }
+
+    auto best = hosts->begin();
+    auto bestLatency = getTailLatency(*best, now);
+    if (!bestLatency) {
+        return;
+    }
+    for (auto it = std::next(hosts->begin()); it != hosts->end(); ++it) {
+        auto latency = getTailLatency(*it, now);
+        if (latency && *latency < *bestLatency) {
+            best = it;
+            bestLatency = latency;
+        }
+    }
+    std::iter_swap(hosts->begin(), best);
+}
+
+std::shared_ptr<HostLatencyTracker::Estimate> HostLatencyTracker::_find(
+    const HostAndPort& host) const {
+    std::shared_lock lk(_mutex);  // NOLINT
+    auto it = _estimates.find(host);
+    return it == _estimates.end() ? nullptr : it->second;
+}
+
+}  // namespace mongo
@@ -0,0 +1,100 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/net/hostandport.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class ServiceContext;
+
+/**
+ * Keeps an estimate of the tail latency of the commands sent to each remote host, so that reads
+ * which any member of a shard may serve can steer away from the members which are intermittently
+ * slow.
+ *
+ * The estimate is the one TCP uses for its retransmission timeout: a smoothed latency plus four
+ * times its smoothed mean deviation. It approximates a high percentile of the latency without
+ * keeping a histogram per host.
+ */
+class HostLatencyTracker {
+public:
+    // Estimates which have not been refreshed for this long are ignored, so that a host which
+    // was avoided because it was slow is eventually tried again.
+    static constexpr Seconds kMaxEstimateAge{10};
+
+    static HostLatencyTracker* get(ServiceContext* serviceContext);
+
+    /**
+     * Records that a command sent to 'host' completed after 'latency'.
+     */
+    void recordLatency(const HostAndPort& host, Microseconds latency, Date_t now = Date_t::now());
+
+    /**
+     * Returns the estimated tail latency of the commands sent to 'host', or boost::none if no
+     * command completed on it in the last 'kMaxEstimateAge'.
+     */
+    boost::optional<Microseconds> getTailLatency(const HostAndPort& host,
+                                                 Date_t now = Date_t::now()) const;
+
+    /**
+     * Moves the host with the lowest estimated tail latency to the front of 'hosts', which are
+     * expected to be in a random order. Hosts without a current estimate are never moved, so that
+     * they keep receiving their share of the commands until they have one.
+     */
+    void preferLowTailLatencyHost(std::vector<HostAndPort>* hosts,
+                                  Date_t now = Date_t::now()) const;
+
+private:
+    struct Estimate {
+        // A negative value means no latency has been recorded yet.
+        AtomicWord<long long> smoothedMicros{-1};
+        AtomicWord<long long> deviationMicros{0};
+        AtomicWord<long long> lastUpdateMillis{0};
+    };
+
+    std::shared_ptr<Estimate> _find(const HostAndPort& host) const;
+
+    // Only held to look up or add the estimate of a host. The estimates themselves are updated
+    // without holding it.
+    mutable std::shared_mutex _mutex;  // NOLINT
+    stdx::unordered_map<HostAndPort, std::shared_ptr<Estimate>> _estimates;
+};
+
+}  // namespace mongo
@@ -0,0 +1,111 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/s/host_latency_tracker.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+const HostAndPort kHost0("host0", 27017);
+const HostAndPort kHost1("host1", 27017);
+const HostAndPort kHost2("host2", 27017);
+
+TEST(HostLatencyTrackerTest, NoEstimateWithoutSamples) {
+    HostLatencyTracker tracker;
+    ASSERT_FALSE(tracker.getTailLatency(kHost0));
+}
+
+TEST(HostLatencyTrackerTest, TailLatencyIncludesDeviation) {
+    HostLatencyTracker tracker;
+    const auto now = Date_t::now();
+
+    tracker.recordLatency(kHost0, Milliseconds(10), now);
+    ASSERT_EQ(*tracker.getTailLatency(kHost0, now), Milliseconds(30));
+
+    // Steady latencies shrink the deviation towards zero.
+    for (int i = 0; i < 100; ++i) {
+        tracker.recordLatency(kHost0, Milliseconds(10), now);
+    }
+    ASSERT_LT(*tracker.getTailLatency(kHost0, now), Milliseconds(11));
+
+    // An occasional slow command raises the tail more than the mean.
+    tracker.recordLatency(kHost0, Milliseconds(90), now);
+    ASSERT_GT(*tracker.getTailLatency(kHost0, now), Milliseconds(80));
+}
+
+TEST(HostLatencyTrackerTest, EstimatesExpire) {
+    HostLatencyTracker tracker;
+    const auto now = Date_t::now();
+
+    tracker.recordLatency(kHost0, Milliseconds(10), now);
+    ASSERT_TRUE(tracker.getTailLatency(kHost0, now + HostLatencyTracker::kMaxEstimateAge));
+    ASSERT_FALSE(tracker.getTailLatency(
+        kHost0, now + HostLatencyTracker::kMaxEstimateAge + Milliseconds(1)));
+}
+
+TEST(HostLatencyTrackerTest, PrefersHostWithLowestTailLatency) {
+    HostLatencyTracker tracker;
+    const auto now = Date_t::now();
+    tracker.recordLatency(kHost0, Milliseconds(50), now);
+    tracker.recordLatency(kHost1, Milliseconds(20), now);
+    tracker.recordLatency(kHost2, Milliseconds(5), now);
+
+    std::vector<HostAndPort> hosts{kHost0, kHost1, kHost2};
+    tracker.preferLowTailLatencyHost(&hosts, now);
+    ASSERT_EQ(hosts.front(), kHost2);
+    ASSERT_EQ(hosts.size(), 3U);
+}
+
+TEST(HostLatencyTrackerTest, HostsWithoutEstimateKeepTheirPlace) {
+    HostLatencyTracker tracker;
+    const auto now = Date_t::now();
+    tracker.recordLatency(kHost1, Milliseconds(5), now);
+
+    // A host without an estimate in front is still tried.
+    std::vector<HostAndPort> hosts{kHost0, kHost1};
+    tracker.preferLowTailLatencyHost(&hosts, now);
+    ASSERT_EQ(hosts.front(), kHost0);
+
+    // A slow host whose estimate expired is tried again.
+    tracker.recordLatency(kHost0, Milliseconds(50), now);
+    hosts = {kHost0, kHost1};
+    tracker.preferLowTailLatencyHost(&hosts, now);
+    ASSERT_EQ(hosts.front(), kHost1);
+
+    const auto later = now + HostLatencyTracker::kMaxEstimateAge + Seconds(1);
+    tracker.recordLatency(kHost1, Milliseconds(5), later);
+    hosts = {kHost0, kHost1};
+    tracker.preferLowTailLatencyHost(&hosts, later);
+    ASSERT_EQ(hosts.front(), kHost0);
+}
+
+}  // namespace
+}  // namespace mongo
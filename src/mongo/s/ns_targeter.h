@@ -78,6 +78,18 @@ public:
      */
     virtual ShardEndpoint targetInsert(OperationContext* opCtx, const BSONObj& doc) const = 0;
 
+    /**
+     * Returns the ShardEndpoint of each of the specified documents, in the same order, the same way
+     * targetInsert would. The endpoint of a document is left unset if it could not be targeted as
+     * part of the batch, in which case the document must be targeted through targetInsert, which
+     * reports the reason. Allows implementations to amortize the lookups of the routing information
+     * over the whole batch. The default implementation leaves every endpoint unset.
+     */
+    virtual std::vector<boost::optional<ShardEndpoint>> targetInserts(
+        OperationContext* opCtx, const std::vector<BSONObj>& docs) const {
+        return std::vector<boost::optional<ShardEndpoint>>(docs.size());
+    }
+
     /**
      * Returns a vector of ShardEndpoints for a potentially multi-shard update or throws
      * ShardKeyNotFound if 'updateOp' misses a shard key, but the type of update requires it.
@@ -34,16 +34,20 @@
 
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/client/remote_command_targeter.h"
+#include "mongo/db/curop.h"
 #include "mongo/db/pipeline/change_stream_constants.h"
 #include "mongo/db/pipeline/change_stream_invalidation_info.h"
 #include "mongo/db/query/cursor_response.h"
 #include "mongo/db/query/getmore_command_gen.h"
 #include "mongo/db/query/kill_cursors_gen.h"
 #include "mongo/db/query/query_feature_flags_gen.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/executor/remote_command_response.h"
 #include "mongo/s/catalog/type_shard.h"
+#include "mongo/s/host_latency_tracker.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/system_tick_source.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
 
@@ -97,6 +101,24 @@ int compareSortKeys(BSONObj leftSortKey, BSONObj rightSortKey, BSONObj sortKeyPa
     return leftSortKey.woCompare(rightSortKey, sortKeyPattern, rules);
 }
 
+/**
+ * Returns the Ordering with which the sort keys of a sorted merge are encoded as KeyStrings, or
+ * boost::none if there is no sort or if the sort pattern has more fields than an Ordering can
+ * describe, in which case the merge compares the $sortKey BSON directly.
+ *
+ * Comparing the encodings is equivalent to compareSortKeys(): the KeyString format orders values
+ * exactly as BSONElement::woCompare() does, ignores field names, and applies the same direction
+ * to each field that woCompare() derives from the sort pattern, including ascending for $meta
+ * sorts and for any field beyond the end of the pattern.
+ */
+boost::optional<Ordering> makeSortKeyOrdering(const AsyncResultsMergerParams& params) {
+    const auto& sort = params.getSort();
+    if (!sort || static_cast<size_t>(sort->nFields()) > Ordering::kMaxCompoundIndexKeys) {
+        return boost::none;
+    }
+    return Ordering::make(*sort);
+}
+
 }  // namespace
 
 AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
@@ -109,8 +131,11 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(params.getTailableMode().value_or(TailableModeEnum::kNormal)),
       _params(std::move(params)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _sortKeyOrdering(makeSortKeyOrdering(_params)),
+      _mergeQueue(MergingComparator(_remotes,
+                                    _params.getSort().value_or(BSONObj()),
+                                    _params.getCompareWholeSortKey(),
+                                    _sortKeyOrdering.has_value())),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (params.getTxnNumber()) {
         invariant(params.getSessionId());
@@ -122,6 +147,7 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
                               remote.getCursorResponse().getNSS(),
                               remote.getCursorResponse().getCursorId(),
                               remote.getCursorResponse().getPartialResultsReturned());
+        _mergeQueue.resize(_remotes.size());
 
         // A remote cannot be flagged as 'partialResultsReturned' if 'allowPartialResults' is false.
         invariant(!(_remotes.back().partialResultsReturned && !_params.getAllowPartialResults()));
@@ -207,6 +233,7 @@ bool AsyncResultsMerger::ready() {
 
 void AsyncResultsMerger::detachFromOperationContext() {
     stdx::lock_guard<Latch> lk(_mutex);
+    _reportMergeTime(lk);
     _opCtx = nullptr;
     // If we were about ready to return a boost::none because a tailable cursor reached the end of
     // the batch, that should no longer apply to the next use - when we are reattached to a
@@ -231,6 +258,7 @@ void AsyncResultsMerger::addNewShardCursors(std::vector<RemoteCursor>&& newCurso
                               remote.getCursorResponse().getNSS(),
                               remote.getCursorResponse().getCursorId(),
                               remote.getCursorResponse().getPartialResultsReturned());
+        _mergeQueue.resize(_remotes.size());
         _addBatchToBuffer(lk, newIndex, remote.getCursorResponse());
     }
 }
@@ -364,10 +392,30 @@ StatusWith<ClusterQueryResult> AsyncResultsMerger::nextReady() {
         return {ClusterQueryResult()};
     }
 
-    return _params.getSort() ? _nextReadySorted(lk) : _nextReadyUnsorted(lk);
+    if (!_params.getSort()) {
+        return _nextReadyUnsorted(lk);
+    }
+
+    const auto startTicks = SystemTickSource::get()->getTicks();
+    auto result = _nextReadySorted(lk);
+    _unreportedMergeTicks += SystemTickSource::get()->getTicks() - startTicks;
+    _reportMergeTime(lk);
+    return result;
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
+void AsyncResultsMerger::_reportMergeTime(WithLock) {
+    if (!_opCtx || !_params.getSort()) {
+        return;
+    }
+    auto& sortedMergeTime = CurOp::get(_opCtx)->debug().sortedMergeTime;
+    if (!sortedMergeTime) {
+        sortedMergeTime.emplace(0);
+    }
+    *sortedMergeTime += SystemTickSource::get()->ticksTo<Nanoseconds>(_unreportedMergeTicks);
+    _unreportedMergeTicks = 0;
+}
+
+ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock lk) {
     // Tailable non-awaitData cursors cannot have a sort.
     invariant(_tailableMode != TailableModeEnum::kTailable);
 
@@ -376,18 +424,23 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     }
 
     size_t smallestRemote = _mergeQueue.top();
-    _mergeQueue.pop();
+    auto& remote = _remotes[smallestRemote];
 
-    invariant(!_remotes[smallestRemote].docBuffer.empty());
-    invariant(_remotes[smallestRemote].status.isOK());
+    invariant(!remote.docBuffer.empty());
+    invariant(remote.status.isOK());
 
-    ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
-    _remotes[smallestRemote].docBuffer.pop();
+    ClusterQueryResult front = remote.docBuffer.front();
+    remote.docBuffer.pop();
+    if (_sortKeyOrdering) {
+        remote.sortKeyBuffer.pop();
+    }
+    _maybeAskForNextBatchEarly(lk, smallestRemote);
 
-    // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
-    // next result.
-    if (!_remotes[smallestRemote].docBuffer.empty()) {
-        _mergeQueue.push(smallestRemote);
+    // Replay the merge with the next result from 'smallestRemote', if it has a next result.
+    if (!remote.docBuffer.empty()) {
+        _mergeQueue.replaceTop();
+    } else {
+        _mergeQueue.pop();
     }
 
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
@@ -401,7 +454,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     return front;
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock lk) {
     size_t remotesAttempted = 0;
     while (remotesAttempted < _remotes.size()) {
         // It is illegal to call this method if there is an error received from any shard.
@@ -410,6 +463,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
         if (_remotes[_gettingFromRemote].hasNext()) {
             ClusterQueryResult front = _remotes[_gettingFromRemote].docBuffer.front();
             _remotes[_gettingFromRemote].docBuffer.pop();
+            _maybeAskForNextBatchEarly(lk, _gettingFromRemote);
 
             if (_tailableMode == TailableModeEnum::kTailable &&
                 !_remotes[_gettingFromRemote].hasNext()) {
@@ -449,6 +503,16 @@ Status AsyncResultsMerger::_askForNextBatch(WithLock, size_t remoteIndex) {
 
     GetMoreCommandRequest getMoreRequest(remote.cursorId, remote.cursorNss.coll().toString());
     getMoreRequest.setBatchSize(adjustedBatchSize);
+
+    // Stream several batches through an exhaust getMore, unless the cursor is tailable, whose
+    // batches are passed through as-is, or runs in a transaction, or the batch is a top-up of a
+    // short one, which should not be repeated.
+    const auto exhaustBatches = internalQueryMergerExhaustBatches.load();
+    const bool streaming = exhaustBatches > 0 && _tailableMode == TailableModeEnum::kNormal &&
+        !_params.getTxnNumber() && adjustedBatchSize == _params.getBatchSize();
+    if (streaming) {
+        getMoreRequest.setExhaustBatches(exhaustBatches);
+    }
     if (_awaitDataTimeout) {
         getMoreRequest.setMaxTimeMS(
             static_cast<std::int64_t>(durationCount<Milliseconds>(*_awaitDataTimeout)));
@@ -477,20 +541,39 @@ Status AsyncResultsMerger::_askForNextBatch(WithLock, size_t remoteIndex) {
     executor::RemoteCommandRequest request(
         remote.getTargetHost(), remote.cursorNss.db().toString(), cmdObj, _opCtx);
 
-    auto callbackStatus =
-        _executor->scheduleRemoteCommand(request, [this, remoteIndex](auto const& cbData) {
-            stdx::lock_guard<Latch> lk(this->_mutex);
-            this->_handleBatchResponse(lk, cbData, remoteIndex);
-        });
+    auto callback = [this, remoteIndex](auto const& cbData) {
+        stdx::lock_guard<Latch> lk(this->_mutex);
+        this->_handleBatchResponse(lk, cbData, remoteIndex);
+    };
+    auto callbackStatus = streaming ? _executor->scheduleExhaustRemoteCommand(request, callback)
+                                    : _executor->scheduleRemoteCommand(request, callback);
 
     if (!callbackStatus.isOK()) {
         return callbackStatus.getStatus();
     }
 
     remote.cbHandle = callbackStatus.getValue();
+    remote.streaming = streaming;
     return Status::OK();
 }
 
+void AsyncResultsMerger::_maybeAskForNextBatchEarly(WithLock lk, size_t remoteIndex) {
+    // Tailable cursors must pass each remote batch through as-is, so they never read ahead.
+    if (_tailableMode != TailableModeEnum::kNormal || _lifecycleState != kAlive || !_opCtx) {
+        return;
+    }
+
+    auto& remote = _remotes[remoteIndex];
+    const auto threshold = internalQueryMergerEarlyGetMoreThreshold.load();
+    if (threshold <= 0 || remote.docBuffer.size() > static_cast<size_t>(threshold) ||
+        !remote.status.isOK() || remote.exhausted() || remote.cbHandle.isValid()) {
+        return;
+    }
+
+    // A failure to schedule is reported by the next call to ready(), like any other remote error.
+    remote.status = _askForNextBatch(lk, remoteIndex);
+}
+
 Status AsyncResultsMerger::scheduleGetMores() {
     stdx::lock_guard<Latch> lk(_mutex);
     return _scheduleGetMores(lk);
@@ -693,8 +776,20 @@ bool AsyncResultsMerger::_checkHighWaterMarkEligibility(WithLock,
 void AsyncResultsMerger::_handleBatchResponse(WithLock lk,
                                               CbData const& cbData,
                                               size_t remoteIndex) {
-    // Got a response from remote, so indicate we are no longer waiting for one.
-    _remotes[remoteIndex].cbHandle = executor::TaskExecutor::CallbackHandle();
+    // Only a getMore which returns as soon as it has a batch measures how quickly the host serves
+    // it. Tailable getMores wait for new results and later exhaust batches are pushed unprompted.
+    if (_tailableMode == TailableModeEnum::kNormal && !_remotes[remoteIndex].streaming &&
+        cbData.response.isOK() && cbData.response.elapsed) {
+        HostLatencyTracker::get(getGlobalServiceContext())
+            ->recordLatency(_remotes[remoteIndex].getTargetHost(), *cbData.response.elapsed);
+    }
+
+    // Got a response from remote, so indicate we are no longer waiting for one, unless it is one
+    // of the batches of an exhaust getMore with more to come.
+    if (!cbData.response.moreToCome) {
+        _remotes[remoteIndex].cbHandle = executor::TaskExecutor::CallbackHandle();
+        _remotes[remoteIndex].streaming = false;
+    }
 
     //  On shutdown, there is no need to process the response.
     if (_lifecycleState != kAlive) {
@@ -738,6 +833,11 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
         remote.partialResultsReturned = (remote.status != ErrorCodes::ExchangePassthrough);
         std::queue<ClusterQueryResult> emptyBuffer;
         std::swap(remote.docBuffer, emptyBuffer);
+        std::queue<KeyString::Value> emptySortKeyBuffer;
+        std::swap(remote.sortKeyBuffer, emptySortKeyBuffer);
+        // An early getMore can fail while results from the previous batch are still buffered, in
+        // which case the remote is still taking part in the merge.
+        _mergeQueue.erase(remoteIndex);
         remote.status = Status::OK();
         remote.cursorId = 0;
     }
@@ -779,7 +879,8 @@ void AsyncResultsMerger::_processBatchResults(WithLock lk,
     if (_tailableMode == TailableModeEnum::kTailable && !remote.hasNext()) {
         invariant(_remotes.size() == 1);
         _eofNext = true;
-    } else if (!remote.hasNext() && !remote.exhausted() && _lifecycleState == kAlive && _opCtx) {
+    } else if (!remote.hasNext() && !remote.exhausted() && !remote.cbHandle.isValid() &&
+               _lifecycleState == kAlive && _opCtx) {
         // If this is normal or tailable-awaitData cursor and we still don't have anything buffered
         // after receiving this batch, we can schedule work to retrieve the next batch right away.
         // Be careful only to do this when '_opCtx' is non-null, since it is illegal to schedule a
@@ -792,6 +893,10 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                            size_t remoteIndex,
                                            const CursorResponse& response) {
     auto& remote = _remotes[remoteIndex];
+    // With early getMores a batch may arrive while results from the previous one are still
+    // buffered, in which case the remote is already on the merge queue.
+    const bool wasBufferEmpty = remote.docBuffer.empty();
+    const auto startTicks = _sortKeyOrdering ? SystemTickSource::get()->getTicks() : 0;
     _updateRemoteMetadata(lk, remoteIndex, response);
     for (const auto& obj : response.getBatch()) {
         // If there's a sort, we're expecting the remote node to have given us back a sort key.
@@ -810,16 +915,25 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                          << "' was not of type Object in document: " << obj);
                 return false;
             }
+            if (_sortKeyOrdering) {
+                KeyString::Builder sortKey(KeyString::Version::kLatestVersion,
+                                           extractSortKey(obj, _params.getCompareWholeSortKey()),
+                                           *_sortKeyOrdering);
+                remote.sortKeyBuffer.push(sortKey.getValueCopy());
+            }
         }
 
         ClusterQueryResult result(obj);
         remote.docBuffer.push(result);
         ++remote.fetchedCount;
     }
+    if (_sortKeyOrdering) {
+        _unreportedMergeTicks += SystemTickSource::get()->getTicks() - startTicks;
+    }
 
     // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
     // queue.
-    if (_params.getSort() && !response.getBatch().empty()) {
+    if (_params.getSort() && !response.getBatch().empty() && wasBufferEmpty) {
         _mergeQueue.push(remoteIndex);
     }
     return true;
@@ -890,9 +1004,11 @@ stdx::shared_future<void> AsyncResultsMerger::kill(OperationContext* opCtx) {
         return _killCompleteInfo->getFuture();
     }
 
-    // Cancel all of our callbacks. Once they all complete, the event will be signaled.
+    // Cancel all of our callbacks. Once they all complete, the event will be signaled. A canceled
+    // exhaust getMore does not run its callback again, so it is left to deliver its last batch
+    // instead. It does so promptly, since its cursor has just been killed.
     for (const auto& remote : _remotes) {
-        if (remote.cbHandle.isValid()) {
+        if (remote.cbHandle.isValid() && !remote.streaming) {
             _executor->cancel(remote.cbHandle);
         }
     }
@@ -931,13 +1047,17 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
 // AsyncResultsMerger::MergingComparator
 //
 
-bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
+int AsyncResultsMerger::MergingComparator::operator()(size_t lhs, size_t rhs) const {
+    if (_useKeyStringSortKeys) {
+        return _remotes[lhs].sortKeyBuffer.front().compare(_remotes[rhs].sortKeyBuffer.front());
+    }
+
     const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
     const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
 
     return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
                            extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+                           _sort);
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
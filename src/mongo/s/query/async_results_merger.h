@@ -35,14 +35,18 @@
 
 #include "mongo/base/status_with.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/ordering.h"
 #include "mongo/db/cursor_id.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/executor/task_executor.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/s/query/async_results_merger_params_gen.h"
 #include "mongo/s/query/cluster_query_result.h"
+#include "mongo/s/query/loser_tree.h"
 #include "mongo/stdx/future.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/net/hostandport.h"
+#include "mongo/util/tick_source.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -306,9 +310,17 @@ private:
         // The buffer of results that have been retrieved but not yet returned to the caller.
         std::queue<ClusterQueryResult> docBuffer;
 
+        // The KeyString encoding of the sort key of each result in 'docBuffer', in the same order.
+        // Only populated for sorted merges whose sort pattern can be encoded as an Ordering.
+        std::queue<KeyString::Value> sortKeyBuffer;
+
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
+        // True if the pending request to this remote is an exhaust getMore, which delivers
+        // several batches and stays pending until the last of them arrives.
+        bool streaming = false;
+
         // Set to an error status if there is an error retrieving a response from this remote or if
         // the command result contained an error.
         Status status = Status::OK();
@@ -325,10 +337,18 @@ private:
     public:
         MergingComparator(const std::vector<RemoteCursorData>& remotes,
                           const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+                          bool compareWholeSortKey,
+                          bool useKeyStringSortKeys)
+            : _remotes(remotes),
+              _sort(sort),
+              _compareWholeSortKey(compareWholeSortKey),
+              _useKeyStringSortKeys(useKeyStringSortKeys) {}
 
-        bool operator()(const size_t& lhs, const size_t& rhs);
+        /**
+         * Returns an int less than 0, 0, or greater than 0 as the next buffered result of remote
+         * 'lhs' sorts before, equal to, or after that of remote 'rhs'.
+         */
+        int operator()(size_t lhs, size_t rhs) const;
 
     private:
         const std::vector<RemoteCursorData>& _remotes;
@@ -339,6 +359,10 @@ private:
         // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
         // be {$sortKey: 1}.
         const bool _compareWholeSortKey;
+
+        // When true, results are compared by the KeyString encodings in each remote's
+        // 'sortKeyBuffer' rather than by their $sortKey.
+        const bool _useKeyStringSortKeys;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -373,6 +397,21 @@ private:
      */
     Status _askForNextBatch(WithLock, size_t remoteIndex);
 
+    /**
+     * Called after a result has been taken from the buffer of the remote at 'remoteIndex'. If
+     * 'internalQueryMergerEarlyGetMoreThreshold' is set and the remote has at most that many
+     * results left, asks it for the next batch without waiting for the buffer to drain, so that a
+     * slow remote does not stall the merge once its buffer is empty.
+     */
+    void _maybeAskForNextBatchEarly(WithLock, size_t remoteIndex);
+
+    /**
+     * Adds the merge time accumulated since the last call to the OpDebug of the attached
+     * operation, so that it is reported as 'sortedMergeMicros' by the operation which did the
+     * work. Must only be called on the thread which owns '_opCtx'.
+     */
+    void _reportMergeTime(WithLock);
+
     /**
      * Checks whether or not the remote cursors are all exhausted.
      */
@@ -493,9 +532,19 @@ private:
     // Data tracking the state of our communication with each of the remote nodes.
     std::vector<RemoteCursorData> _remotes;
 
-    // The top of this priority queue is the index into '_remotes' for the remote host that has the
-    // next document to return, according to the sort order. Used only if there is a sort.
-    std::priority_queue<size_t, std::vector<size_t>, MergingComparator> _mergeQueue;
+    // Set for sorted merges whose sort pattern has few enough fields to be encoded as an Ordering.
+    // The sort key of each buffered result is then encoded once as a KeyString when its batch
+    // arrives, so that the merge compares flat byte strings rather than walking the $sortKey BSON
+    // against the sort pattern on every comparison.
+    boost::optional<Ordering> _sortKeyOrdering;
+
+    // The winner of this tree is the index into '_remotes' for the remote host that has the next
+    // document to return, according to the sort order. Used only if there is a sort.
+    LoserTree<MergingComparator> _mergeQueue;
+
+    // Time spent encoding sort keys and merging results which has not yet been reported to the
+    // CurOp of the attached operation. Used only if there is a sort.
+    TickSource::Tick _unreportedMergeTicks = 0;
 
     // The index into '_remotes' for the remote from which we are currently retrieving results.
     // Used only if there is *not* a sort.
@@ -33,12 +33,14 @@
 
 #include <memory>
 
+#include "mongo/db/curop.h"
 #include "mongo/db/json.h"
 #include "mongo/db/pipeline/change_stream_constants.h"
 #include "mongo/db/pipeline/resume_token.h"
 #include "mongo/db/query/cursor_response.h"
 #include "mongo/db/query/getmore_command_gen.h"
 #include "mongo/executor/task_executor.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/s/catalog/type_shard.h"
 #include "mongo/s/client/shard_registry.h"
 #include "mongo/s/query/results_merger_test_fixture.h"
@@ -388,6 +390,166 @@ TEST_F(AsyncResultsMergerTest, MultiShardMultipleGets) {
     ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
 }
 
+TEST_F(AsyncResultsMergerTest, EarlyGetMoreKeepsSortedMergeInOrder) {
+    RAIIServerParameterControllerForTest threshold("internalQueryMergerEarlyGetMoreThreshold", 1);
+
+    BSONObj findCmd = fromjson("{find: 'testcoll', sort: {_id: 1}}");
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[1], kTestShardHosts[1], CursorResponse(kTestNss, 6, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors), findCmd);
+
+    auto readyEvent = unittest::assertGet(arm->nextEvent());
+    std::vector<CursorResponse> responses;
+    responses.emplace_back(kTestNss,
+                           CursorId(5),
+                           std::vector<BSONObj>{fromjson("{$sortKey: [1]}"),
+                                                fromjson("{$sortKey: [3]}")});
+    responses.emplace_back(kTestNss,
+                           CursorId(6),
+                           std::vector<BSONObj>{fromjson("{$sortKey: [2]}"),
+                                                fromjson("{$sortKey: [4]}")});
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+    ASSERT_FALSE(networkHasReadyRequests());
+
+    // Taking a result from the first shard leaves one buffered, which is at the threshold, so the
+    // next batch is requested right away even though the ARM is still ready.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{$sortKey: [1]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(networkHasReadyRequests());
+    ASSERT_EQ(getNthPendingRequest(0).target, kTestShardHosts[0]);
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{$sortKey: [2]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_EQ(getNthPendingRequest(1).target, kTestShardHosts[1]);
+
+    // The batches arrive while both shards still have a result buffered. They must be merged
+    // behind the buffered results without disturbing the sort order.
+    responses.clear();
+    responses.emplace_back(kTestNss,
+                           CursorId(0),
+                           std::vector<BSONObj>{fromjson("{$sortKey: [5]}"),
+                                                fromjson("{$sortKey: [7]}")});
+    responses.emplace_back(kTestNss,
+                           CursorId(0),
+                           std::vector<BSONObj>{fromjson("{$sortKey: [6]}"),
+                                                fromjson("{$sortKey: [8]}")});
+    scheduleNetworkResponses(std::move(responses));
+
+    for (int expected = 3; expected <= 8; ++expected) {
+        ASSERT_TRUE(arm->ready());
+        ASSERT_BSONOBJ_EQ(BSON("$sortKey" << BSON_ARRAY(expected)),
+                          *unittest::assertGet(arm->nextReady()).getResult());
+    }
+    ASSERT_FALSE(networkHasReadyRequests());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(arm->remotesExhausted());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+}
+
+TEST_F(AsyncResultsMergerTest, NoEarlyGetMoreByDefault) {
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(makeRemoteCursor(
+        kTestShardIds[0],
+        kTestShardHosts[0],
+        CursorResponse(kTestNss, 5, {fromjson("{_id: 1}"), fromjson("{_id: 2}")})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 1}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_FALSE(networkHasReadyRequests());
+
+    // Clean up.
+    auto killFuture = arm->kill(operationContext());
+    killFuture.wait();
+}
+
+TEST_F(AsyncResultsMergerTest, ExhaustGetMoreStreamsSeveralBatches) {
+    RAIIServerParameterControllerForTest exhaustBatches("internalQueryMergerExhaustBatches", 3);
+
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    auto readyEvent = unittest::assertGet(arm->nextEvent());
+    ASSERT_EQ(getNthPendingRequest(0).cmdObj["exhaustBatches"].numberLong(), 3);
+
+    // Both batches of the stream answer the one getMore.
+    executor::NetworkInterfaceMock* net = network();
+    net->enterNetwork();
+    auto noi = net->getNextReadyRequest();
+    net->scheduleResponse(
+        noi,
+        net->now(),
+        executor::RemoteCommandResponse(
+            CursorResponse(kTestNss, 5, {fromjson("{_id: 1}"), fromjson("{_id: 2}")})
+                .toBSON(CursorResponse::ResponseType::SubsequentResponse),
+            Microseconds(0),
+            true /* moreToCome */));
+    net->scheduleResponse(noi,
+                          net->now(),
+                          executor::RemoteCommandResponse(
+                              CursorResponse(kTestNss, 0, {fromjson("{_id: 3}")})
+                                  .toBSON(CursorResponse::ResponseType::SubsequentResponse),
+                              Microseconds(0),
+                              false /* moreToCome */));
+    net->runReadyNetworkOperations();
+    net->exitNetwork();
+    executor()->waitForEvent(readyEvent);
+
+    for (int expected = 1; expected <= 3; ++expected) {
+        ASSERT_TRUE(arm->ready());
+        ASSERT_BSONOBJ_EQ(BSON("_id" << expected),
+                          *unittest::assertGet(arm->nextReady()).getResult());
+    }
+    ASSERT_FALSE(networkHasReadyRequests());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(arm->remotesExhausted());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+}
+
+TEST_F(AsyncResultsMergerTest, KillWaitsForTheLastBatchOfAnExhaustGetMore) {
+    RAIIServerParameterControllerForTest exhaustBatches("internalQueryMergerExhaustBatches", 3);
+
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    ASSERT_OK(arm->nextEvent().getStatus());
+    executor::NetworkInterfaceMock* net = network();
+    net->enterNetwork();
+    auto getMore = net->getNextReadyRequest();
+    net->scheduleResponse(getMore,
+                          net->now(),
+                          executor::RemoteCommandResponse(
+                              CursorResponse(kTestNss, 5, {fromjson("{_id: 1}")})
+                                  .toBSON(CursorResponse::ResponseType::SubsequentResponse),
+                              Microseconds(0),
+                              true /* moreToCome */));
+    net->runReadyNetworkOperations();
+    net->exitNetwork();
+
+    // Killing the ARM kills the shard cursor, but leaves the stream to end on its own.
+    auto killFuture = arm->kill(operationContext());
+    assertKillCusorsCmdHasCursorId(getNthPendingRequest(0).cmdObj, 5);
+    ASSERT(killFuture.wait_for(Milliseconds(0).toSystemDuration()) ==
+           stdx::future_status::timeout);
+
+    net->enterNetwork();
+    net->scheduleResponse(
+        getMore, net->now(), executor::RemoteCommandResponse(ErrorCodes::CursorKilled, "killed"));
+    net->runReadyNetworkOperations();
+    net->exitNetwork();
+    killFuture.wait();
+}
+
 TEST_F(AsyncResultsMergerTest, CompoundSortKey) {
     BSONObj findCmd = fromjson("{find: 'testcoll', sort: {a: -1, b: 1}}");
     std::vector<RemoteCursor> cursors;
@@ -444,6 +606,53 @@ TEST_F(AsyncResultsMergerTest, CompoundSortKey) {
     ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
 }
 
+TEST_F(AsyncResultsMergerTest, SortKeysOfDifferentTypesMergeInBSONOrder) {
+    BSONObj findCmd = fromjson("{find: 'testcoll', sort: {a: 1, b: -1}}");
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[1], kTestShardHosts[1], CursorResponse(kTestNss, 6, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors), findCmd);
+
+    ASSERT_FALSE(arm->ready());
+    auto readyEvent = unittest::assertGet(arm->nextEvent());
+
+    // Numbers of different types compare by value, and values of different types compare in the
+    // canonical BSON type order, just as they do when the $sortKey BSON is compared directly.
+    std::vector<CursorResponse> responses;
+    std::vector<BSONObj> batch1 = {fromjson("{$sortKey: [null, 1]}"),
+                                   fromjson("{$sortKey: [1.5, 'b']}"),
+                                   fromjson("{$sortKey: [2, 'a']}"),
+                                   fromjson("{$sortKey: ['x', 1]}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch1);
+    std::vector<BSONObj> batch2 = {fromjson("{$sortKey: [1, 0]}"),
+                                   fromjson("{$sortKey: [{$numberLong: '2'}, 'b']}"),
+                                   fromjson("{$sortKey: [2.0, 'a']}"),
+                                   fromjson("{$sortKey: [{a: 1}, 1]}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch2);
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    std::vector<BSONObj> expected = {fromjson("{$sortKey: [null, 1]}"),
+                                     fromjson("{$sortKey: [1, 0]}"),
+                                     fromjson("{$sortKey: [1.5, 'b']}"),
+                                     fromjson("{$sortKey: [{$numberLong: '2'}, 'b']}"),
+                                     fromjson("{$sortKey: [2, 'a']}"),
+                                     fromjson("{$sortKey: [2.0, 'a']}"),
+                                     fromjson("{$sortKey: ['x', 1]}"),
+                                     fromjson("{$sortKey: [{a: 1}, 1]}")};
+    for (const auto& expectedResult : expected) {
+        ASSERT_TRUE(arm->ready());
+        ASSERT_BSONOBJ_EQ(expectedResult, *unittest::assertGet(arm->nextReady()).getResult());
+    }
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+
+    // The time spent merging is reported to the operation.
+    ASSERT(CurOp::get(operationContext())->debug().sortedMergeTime);
+}
+
 TEST_F(AsyncResultsMergerTest, SortedButNoSortKey) {
     BSONObj findCmd = fromjson("{find: 'testcoll', sort: {a: -1, b: 1}}");
     std::vector<RemoteCursor> cursors;
@@ -36,6 +36,7 @@
 #include "mongo/db/pipeline/document_source_project.h"
 #include "mongo/db/pipeline/document_source_sort.h"
 #include "mongo/db/pipeline/sharded_agg_helpers.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/s/catalog/type_shard.h"
 #include "mongo/s/query/sharded_agg_test_fixture.h"
 #include "mongo/unittest/unittest.h"
@@ -612,5 +613,67 @@ TEST_F(ClusterExchangeTest, CompoundShardKeyThreeShards) {
     future.default_timed_get();
 }
 
+TEST_F(ClusterExchangeTest, GroupMergeIsPartitionedAcrossShardsByHashedGroupKey) {
+    RAIIServerParameterControllerForTest partitionGroupMerge(
+        "internalQueryPartitionGroupMergeAcrossShards", true);
+    const std::set<ShardId> shardIds{ShardId("0"), ShardId("1"), ShardId("2")};
+
+    auto mergePipe = Pipeline::create(
+        {parseStage("{$group: {_id: '$_id', count: {$sum: '$count'}, $doingMerge: true}}"),
+         parseStage("{$match: {count: {$gt: 1}}}"),
+         parseStage("{$project: {count: 1}}")},
+        expCtx());
+
+    auto exchangeSpec =
+        sharded_agg_helpers::checkIfEligibleForGroupMergeExchange(mergePipe.get(), shardIds);
+    ASSERT_TRUE(exchangeSpec);
+    ASSERT(exchangeSpec->exchangeSpec.getPolicy() == ExchangePolicyEnum::kKeyRange);
+    ASSERT_BSONOBJ_EQ(exchangeSpec->exchangeSpec.getKey(),
+                      BSON("_id"
+                           << "hashed"));
+    ASSERT_EQ(exchangeSpec->exchangeSpec.getConsumers(), 3);
+    ASSERT_EQ(exchangeSpec->consumerShards.size(), 3UL);  // One for each shard.
+
+    // The hashed key space is split into one range per shard, in ascending order.
+    const auto& boundaries = exchangeSpec->exchangeSpec.getBoundaries().value();
+    const auto& consumerIds = exchangeSpec->exchangeSpec.getConsumerIds().value();
+    ASSERT_EQ(boundaries.size(), 4UL);
+    ASSERT_EQ(consumerIds, std::vector<int>({0, 1, 2}));
+    ASSERT_BSONOBJ_EQ(boundaries[0], BSON("_id" << MINKEY));
+    ASSERT_LT(boundaries[1]["_id"].numberLong(), boundaries[2]["_id"].numberLong());
+    ASSERT_BSONOBJ_EQ(boundaries[3], BSON("_id" << MAXKEY));
+}
+
+TEST_F(ClusterExchangeTest, GroupMergeFollowedBySingleStreamStageIsNotPartitioned) {
+    RAIIServerParameterControllerForTest partitionGroupMerge(
+        "internalQueryPartitionGroupMergeAcrossShards", true);
+    const std::set<ShardId> shardIds{ShardId("0"), ShardId("1")};
+
+    auto mergePipe =
+        Pipeline::create({parseStage("{$group: {_id: '$_id', $doingMerge: true}}"),
+                          DocumentSourceSort::create(expCtx(), BSON("_id" << 1))},
+                         expCtx());
+    ASSERT_FALSE(
+        sharded_agg_helpers::checkIfEligibleForGroupMergeExchange(mergePipe.get(), shardIds));
+
+    mergePipe = Pipeline::create({parseStage("{$group: {_id: '$_id', $doingMerge: true}}"),
+                                  DocumentSourceLimit::create(expCtx(), 1)},
+                                 expCtx());
+    ASSERT_FALSE(
+        sharded_agg_helpers::checkIfEligibleForGroupMergeExchange(mergePipe.get(), shardIds));
+}
+
+TEST_F(ClusterExchangeTest, GroupMergeIsNotPartitionedByDefaultOrOnASingleShard) {
+    auto mergePipe = Pipeline::create({parseStage("{$group: {_id: '$_id', $doingMerge: true}}")},
+                                      expCtx());
+    ASSERT_FALSE(sharded_agg_helpers::checkIfEligibleForGroupMergeExchange(
+        mergePipe.get(), {ShardId("0"), ShardId("1")}));
+
+    RAIIServerParameterControllerForTest partitionGroupMerge(
+        "internalQueryPartitionGroupMergeAcrossShards", true);
+    ASSERT_FALSE(
+        sharded_agg_helpers::checkIfEligibleForGroupMergeExchange(mergePipe.get(), {ShardId("0")}));
+}
+
 }  // namespace
 }  // namespace mongo
@@ -64,6 +64,7 @@
 #include "mongo/s/query/async_results_merger.h"
 #include "mongo/s/query/cluster_client_cursor_impl.h"
 #include "mongo/s/query/cluster_cursor_manager.h"
+#include "mongo/s/query/cluster_query_result_cache.h"
 #include "mongo/s/query/establish_cursors.h"
 #include "mongo/s/query/store_possible_cursor.h"
 #include "mongo/s/stale_exception.h"
@@ -511,6 +512,9 @@ CursorId ClusterFind::runQuery(OperationContext* opCtx,
 
     auto const catalogCache = Grid::get(opCtx)->catalogCache();
 
+    auto const resultCache = ClusterQueryResultCache::get(opCtx);
+    const auto resultCacheKey = resultCache->makeKey(opCtx, query, readPref);
+
     // Re-target and re-send the initial find command to the shards until we have established the
     // shard version.
     for (size_t retries = 1; retries <= kMaxRetries; ++retries) {
@@ -530,9 +534,22 @@ CursorId ClusterFind::runQuery(OperationContext* opCtx,
 
         const auto cm = uassertStatusOK(std::move(swCM));
 
+        if (resultCacheKey) {
+            if (auto cachedResults = resultCache->lookup(opCtx, *resultCacheKey, cm)) {
+                *results = std::move(*cachedResults);
+                CurOp::get(opCtx)->debug().nreturned = results->size();
+                CurOp::get(opCtx)->debug().cursorExhausted = true;
+                return CursorId(0);
+            }
+        }
+
         try {
-            return runQueryWithoutRetrying(
+            auto cursorId = runQueryWithoutRetrying(
                 opCtx, query, readPref, cm, results, partialResultsReturned);
+            if (resultCacheKey && cursorId == CursorId(0)) {
+                resultCache->insert(opCtx, *resultCacheKey, cm, *results);
+            }
+            return cursorId;
         } catch (ExceptionFor<ErrorCodes::StaleDbVersion>& ex) {
             if (retries >= kMaxRetries) {
                 // Check if there are no retries remaining, so the last received error can be
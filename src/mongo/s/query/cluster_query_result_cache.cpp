@@ -0,0 +1,316 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/s/query/cluster_query_result_cache.h"
+
+#include <absl/hash/hash.h>
+#include <algorithm>
+#include <fmt/format.h>
+#include <set>
+
+#include "mongo/client/read_preference.h"
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/operation_time_tracker.h"
+#include "mongo/db/pipeline/dependencies.h"
+#include "mongo/db/pipeline/expression.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/query_planner_common.h"
+#include "mongo/db/repl/read_concern_args.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/vector_clock.h"
+#include "mongo/s/chunk_manager.h"
+#include "mongo/s/query/cluster_query_result_cache_gen.h"
+
+namespace mongo {
+namespace {
+
+const auto getClusterQueryResultCache =
+    ServiceContext::declareDecoration<ClusterQueryResultCache>();
+
+CounterMetric queryResultCacheHits("query.routerResultCache.hits");
+CounterMetric queryResultCacheMisses("query.routerResultCache.misses");
+CounterMetric queryResultCacheInserts("query.routerResultCache.inserts");
+CounterMetric queryResultCacheEvictions("query.routerResultCache.evictions");
+
+// Fields of the find command which do not affect its result, and are therefore left out of the key.
+const std::set<std::string> kFieldsExcludedFromKey = {"filter", "maxTimeMS", "readConcern"};
+
+// Approximate per-entry overhead of the LRU list and map nodes, counted towards the size limit.
+constexpr size_t kEntryOverheadBytes = 128;
+
+boost::optional<ChunkVersion> getCollectionVersion(const ChunkManager& cm) {
+    if (!cm.isSharded()) {
+        return boost::none;
+    }
+    return cm.getVersion();
+}
+
+// Whether 'clusterQueryResultCacheNamespaces' is non-empty, so that writes can skip the cache
+// without reading the parameter.
+AtomicWord<bool> cacheEnabled{false};
+
+bool isCachingEnabledFor(const NamespaceString& nss) {
+    if (!cacheEnabled.load()) {
+        return false;
+    }
+
+    const auto namespaces = gClusterQueryResultCacheNamespaces.get();
+    return std::any_of(namespaces.begin(), namespaces.end(), [&](const std::string& ns) {
+        return ns == nss.ns();
+    });
+}
+
+// Returns whether the result of 'query' may differ between two runs against the same data, because
+// it generates random numbers, reads the time at which it runs, or runs JavaScript.
+bool isNondeterministic(const CanonicalQuery& query) {
+    if (query.getProj() && query.getProj()->hasExpressions()) {
+        return true;
+    }
+
+    if (QueryPlannerCommon::hasNode(query.root(), MatchExpression::WHERE)) {
+        return true;
+    }
+
+    DepsTracker deps;
+    query.root()->addDependencies(&deps);
+    if (const auto& letParams = query.getFindCommandRequest().getLet()) {
+        const auto& expCtx = query.getExpCtx();
+        for (auto&& elem : *letParams) {
+            Expression::parseOperand(expCtx.get(), elem, expCtx->variablesParseState)
+                ->addDependencies(&deps);
+        }
+    }
+    return deps.needRandomGenerator ||
+        deps.hasVariableReferenceTo({Variables::kNowId, Variables::kClusterTimeId});
+}
+
+bool isEligible(OperationContext* opCtx, const CanonicalQuery& query) {
+    if (!isCachingEnabledFor(query.nss())) {
+        return false;
+    }
+
+    if (opCtx->inMultiDocumentTransaction() || opCtx->getTxnNumber()) {
+        return false;
+    }
+
+    // Reads which must observe a particular point in time, such as causally consistent reads,
+    // cannot be served a result which may predate it.
+    const auto& readConcernArgs = repl::ReadConcernArgs::get(opCtx);
+    if (readConcernArgs.getArgsAfterClusterTime() || readConcernArgs.getArgsAtClusterTime() ||
+        readConcernArgs.getArgsOpTime()) {
+        return false;
+    }
+    switch (readConcernArgs.getLevel()) {
+        case repl::ReadConcernLevel::kLocalReadConcern:
+        case repl::ReadConcernLevel::kAvailableReadConcern:
+        case repl::ReadConcernLevel::kMajorityReadConcern:
+            break;
+        default:
+            return false;
+    }
+
+    const auto& findCommand = query.getFindCommandRequest();
+    return !findCommand.getTailable() && !findCommand.getAllowPartialResults() &&
+        !findCommand.getEncryptionInformation() && !findCommand.getLegacyRuntimeConstants() &&
+        !isNondeterministic(query);
+}
+
+}  // namespace
+
+Status validateClusterQueryResultCacheNamespaces(const std::vector<std::string>& value) {
+    try {
+        for (const auto& nsStr : value) {
+            NamespaceString ns(nsStr);
+
+            if (!ns.isValid()) {
+                return Status(ErrorCodes::BadValue,
+                              fmt::format("'{}' is not a valid namespace", nsStr));
+            }
+        }
+    } catch (...) {
+        return exceptionToStatus();
+    }
+
+    return Status::OK();
+}
+
+Status onUpdateClusterQueryResultCacheNamespaces(const std::vector<std::string>& value) {
+    cacheEnabled.store(!value.empty());
+
+    // Writes are not tracked for namespaces which are not cached, so results cached before a
+    // namespace was removed from the list must not be served once it is added back.
+    if (hasGlobalServiceContext()) {
+        ClusterQueryResultCache::get(getGlobalServiceContext())->invalidateAll();
+    }
+    return Status::OK();
+}
+
+ClusterQueryResultCache::ClusterQueryResultCache()
+    : _entries(gClusterQueryResultCacheSizeBytes.load()),
+      _maxSizeBytes(gClusterQueryResultCacheSizeBytes.load()) {}
+
+ClusterQueryResultCache* ClusterQueryResultCache::get(ServiceContext* serviceContext) {
+    return &getClusterQueryResultCache(serviceContext);
+}
+
+ClusterQueryResultCache* ClusterQueryResultCache::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+boost::optional<ClusterQueryResultCache::Key> ClusterQueryResultCache::makeKey(
+    OperationContext* opCtx, const CanonicalQuery& query, const ReadPreferenceSetting& readPref) {
+    if (!isEligible(opCtx, query)) {
+        return boost::none;
+    }
+
+    // Key on the find command with its filter replaced by the normalized predicate of the canonical
+    // query, so that logically identical filters which differ only in the order of their clauses
+    // share an entry.
+    BSONObjBuilder keyBuilder;
+    keyBuilder.append("ns", query.nss().ns());
+    keyBuilder.append("filter", query.root()->serialize());
+    for (auto&& elem : query.getFindCommandRequest().toBSON(BSONObj())) {
+        if (!kFieldsExcludedFromKey.count(elem.fieldName())) {
+            keyBuilder.append(elem);
+        }
+    }
+    keyBuilder.append("$readPreference", readPref.toInnerBSON());
+    keyBuilder.append(
+        "readConcernLevel",
+        repl::readConcernLevels::toString(repl::ReadConcernArgs::get(opCtx).getLevel()));
+    if (auto userName = AuthorizationSession::get(opCtx->getClient())->getAuthenticatedUserName()) {
+        keyBuilder.append("$user", userName->getUnambiguousName());
+    }
+    auto keyObj = keyBuilder.done();
+
+    return Key{query.nss(),
+               std::string(keyObj.objdata(), keyObj.objsize()),
+               _generation(query.nss()).load()};
+}
+
+boost::optional<std::vector<BSONObj>> ClusterQueryResultCache::lookup(OperationContext* opCtx,
+                                                                      const Key& key,
+                                                                      const ChunkManager& cm) {
+    const auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto swEntry = _entries.get(key.key);
+    if (!swEntry.isOK()) {
+        queryResultCacheMisses.increment();
+        return boost::none;
+    }
+
+    const auto& entry = swEntry.getValue()->second;
+    const bool isValid = entry->generation == _generation(key.nss).load() &&
+        entry->expiresAt > now && entry->dbVersion == cm.dbVersion() &&
+        entry->collectionVersion == getCollectionVersion(cm);
+    if (!isValid) {
+        _entries.erase(key.key);
+        queryResultCacheMisses.increment();
+        return boost::none;
+    }
+
+    queryResultCacheHits.increment();
+    OperationTimeTracker::get(opCtx)->updateOperationTime(entry->operationTime);
+    return entry->results;
+}
+
+void ClusterQueryResultCache::insert(OperationContext* opCtx,
+                                     const Key& key,
+                                     const ChunkManager& cm,
+                                     const std::vector<BSONObj>& results) {
+    // A hit reports the operationTime of the reads which filled the entry, so that a causally
+    // consistent session does not learn of a later one than the result reflects.
+    const auto operationTime = OperationTimeTracker::get(opCtx)->getMaxOperationTime();
+    if (!VectorClock::isValidComponentTime(operationTime)) {
+        return;
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->nss = key.nss;
+    entry->generation = key.generation;
+    entry->dbVersion = cm.dbVersion();
+    entry->collectionVersion = getCollectionVersion(cm);
+    entry->operationTime = operationTime;
+    entry->expiresAt = opCtx->getServiceContext()->getFastClockSource()->now() +
+        Milliseconds(gClusterQueryResultCacheTTLMillis.load());
+    entry->bytes = key.key.size() + kEntryOverheadBytes;
+    entry->results.reserve(results.size());
+    for (const auto& result : results) {
+        entry->results.push_back(result.getOwned());
+        entry->bytes += result.objsize();
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    _resizeIfNeeded(lk);
+    if (entry->bytes > _maxSizeBytes || key.generation != _generation(key.nss).load()) {
+        return;
+    }
+
+    queryResultCacheInserts.increment();
+    queryResultCacheEvictions.increment(_entries.add(key.key, std::move(entry)));
+}
+
+bool ClusterQueryResultCache::isEnabled() {
+    return cacheEnabled.load();
+}
+
+void ClusterQueryResultCache::onWrite(const NamespaceString& nss) {
+    _generation(nss).fetchAndAdd(1);
+}
+
+void ClusterQueryResultCache::invalidateAll() {
+    for (auto& generation : _generations) {
+        generation.fetchAndAdd(1);
+    }
+    clear();
+}
+
+void ClusterQueryResultCache::clear() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _entries.clear();
+}
+
+void ClusterQueryResultCache::_resizeIfNeeded(WithLock) {
+    const auto maxSizeBytes = static_cast<size_t>(gClusterQueryResultCacheSizeBytes.load());
+    if (maxSizeBytes != _maxSizeBytes) {
+        _maxSizeBytes = maxSizeBytes;
+        queryResultCacheEvictions.increment(_entries.reset(maxSizeBytes));
+    }
+}
+
+AtomicWord<uint64_t>& ClusterQueryResultCache::_generation(const NamespaceString& nss) {
+    return _generations[absl::Hash<NamespaceString>{}(nss) % kNumGenerationSlots];
+}
+
+}  // namespace mongo
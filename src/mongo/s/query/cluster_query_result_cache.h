@@ -0,0 +1,204 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <array>
+#include <boost/optional.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/base/status.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/logical_time.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/query/lru_key_value.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/s/chunk_version.h"
+#include "mongo/s/database_version.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class CanonicalQuery;
+class ChunkManager;
+class OperationContext;
+class ServiceContext;
+struct ReadPreferenceSetting;
+
+/**
+ * Validation callback for the 'clusterQueryResultCacheNamespaces' server parameter.
+ */
+Status validateClusterQueryResultCacheNamespaces(const std::vector<std::string>& value);
+
+/**
+ * Update callback for the 'clusterQueryResultCacheNamespaces' server parameter.
+ */
+Status onUpdateClusterQueryResultCacheNamespaces(const std::vector<std::string>& value);
+
+/**
+ * Caches the results of find commands on mongos for the namespaces listed in the
+ * 'clusterQueryResultCacheNamespaces' server parameter, so that identical queries against reference
+ * data which changes rarely can be answered without contacting the shards.
+ *
+ * Only queries whose entire result fits in the first batch are cached, and only when they run
+ * outside of a transaction with a read concern that does not ask for a particular point in time.
+ * Queries which generate random numbers, read $$NOW or $$CLUSTER_TIME, run JavaScript, or compute
+ * projected fields are not cached either, since two runs against the same data may differ.
+ * A cached result is served as long as all of the following hold:
+ *  - It is younger than 'clusterQueryResultCacheTTLMillis'.
+ *  - The routing information for the collection has the same version as when the result was
+ *    cached. Any refresh of the CatalogCache entry which changes the placement of the collection
+ *    therefore invalidates it.
+ *  - No write to the namespace has been routed through this mongos since the query started.
+ *
+ * The total size of the cached results is bounded by 'clusterQueryResultCacheSizeBytes', beyond
+ * which the least recently used results are evicted.
+ */
+class ClusterQueryResultCache {
+    ClusterQueryResultCache(const ClusterQueryResultCache&) = delete;
+    ClusterQueryResultCache& operator=(const ClusterQueryResultCache&) = delete;
+
+public:
+    ClusterQueryResultCache();
+
+    static ClusterQueryResultCache* get(ServiceContext* serviceContext);
+    static ClusterQueryResultCache* get(OperationContext* opCtx);
+
+    /**
+     * Identifies the result of a query in the cache, along with the write generation of its
+     * namespace at the time the query started.
+     */
+    struct Key {
+        NamespaceString nss;
+        std::string key;
+        uint64_t generation;
+    };
+
+    /**
+     * Returns the key under which the result of 'query' is cached, or boost::none if the query is
+     * not eligible for caching. Must be called before the query is sent to the shards, so that
+     * writes which complete while it runs prevent its result from being cached. Each authenticated
+     * user has its own keys.
+     */
+    boost::optional<Key> makeKey(OperationContext* opCtx,
+                                 const CanonicalQuery& query,
+                                 const ReadPreferenceSetting& readPref);
+
+    /**
+     * Returns the cached result for 'key' if there is one which is still valid for the routing
+     * information in 'cm'. On a hit, the operationTime of the reads which filled the entry is
+     * reported as the operationTime of 'opCtx'.
+     */
+    boost::optional<std::vector<BSONObj>> lookup(OperationContext* opCtx,
+                                                 const Key& key,
+                                                 const ChunkManager& cm);
+
+    /**
+     * Caches 'results' as the complete result for 'key', obtained using the routing information in
+     * 'cm'. Does nothing if a write to the namespace was routed through this mongos after 'key' was
+     * made, if the result is too large for the cache, or if the shards did not report the
+     * operationTime of their reads.
+     */
+    void insert(OperationContext* opCtx,
+                const Key& key,
+                const ChunkManager& cm,
+                const std::vector<BSONObj>& results);
+
+    /**
+     * Returns whether any namespace is configured for caching.
+     */
+    static bool isEnabled();
+
+    /**
+     * Invalidates all cached results for 'nss'. Called once a write to 'nss' routed through this
+     * mongos has completed, successfully or not. Does not take any lock, so that writes do not
+     * contend on the cache.
+     */
+    void onWrite(const NamespaceString& nss);
+
+    /**
+     * Invalidates all cached results, including those of queries which are still running.
+     */
+    void invalidateAll();
+
+    /**
+     * Drops all cached results.
+     */
+    void clear();
+
+private:
+    struct Entry {
+        NamespaceString nss;
+        uint64_t generation;
+        DatabaseVersion dbVersion;
+        boost::optional<ChunkVersion> collectionVersion;
+        LogicalTime operationTime;
+        Date_t expiresAt;
+        std::vector<BSONObj> results;
+        size_t bytes;
+    };
+
+    struct EntryBudgetEstimator {
+        size_t operator()(const std::shared_ptr<const Entry>& entry) {
+            return entry->bytes;
+        }
+    };
+
+    using EntryMap =
+        LRUKeyValue<std::string, std::shared_ptr<const Entry>, EntryBudgetEstimator>;
+
+    /**
+     * Applies the current value of 'clusterQueryResultCacheSizeBytes' to the cache.
+     */
+    void _resizeIfNeeded(WithLock);
+
+    /**
+     * Returns the write generation shared by 'nss' and the other namespaces which hash to the same
+     * slot.
+     */
+    AtomicWord<uint64_t>& _generation(const NamespaceString& nss);
+
+    Mutex _mutex = MONGO_MAKE_LATCH("ClusterQueryResultCache::_mutex");
+
+    EntryMap _entries;
+    size_t _maxSizeBytes;
+
+    // The number of writes routed through this mongos to the namespaces which hash to each slot. A
+    // cached result is only valid while the generation of its namespace is unchanged. Namespaces
+    // which share a slot only invalidate each other's results more often than needed.
+    static constexpr size_t kNumGenerationSlots = 1024;
+    std::array<AtomicWord<uint64_t>, kNumGenerationSlots> _generations;
+};
+
+}  // namespace mongo
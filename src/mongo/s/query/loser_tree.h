@@ -0,0 +1,219 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+/**
+ * A tournament tree of losers over a fixed number of leaves, used to repeatedly select the smallest
+ * of several sorted input streams. Each leaf is identified by its index and is either active (it
+ * currently has a value to merge) or inactive. 'Comparator' is a callable which, given two active
+ * leaf indexes, returns an int less than, equal to, or greater than zero as the current value of
+ * the first leaf sorts before, equal to, or after the current value of the second. Ties are broken
+ * by leaf index so that the merge order is deterministic.
+ *
+ * The interface mirrors std::priority_queue so that the tree can be used as a drop-in merge queue,
+ * but the cost profile is different: replacing the value of the winning leaf, which is the common
+ * case of a merge, takes exactly log2(n) comparisons against the losers stored on its path, while
+ * a priority queue needs a pop and a push of up to 2 * log2(n) comparisons each. Activating a leaf
+ * which is not the winner invalidates the tree, which is then rebuilt with n - 1 comparisons the
+ * next time the winner is requested.
+ *
+ * As with std::priority_queue, the value of an active leaf must not change other than through
+ * replaceTop() while that leaf is the winner.
+ */
+template <typename Comparator>
+class LoserTree {
+public:
+    explicit LoserTree(Comparator comparator, size_t numLeaves = 0)
+        : _comparator(std::move(comparator)) {
+        resize(numLeaves);
+    }
+
+    /**
+     * Changes the number of leaves. New leaves are inactive. Shrinking the tree deactivates the
+     * leaves which are removed.
+     */
+    void resize(size_t numLeaves) {
+        for (size_t leaf = numLeaves; leaf < _active.size(); ++leaf) {
+            _numActive -= _active[leaf];
+        }
+        _active.resize(numLeaves, false);
+        _losers.resize(numLeaves);
+        _dirty = true;
+    }
+
+    bool empty() const {
+        return _numActive == 0;
+    }
+
+    size_t size() const {
+        return _numActive;
+    }
+
+    /**
+     * Returns the index of the active leaf whose value sorts first. Illegal to call on an empty
+     * tree.
+     */
+    size_t top() {
+        invariant(!empty());
+        if (_dirty) {
+            _rebuild();
+        }
+        return _winner;
+    }
+
+    /**
+     * Deactivates the leaf returned by top().
+     */
+    void pop() {
+        const auto winner = top();
+        _active[winner] = false;
+        --_numActive;
+        _replay(winner);
+    }
+
+    /**
+     * Replays the matches of the leaf returned by top() after its value has changed. Equivalent to
+     * a pop() followed by a push() of the same leaf.
+     */
+    void replaceTop() {
+        _replay(top());
+    }
+
+    /**
+     * Activates 'leaf', which must currently be inactive.
+     */
+    void push(size_t leaf) {
+        invariant(leaf < _active.size());
+        invariant(!_active[leaf]);
+        _active[leaf] = true;
+        ++_numActive;
+        _dirty = true;
+    }
+
+    /**
+     * Deactivates 'leaf' if it is active, whether or not it is the winner.
+     */
+    void erase(size_t leaf) {
+        invariant(leaf < _active.size());
+        if (_active[leaf]) {
+            _active[leaf] = false;
+            --_numActive;
+            _dirty = true;
+        }
+    }
+
+private:
+    /**
+     * Returns true if 'lhs' wins its match against 'rhs'. An inactive leaf loses to every active
+     * leaf.
+     */
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (!_active[rhs]) {
+            return _active[lhs] || lhs < rhs;
+        }
+        if (!_active[lhs]) {
+            return false;
+        }
+        const int cmp = _comparator(lhs, rhs);
+        return cmp < 0 || (cmp == 0 && lhs < rhs);
+    }
+
+    /**
+     * Plays every match bottom-up. The leaves occupy the implicit node positions [n, 2n) and the
+     * internal node i, for i in [1, n), plays the winners of nodes 2i and 2i + 1.
+     */
+    void _rebuild() {
+        const size_t n = _active.size();
+        _winners.resize(2 * n);
+        for (size_t leaf = 0; leaf < n; ++leaf) {
+            _winners[n + leaf] = leaf;
+        }
+        for (size_t node = n - 1; node >= 1; --node) {
+            auto left = _winners[2 * node];
+            auto right = _winners[2 * node + 1];
+            if (_beats(left, right)) {
+                _winners[node] = left;
+                _losers[node] = right;
+            } else {
+                _winners[node] = right;
+                _losers[node] = left;
+            }
+        }
+        _winner = n > 1 ? _winners[1] : 0;
+        _dirty = false;
+    }
+
+    /**
+     * Replays the path from the winning leaf 'leaf' to the root against the losers stored along
+     * it. Only valid when 'leaf' was the winner of every match on that path.
+     */
+    void _replay(size_t leaf) {
+        if (_dirty) {
+            return;
+        }
+        const size_t n = _active.size();
+        size_t candidate = leaf;
+        for (size_t node = (n + leaf) / 2; node >= 1; node /= 2) {
+            if (_beats(_losers[node], candidate)) {
+                std::swap(_losers[node], candidate);
+            }
+        }
+        _winner = candidate;
+    }
+
+    Comparator _comparator;
+
+    // Whether each leaf currently participates in the merge. Stored as bytes rather than as a
+    // std::vector<bool> to keep the hot comparison path free of bit manipulation.
+    std::vector<char> _active;
+
+    // _losers[i] is the leaf which lost the match played at internal node i. Index 0 is unused.
+    std::vector<size_t> _losers;
+
+    // Scratch space for _rebuild(), kept to avoid reallocating on every rebuild.
+    std::vector<size_t> _winners;
+
+    size_t _winner = 0;
+    size_t _numActive = 0;
+
+    // Set when a leaf was activated or deactivated out of turn and the stored losers are stale.
+    bool _dirty = true;
+};
+
+}  // namespace mongo
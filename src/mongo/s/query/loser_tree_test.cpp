@@ -0,0 +1,166 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/s/query/loser_tree.h"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "mongo/platform/random.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+
+namespace {
+
+/**
+ * Merges sorted integer runs through a LoserTree, the same way AsyncResultsMerger merges the
+ * buffers of its remotes.
+ */
+class RunComparator {
+public:
+    explicit RunComparator(const std::vector<std::deque<int>>& runs) : _runs(runs) {}
+
+    int operator()(size_t lhs, size_t rhs) const {
+        return _runs[lhs].front() - _runs[rhs].front();
+    }
+
+private:
+    const std::vector<std::deque<int>>& _runs;
+};
+
+std::vector<std::pair<int, size_t>> mergeRuns(std::vector<std::deque<int>> runs) {
+    LoserTree<RunComparator> tree(RunComparator(runs), runs.size());
+    for (size_t i = 0; i < runs.size(); ++i) {
+        if (!runs[i].empty()) {
+            tree.push(i);
+        }
+    }
+
+    std::vector<std::pair<int, size_t>> merged;
+    while (!tree.empty()) {
+        auto winner = tree.top();
+        merged.emplace_back(runs[winner].front(), winner);
+        runs[winner].pop_front();
+        if (runs[winner].empty()) {
+            tree.pop();
+        } else {
+            tree.replaceTop();
+        }
+    }
+    return merged;
+}
+
+TEST(LoserTreeTest, EmptyTree) {
+    std::vector<std::deque<int>> runs;
+    LoserTree<RunComparator> tree(RunComparator(runs));
+    ASSERT_TRUE(tree.empty());
+    ASSERT_EQ(tree.size(), 0U);
+
+    runs.resize(3);
+    tree.resize(3);
+    ASSERT_TRUE(tree.empty());
+}
+
+TEST(LoserTreeTest, SingleLeaf) {
+    auto merged = mergeRuns({{1, 2, 3}});
+    ASSERT_EQ(merged.size(), 3U);
+    ASSERT_EQ(merged[0].first, 1);
+    ASSERT_EQ(merged[1].first, 2);
+    ASSERT_EQ(merged[2].first, 3);
+}
+
+TEST(LoserTreeTest, MergesRunsInOrderAndBreaksTiesByLeaf) {
+    auto merged = mergeRuns({{2, 4, 6}, {}, {1, 4, 7}, {4}, {3, 5}});
+    std::vector<std::pair<int, size_t>> expected = {
+        {1, 2}, {2, 0}, {3, 4}, {4, 0}, {4, 2}, {4, 3}, {5, 4}, {6, 0}, {7, 2}};
+    ASSERT_EQ(merged.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(merged[i].first, expected[i].first);
+        ASSERT_EQ(merged[i].second, expected[i].second);
+    }
+}
+
+TEST(LoserTreeTest, MatchesSortForRandomRuns) {
+    PseudoRandom random(SecureRandom().nextInt64());
+    for (size_t numRuns : {1, 2, 3, 5, 8, 13, 100}) {
+        std::vector<std::deque<int>> runs(numRuns);
+        std::vector<int> all;
+        for (auto& run : runs) {
+            const auto length = random.nextInt32(20);
+            for (int i = 0; i < length; ++i) {
+                run.push_back(random.nextInt32(50));
+                all.push_back(run.back());
+            }
+            std::sort(run.begin(), run.end());
+        }
+        std::sort(all.begin(), all.end());
+
+        auto merged = mergeRuns(runs);
+        ASSERT_EQ(merged.size(), all.size());
+        for (size_t i = 0; i < all.size(); ++i) {
+            ASSERT_EQ(merged[i].first, all[i]);
+        }
+    }
+}
+
+TEST(LoserTreeTest, PushAndEraseOutOfTurn) {
+    std::vector<std::deque<int>> runs = {{5}, {3}, {4}, {1}};
+    LoserTree<RunComparator> tree(RunComparator(runs), runs.size());
+    tree.push(0);
+    tree.push(1);
+    ASSERT_EQ(tree.top(), 1U);
+
+    // Activating a leaf which sorts before the current winner takes effect immediately.
+    tree.push(3);
+    ASSERT_EQ(tree.top(), 3U);
+
+    // So does removing the winner, or any other leaf.
+    tree.erase(3);
+    tree.erase(0);
+    tree.push(2);
+    ASSERT_EQ(tree.size(), 2U);
+    ASSERT_EQ(tree.top(), 1U);
+    tree.pop();
+    ASSERT_EQ(tree.top(), 2U);
+    tree.pop();
+    ASSERT_TRUE(tree.empty());
+
+    // Erasing an inactive leaf is a no-op.
+    tree.erase(2);
+    ASSERT_TRUE(tree.empty());
+}
+
+}  // namespace
+
+}  // namespace mongo
@@ -122,10 +122,24 @@ StatusWith<TaskExecutor::CallbackHandle> ShardingTaskExecutor::scheduleRemoteCom
     const RemoteCommandRequestOnAny& request,
     const RemoteCommandOnAnyCallbackFn& cb,
     const BatonHandle& baton) {
+    return _scheduleRemoteCommandOnAny(request, cb, baton, false /* isExhaust */);
+}
+
+StatusWith<TaskExecutor::CallbackHandle> ShardingTaskExecutor::_scheduleRemoteCommandOnAny(
+    const RemoteCommandRequestOnAny& request,
+    const RemoteCommandOnAnyCallbackFn& cb,
+    const BatonHandle& baton,
+    bool isExhaust) {
+    auto schedule = [&](const RemoteCommandRequestOnAny& requestToSchedule,
+                        const RemoteCommandOnAnyCallbackFn& callback) {
+        return isExhaust
+            ? _executor->scheduleExhaustRemoteCommandOnAny(requestToSchedule, callback, baton)
+            : _executor->scheduleRemoteCommandOnAny(requestToSchedule, callback, baton);
+    };
 
     // schedule the user's callback if there is not opCtx
     if (!request.opCtx) {
-        return _executor->scheduleRemoteCommandOnAny(request, cb, baton);
+        return schedule(request, cb);
     }
 
     boost::optional<RemoteCommandRequestOnAny> requestWithFixedLsid = [&] {
@@ -233,15 +247,16 @@ StatusWith<TaskExecutor::CallbackHandle> ShardingTaskExecutor::scheduleRemoteCom
         }
     };
 
-    return _executor->scheduleRemoteCommandOnAny(
-        requestWithFixedLsid ? *requestWithFixedLsid : request, shardingCb, baton);
+    return schedule(requestWithFixedLsid ? *requestWithFixedLsid : request, shardingCb);
 }
 
 StatusWith<TaskExecutor::CallbackHandle> ShardingTaskExecutor::scheduleExhaustRemoteCommandOnAny(
     const RemoteCommandRequestOnAny& request,
     const RemoteCommandOnAnyCallbackFn& cb,
     const BatonHandle& baton) {
-    MONGO_UNREACHABLE;
+    // Every reply of the exhaust command updates the operation time and the replica set monitor,
+    // just as the reply of a regular remote command does.
+    return _scheduleRemoteCommandOnAny(request, cb, baton, true /* isExhaust */);
 }
 
 bool ShardingTaskExecutor::hasTasks() {
@@ -89,6 +89,11 @@ public:
     void dropConnections(const HostAndPort& hostAndPort) override;
 
 private:
+    StatusWith<CallbackHandle> _scheduleRemoteCommandOnAny(const RemoteCommandRequestOnAny& request,
+                                                           const RemoteCommandOnAnyCallbackFn& cb,
+                                                           const BatonHandle& baton,
+                                                           bool isExhaust);
+
     std::unique_ptr<ThreadPoolTaskExecutor> _executor;
 };
 
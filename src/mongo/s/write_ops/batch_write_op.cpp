@@ -31,6 +31,7 @@
 
 #include "mongo/s/write_ops/batch_write_op.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "mongo/base/error_codes.h"
@@ -61,6 +62,10 @@ struct WriteErrorComp {
 // TODO: Revisit when we revisit command limits in general
 const int kEstDeleteOverheadBytes = (BSONObjMaxInternalSize - BSONObjMaxUserSize) / 100;
 
+// Number of inserts targeted in bulk by the first call to NSTargeter::targetInserts of a round of
+// targeting. Every subsequent call targets twice as many inserts as the previous one.
+const size_t kInitialNumInsertsToTargetInBulk = 128;
+
 /**
  * Returns a new write concern that has the copy of every field from the original
  * document but with a w set to 1. This is intended for upgrading { w: 0 } write
@@ -320,6 +325,42 @@ Status BatchWriteOp::targetBatch(
 
     const size_t numWriteOps = _clientRequest.sizeWriteOps();
 
+    //
+    // Inserts are targeted in bulk, a window of the remaining ops at a time, so that the targeter
+    // can resolve the whole window through a single walk of the routing table rather than a search
+    // per document. Since the loop below may stop early (ordered batches stop at the first document
+    // which goes to another shard), the window starts small and doubles every time it is used up.
+    //
+    const bool isInsert = _clientRequest.getBatchType() == BatchedCommandRequest::BatchType_Insert;
+    std::vector<boost::optional<ShardEndpoint>> insertEndpoints(isInsert ? numWriteOps : 0);
+    size_t numInsertsTargetedInBulk = 0;
+    size_t numInsertsToTargetInBulk = kInitialNumInsertsToTargetInBulk;
+
+    auto targetNextInsertsInBulk = [&](size_t begin) {
+        const size_t end = std::min(numWriteOps, begin + numInsertsToTargetInBulk);
+        numInsertsTargetedInBulk = end;
+        numInsertsToTargetInBulk *= 2;
+
+        std::vector<size_t> indexes;
+        std::vector<BSONObj> docs;
+        for (size_t i = begin; i < end; ++i) {
+            if (_writeOps[i].getWriteState() == WriteOpState_Ready) {
+                indexes.push_back(i);
+                docs.push_back(_clientRequest.getInsertRequest().getDocuments()[i]);
+            }
+        }
+
+        // Any insert which could not be targeted in bulk is targeted on its own below, which
+        // reports why targeting it failed
+        try {
+            auto endpoints = targeter.targetInserts(_opCtx, docs);
+            for (size_t i = 0; i < indexes.size(); ++i) {
+                insertEndpoints[indexes[i]] = std::move(endpoints[i]);
+            }
+        } catch (const DBException&) {
+        }
+    };
+
     for (size_t i = 0; i < numWriteOps; ++i) {
         WriteOp& writeOp = _writeOps[i];
 
@@ -333,9 +374,17 @@ Status BatchWriteOp::targetBatch(
         // TargetedWrites need to be owned once returned
         std::vector<std::unique_ptr<TargetedWrite>> writes;
 
+        if (isInsert && i >= numInsertsTargetedInBulk) {
+            targetNextInsertsInBulk(i);
+        }
+
         Status targetStatus = Status::OK();
         try {
-            writeOp.targetWrites(_opCtx, targeter, &writes);
+            if (isInsert && insertEndpoints[i]) {
+                writeOp.targetInsertWrite(std::move(*insertEndpoints[i]), &writes);
+            } else {
+                writeOp.targetWrites(_opCtx, targeter, &writes);
+            }
         } catch (const DBException& ex) {
             targetStatus = ex.toStatus();
         }
@@ -115,6 +115,18 @@ void WriteOp::targetWrites(OperationContext* opCtx,
         endpoints = targeter.targetAllShards(opCtx);
     }
 
+    _addTargetedWrites(std::move(endpoints), inTransaction, targetedWrites);
+}
+
+void WriteOp::targetInsertWrite(ShardEndpoint endpoint,
+                                std::vector<std::unique_ptr<TargetedWrite>>* targetedWrites) {
+    invariant(_itemRef.getOpType() == BatchedCommandRequest::BatchType_Insert);
+    _addTargetedWrites(std::vector{std::move(endpoint)}, false /* inTransaction */, targetedWrites);
+}
+
+void WriteOp::_addTargetedWrites(std::vector<ShardEndpoint> endpoints,
+                                 bool inTransaction,
+                                 std::vector<std::unique_ptr<TargetedWrite>>* targetedWrites) {
     for (auto&& endpoint : endpoints) {
         // If the operation was already successfull on that shard, do not repeat it
         if (_successfulShardSet.count(endpoint.shardName))
@@ -122,6 +122,13 @@ public:
                       const NSTargeter& targeter,
                       std::vector<std::unique_ptr<TargetedWrite>>* targetedWrites);
 
+    /**
+     * Same as targetWrites, for an insert whose endpoint has already been determined as part of
+     * targeting the whole batch through NSTargeter::targetInserts.
+     */
+    void targetInsertWrite(ShardEndpoint endpoint,
+                           std::vector<std::unique_ptr<TargetedWrite>>* targetedWrites);
+
     /**
      * Returns the number of child writes that were last targeted.
      */
@@ -160,6 +167,14 @@ public:
     void setOpError(const write_ops::WriteError& error);
 
 private:
+    /**
+     * Creates a TargetedWrite for each of the specified endpoints on which the operation has not
+     * already succeeded.
+     */
+    void _addTargetedWrites(std::vector<ShardEndpoint> endpoints,
+                            bool inTransaction,
+                            std::vector<std::unique_ptr<TargetedWrite>>* targetedWrites);
+
     /**
      * Updates the op state after new information is received.
      */
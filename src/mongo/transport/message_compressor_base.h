@@ -103,6 +103,31 @@ public:
         return _compressBytesOut.loadRelaxed();
     }
 
+    /*
+     * This returns the number of messages which were sent uncompressed, even though this
+     * compressor was selected, because they were too small or did not compress
+     */
+    int64_t getCompressorMessagesSkipped() const {
+        return _compressMessagesSkipped.loadRelaxed();
+    }
+
+    /*
+     * Called by the MessageCompressorManager when it decides to send a message uncompressed
+     * instead of using this compressor
+     */
+    void counterHitSkip() {
+        _compressMessagesSkipped.addAndFetch(1);
+    }
+
+    /*
+     * Called by the MessageCompressorManager to bump the bytesIn/bytesOut counters for compression
+     * once it sends a message compressed by this compressor
+     */
+    void counterHitCompress(int64_t bytesIn, int64_t bytesOut) {
+        _compressBytesIn.addAndFetch(bytesIn);
+        _compressBytesOut.addAndFetch(bytesOut);
+    }
+
     /*
      * This returns the number of bytes passed in the input for decompressData
      */
@@ -126,14 +151,6 @@ protected:
         : _id{static_cast<MessageCompressorId>(id)},
           _name{getMessageCompressorName(id).toString()} {}
 
-    /*
-     * Called by sub-classes to bump their bytesIn/bytesOut counters for compression
-     */
-    void counterHitCompress(int64_t bytesIn, int64_t bytesOut) {
-        _compressBytesIn.addAndFetch(bytesIn);
-        _compressBytesOut.addAndFetch(bytesOut);
-    }
-
     /*
      * Called by sub-classes to bump their bytesIn/bytesOut counters for decompression
      */
@@ -148,6 +165,7 @@ private:
 
     AtomicWord<long long> _compressBytesIn;
     AtomicWord<long long> _compressBytesOut;
+    AtomicWord<long long> _compressMessagesSkipped;
 
     AtomicWord<long long> _decompressBytesIn;
     AtomicWord<long long> _decompressBytesOut;
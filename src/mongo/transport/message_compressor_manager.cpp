@@ -38,6 +38,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/message.h"
+#include "mongo/transport/message_compressor_parameters_gen.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/session.h"
 
@@ -97,6 +98,13 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
         return {msg};
     }
 
+    // Small messages rarely compress well enough to be worth the CPU, so send them as-is. The
+    // receiving side accepts uncompressed messages regardless of what was negotiated.
+    if (msg.dataSize() < gNetworkMessageCompressionMinSizeBytes.load()) {
+        compressor->counterHitSkip();
+        return {msg};
+    }
+
     LOGV2_DEBUG(22925,
                 3,
                 "Compressing message with {compressor}",
@@ -139,6 +147,21 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
         return sws.getStatus();
 
     auto realCompressedSize = sws.getValue();
+    if (gNetworkMessageCompressionSkipIncompressible.load() &&
+        realCompressedSize + CompressionHeader::size() >=
+            static_cast<size_t>(inputHeader.dataLen())) {
+        LOGV2_DEBUG(7460100,
+                    3,
+                    "Compressed message is not smaller than the original, returning original "
+                    "uncompressed message",
+                    "compressor"_attr = compressor->getName(),
+                    "originalSize"_attr = inputHeader.dataLen(),
+                    "compressedSize"_attr = realCompressedSize);
+        compressor->counterHitSkip();
+        return {msg};
+    }
+
+    compressor->counterHitCompress(inputHeader.dataLen(), realCompressedSize);
     outMessage.setLen(realCompressedSize + CompressionHeader::size() + MsgData::MsgDataHeaderSize);
 
     return {Message(outputMessageBuffer)};
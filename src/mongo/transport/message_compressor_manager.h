@@ -94,7 +94,10 @@ public:
      * parameter value for compressorId from a call to decompressMessage.
      *
      * If _negotiated is empty (meaning compression was not negotiated or is not supported), then
-     * it will return a ref-count bumped copy of the input message.
+     * it will return a ref-count bumped copy of the input message. The same is true when the
+     * message is smaller than networkMessageCompressionMinSizeBytes, or when
+     * networkMessageCompressionSkipIncompressible is set and compression would not make the
+     * message any smaller.
      *
      * If an error occurs in the compressor, it will return a Status error.
      */
@@ -30,11 +30,13 @@
 
 #include "mongo/platform/basic.h"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/rpc/message.h"
 #include "mongo/transport/message_compressor_manager.h"
 #include "mongo/transport/message_compressor_noop.h"
@@ -345,6 +347,100 @@ TEST(MessageCompressorManager, SERVER_28008) {
     ASSERT_EQ(compressorId, zstdId);
 }
 
+MessageCompressorManager negotiateSingleCompressor(MessageCompressorRegistry* registry,
+                                                   StringData compressorName) {
+    MessageCompressorManager mgr(registry);
+    std::vector<StringData> negotiator({compressorName});
+    BSONObjBuilder negotiatorOut;
+    mgr.serverNegotiate(negotiator, &negotiatorOut);
+    checkNegotiationResult(negotiatorOut.done(), {compressorName.toString()});
+    return mgr;
+}
+
+TEST(MessageCompressorManager, SkipsMessagesBelowMinSize) {
+    MessageCompressorRegistry registry;
+    registry.setSupportedCompressors({"zstd"});
+    registry.registerImplementation(std::make_unique<ZstdMessageCompressor>());
+    ASSERT_OK(registry.finalizeSupportedCompressors());
+    auto mgr = negotiateSingleCompressor(&registry, "zstd"_sd);
+    const auto compressor = registry.getCompressor("zstd");
+
+    auto msg = buildMessage();
+    RAIIServerParameterControllerForTest minSize("networkMessageCompressionMinSizeBytes",
+                                                 msg.dataSize() + 1);
+    auto out = assertOk(mgr.compressMessage(msg));
+    ASSERT_EQ(out.operation(), dbQuery);
+    ASSERT_EQ(out.buf(), msg.buf());
+    ASSERT_EQ(compressor->getCompressorMessagesSkipped(), 1);
+    ASSERT_EQ(compressor->getCompressorBytesIn(), 0);
+
+    RAIIServerParameterControllerForTest exactSize("networkMessageCompressionMinSizeBytes",
+                                                   msg.dataSize());
+    out = assertOk(mgr.compressMessage(msg));
+    ASSERT_EQ(out.operation(), dbCompressed);
+    ASSERT_EQ(compressor->getCompressorMessagesSkipped(), 1);
+}
+
+TEST(MessageCompressorManager, SkipsIncompressibleMessages) {
+    MessageCompressorRegistry registry;
+    registry.setSupportedCompressors({"noop"});
+    registry.registerImplementation(std::make_unique<NoopMessageCompressor>());
+    ASSERT_OK(registry.finalizeSupportedCompressors());
+    auto mgr = negotiateSingleCompressor(&registry, "noop"_sd);
+    const auto compressor = registry.getCompressor("noop");
+
+    // The noop compressor never shrinks its input, so with the check enabled every message
+    // goes out uncompressed.
+    auto msg = buildMessage();
+    auto out = assertOk(mgr.compressMessage(msg));
+    ASSERT_EQ(out.operation(), dbCompressed);
+    ASSERT_EQ(compressor->getCompressorBytesIn(), msg.dataSize());
+    ASSERT_EQ(compressor->getCompressorBytesOut(), msg.dataSize());
+
+    // Messages sent uncompressed are not counted as compressed.
+    RAIIServerParameterControllerForTest skip("networkMessageCompressionSkipIncompressible", true);
+    out = assertOk(mgr.compressMessage(msg));
+    ASSERT_EQ(out.operation(), dbQuery);
+    ASSERT_EQ(out.buf(), msg.buf());
+    ASSERT_EQ(compressor->getCompressorMessagesSkipped(), 1);
+    ASSERT_EQ(compressor->getCompressorBytesIn(), msg.dataSize());
+    ASSERT_EQ(compressor->getCompressorBytesOut(), msg.dataSize());
+}
+
+TEST(MessageCompressorManager, CompressesAtConfiguredZstdLevel) {
+    // Text drawn from a small vocabulary, which higher levels compress noticeably better.
+    const std::vector<std::string> words = {
+        "shard", "chunk", "range", "index", "query", "write", "batch", "cursor"};
+    std::string data;
+    uint32_t seed = 1;
+    while (data.size() < 64 * 1024) {
+        seed = seed * 1103515245 + 12345;
+        data += words[(seed >> 16) % words.size()];
+        data += ' ';
+    }
+    ConstDataRange input(data.data(), data.size());
+
+    std::map<int, size_t> compressedSizes;
+    for (int level : {-5, 1, 3, 19}) {
+        RAIIServerParameterControllerForTest zstdLevel("networkMessageCompressionZstdLevel",
+                                                       level);
+        ZstdMessageCompressor compressor;
+        std::vector<char> compressed(compressor.getMaxCompressedSize(data.size()));
+        auto compressedSize = assertOk(
+            compressor.compressData(input, DataRange(compressed.data(), compressed.size())));
+
+        std::vector<char> decompressed(data.size());
+        auto decompressedSize = assertOk(compressor.decompressData(
+            ConstDataRange(compressed.data(), compressedSize),
+            DataRange(decompressed.data(), decompressed.size())));
+        ASSERT_EQ(decompressedSize, data.size());
+        ASSERT_EQ(memcmp(decompressed.data(), data.data(), data.size()), 0);
+        compressedSizes[level] = compressedSize;
+    }
+
+    ASSERT_LT(compressedSizes[19], compressedSizes[-5]);
+}
+
 TEST(MessageCompressorManager, MessageSizeTooLarge) {
     auto registry = buildRegistry();
     MessageCompressorManager compManager(&registry);
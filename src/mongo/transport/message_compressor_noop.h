@@ -41,7 +41,6 @@ public:
 
     StatusWith<std::size_t> compressData(ConstDataRange input, DataRange output) override try {
         output.write(input);
-        counterHitCompress(input.length(), input.length());
         return {input.length()};
     } catch (const DBException& e) {
         return e.toStatus();
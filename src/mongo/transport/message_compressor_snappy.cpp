@@ -55,7 +55,6 @@ StatusWith<std::size_t> SnappyMessageCompressor::compressData(ConstDataRange inp
     }
     snappy::RawCompress(input.data(), input.length(), const_cast<char*>(output.data()), &outLength);
 
-    counterHitCompress(input.length(), outLength);
     return {outLength};
 }
 
@@ -34,6 +34,7 @@
 #include <zstd.h>
 
 #include "mongo/base/init.h"
+#include "mongo/transport/message_compressor_parameters_gen.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/message_compressor_zstd.h"
 
@@ -51,13 +52,12 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
                                output.length(),
                                input.data(),
                                input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+                               gNetworkMessageCompressionZstdLevel.load());
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
                       str::stream() << "Could not compress input: " << ZSTD_getErrorName(ret)};
     }
-    counterHitCompress(input.length(), ret);
     return {ret};
 }
 
@@ -34,6 +34,8 @@
 #include "mongo/util/concurrency/admission_context.h"
 #include "mongo/util/concurrency/ticketholder.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include "mongo/logv2/log.h"
@@ -100,6 +102,10 @@ boost::optional<Ticket> ReaderWriterTicketHolder::waitForTicketUntil(OperationCo
     }
 }
 
+int ReaderWriterTicketHolder::queued() const {
+    return _reader->queued() + _writer->queued();
+}
+
 void ReaderWriterTicketHolder::appendStats(BSONObjBuilder& b) const {
     invariant(_writer, "Writer queue is not present in the ticketholder");
     invariant(_reader, "Reader queue is not present in the ticketholder");
@@ -144,13 +150,21 @@ Status TicketHolderWithQueueingStats::resize(int newSize) {
 
     AdmissionContext admCtx;
     while (_outof.load() < newSize) {
-        _release(&admCtx);
+        // New tickets were never held by an operation, so they are not accounted as finished.
+        if (!_tryConsumePendingReduction()) {
+            _releaseQueue(&admCtx);
+        }
         _outof.fetchAndAdd(1);
     }
 
     while (_outof.load() > newSize) {
-        auto ticket = waitForTicket(nullptr, &admCtx, WaitMode::kUninterruptible);
-        ticket.discard();
+        // Wait without going through the queue statistics, which only account for operations.
+        auto ticket = _tryAcquireImpl(&admCtx);
+        if (!ticket) {
+            ticket = _waitForTicketUntilImpl(
+                nullptr, &admCtx, Date_t::max(), WaitMode::kUninterruptible);
+        }
+        ticket->discard();
         _outof.subtractAndFetch(1);
     }
 
@@ -158,6 +172,47 @@ Status TicketHolderWithQueueingStats::resize(int newSize) {
     return Status::OK();
 }
 
+Status TicketHolderWithQueueingStats::resizeWithoutWaiting(int newSize) {
+    stdx::lock_guard<Latch> lk(_resizeMutex);
+
+    if (newSize < 5)
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "Minimum value for ticketholder is 5; given " << newSize);
+
+    AdmissionContext admCtx;
+    while (_outof.load() < newSize) {
+        // Keeping a ticket that was going to be dropped is the same as adding a new one.
+        if (!_tryConsumePendingReduction()) {
+            _releaseQueue(&admCtx);
+        }
+        _outof.fetchAndAdd(1);
+    }
+
+    while (_outof.load() > newSize) {
+        // Take an available ticket without going through the queue, so that it is not accounted
+        // in the statistics, or else drop the next ticket an operation releases.
+        if (auto ticket = _tryAcquireImpl(&admCtx)) {
+            ticket->discard();
+        } else {
+            _pendingReduction.fetchAndAdd(1);
+        }
+        _outof.subtractAndFetch(1);
+    }
+
+    invariant(_outof.load() == newSize);
+    return Status::OK();
+}
+
+bool TicketHolderWithQueueingStats::_tryConsumePendingReduction() noexcept {
+    auto pending = _pendingReduction.loadRelaxed();
+    while (pending > 0) {
+        if (_pendingReduction.compareAndSwap(&pending, pending - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void TicketHolderWithQueueingStats::appendStats(BSONObjBuilder& b) const {
     b.append("out", used());
     b.append("available", available());
@@ -184,6 +239,10 @@ void TicketHolderWithQueueingStats::_release(AdmissionContext* admCtx) noexcept
     auto tickSource = _serviceContext->getTickSource();
     auto delta = tickSource->spanTo<Microseconds>(startTime, tickSource->getTicks());
     _totalTimeProcessingMicros.fetchAndAddRelaxed(delta.count());
+    if (_tryConsumePendingReduction()) {
+        // The pool was shrunk while this ticket was held, so it is dropped instead.
+        return;
+    }
     _releaseQueue(admCtx);
 }
 
@@ -248,6 +307,166 @@ boost::optional<Ticket> TicketHolderWithQueueingStats::waitForTicketUntil(Operat
     }
 }
 
+namespace {
+
+// How quickly the baseline latency drifts towards a higher latency, so that a workload that has
+// become permanently slower does not keep shrinking the limit.
+constexpr double kBaselineDrift = 0.05;
+// The limit never shrinks by more than half of itself at once.
+constexpr double kMinGradient = 0.5;
+// How much of the distance to the newly computed limit is covered by every sample.
+constexpr double kLimitSmoothing = 0.2;
+
+}  // namespace
+
+int GradientConcurrencyController::sample(std::int64_t finished,
+                                          Microseconds processing,
+                                          int queued,
+                                          int minLimit,
+                                          int maxLimit) {
+    if (finished > 0) {
+        _latencyMicros =
+            std::max(1.0, static_cast<double>(processing.count()) / static_cast<double>(finished));
+        if (_baselineMicros == 0 || _latencyMicros < _baselineMicros) {
+            _baselineMicros = _latencyMicros;
+        } else {
+            _baselineMicros += (_latencyMicros - _baselineMicros) * kBaselineDrift;
+        }
+
+        // Leave room for the queue to drain only when operations are actually waiting.
+        auto gradient = std::clamp(_baselineMicros / _latencyMicros, kMinGradient, 1.0);
+        auto headroom = queued > 0 ? std::sqrt(_limit) : 0.0;
+        auto target = _limit * gradient + headroom;
+        _limit += (target - _limit) * kLimitSmoothing;
+    }
+
+    _limit = std::clamp(_limit, static_cast<double>(minLimit), static_cast<double>(maxLimit));
+    return limit();
+}
+
+int GradientConcurrencyController::limit() const {
+    return static_cast<int>(std::lround(_limit));
+}
+
+AdaptiveTicketHolder::Pool::Pool(StringData name, int numTickets, ServiceContext* serviceContext)
+    : name(name),
+      holder(std::make_unique<FifoTicketHolder>(numTickets, serviceContext)),
+      controller(numTickets) {}
+
+AdaptiveTicketHolder::AdaptiveTicketHolder(const Options& options, ServiceContext* serviceContext)
+    : _minTickets(options.minTickets),
+      _maxTickets(std::max(options.minTickets, options.maxTickets)),
+      _longRunningAdmissions(options.longRunningAdmissions),
+      _pools{Pool{"read"_sd, options.readers, serviceContext},
+             Pool{"write"_sd, options.writers, serviceContext},
+             Pool{"longRunning"_sd, options.longRunning, serviceContext}} {
+    if (auto periodicRunner = serviceContext->getPeriodicRunner()) {
+        _adjustmentJob = periodicRunner->makeJob(
+            {"AdaptiveTicketHolder",
+             [this](Client*) { adjustConcurrency(); },
+             options.adjustmentInterval});
+        _adjustmentJob.start();
+    }
+}
+
+AdaptiveTicketHolder::~AdaptiveTicketHolder() {}
+
+TicketHolderWithQueueingStats* AdaptiveTicketHolder::_getPool(
+    const AdmissionContext* admCtx) const {
+    auto poolType = [&] {
+        if (admCtx->getAdmissions() >= _longRunningAdmissions.loadRelaxed()) {
+            return PoolType::kLongRunning;
+        }
+        switch (admCtx->getLockMode()) {
+            case MODE_IS:
+            case MODE_S:
+                return PoolType::kRead;
+            case MODE_IX:
+                return PoolType::kWrite;
+            default:
+                MONGO_UNREACHABLE;
+        }
+    }();
+    return _pools[static_cast<unsigned int>(poolType)].holder.get();
+}
+
+boost::optional<Ticket> AdaptiveTicketHolder::tryAcquire(AdmissionContext* admCtx) {
+    return _getPool(admCtx)->tryAcquire(admCtx);
+}
+
+Ticket AdaptiveTicketHolder::waitForTicket(OperationContext* opCtx,
+                                           AdmissionContext* admCtx,
+                                           WaitMode waitMode) {
+    return _getPool(admCtx)->waitForTicket(opCtx, admCtx, waitMode);
+}
+
+boost::optional<Ticket> AdaptiveTicketHolder::waitForTicketUntil(OperationContext* opCtx,
+                                                                 AdmissionContext* admCtx,
+                                                                 Date_t until,
+                                                                 WaitMode waitMode) {
+    return _getPool(admCtx)->waitForTicketUntil(opCtx, admCtx, until, waitMode);
+}
+
+int AdaptiveTicketHolder::queued() const {
+    int queued = 0;
+    for (const auto& pool : _pools) {
+        queued += pool.holder->queued();
+    }
+    return queued;
+}
+
+void AdaptiveTicketHolder::appendStats(BSONObjBuilder& b) const {
+    stdx::lock_guard<Latch> lk(_adjustmentMutex);
+    for (const auto& pool : _pools) {
+        BSONObjBuilder bbb(b.subobjStart(pool.name));
+        pool.holder->appendStats(bbb);
+        bbb.append("latencyMicros", pool.controller.latencyMicros());
+        bbb.append("baselineLatencyMicros", pool.controller.baselineLatencyMicros());
+        bbb.done();
+    }
+}
+
+void AdaptiveTicketHolder::adjustConcurrency() {
+    std::array<int, static_cast<unsigned int>(PoolType::kNumPools)> limits;
+    {
+        stdx::lock_guard<Latch> lk(_adjustmentMutex);
+        for (size_t i = 0; i < _pools.size(); ++i) {
+            auto& pool = _pools[i];
+            auto finished = pool.holder->_totalFinishedProcessing.load();
+            auto timeProcessingMicros = pool.holder->_totalTimeProcessingMicros.load();
+            limits[i] = pool.controller.sample(
+                finished - pool.lastFinished,
+                Microseconds(timeProcessingMicros - pool.lastTimeProcessingMicros),
+                pool.holder->queued(),
+                _minTickets,
+                _maxTickets);
+            pool.lastFinished = finished;
+            pool.lastTimeProcessingMicros = timeProcessingMicros;
+        }
+    }
+
+    // Shrinking a pool does not wait for the operations holding its tickets, which are dropped as
+    // they are released, so the periodic job is never blocked behind a long-running operation.
+    for (size_t i = 0; i < _pools.size(); ++i) {
+        auto& pool = _pools[i];
+        if (limits[i] == pool.holder->outof()) {
+            continue;
+        }
+        auto status = pool.holder->resizeWithoutWaiting(limits[i]);
+        if (!status.isOK()) {
+            LOGV2_WARNING(7470200,
+                          "Failed to resize ticket pool",
+                          "pool"_attr = pool.name,
+                          "tickets"_attr = limits[i],
+                          "error"_attr = status);
+        }
+    }
+}
+
+void AdaptiveTicketHolder::_release(AdmissionContext* admCtx) noexcept {
+    MONGO_UNREACHABLE;
+}
+
 
 #if defined(__linux__)
 namespace {
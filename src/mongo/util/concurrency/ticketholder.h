@@ -32,6 +32,7 @@
 #include <semaphore.h>
 #endif
 
+#include <array>
 #include <queue>
 
 #include "mongo/db/operation_context.h"
@@ -42,6 +43,7 @@
 #include "mongo/util/concurrency/admission_context.h"
 #include "mongo/util/concurrency/mutex.h"
 #include "mongo/util/hierarchical_acquisition.h"
+#include "mongo/util/periodic_runner.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -95,6 +97,11 @@ public:
                                                        Date_t until,
                                                        WaitMode waitMode) = 0;
 
+    /**
+     * Returns the number of operations currently waiting for a ticket.
+     */
+    virtual int queued() const = 0;
+
     virtual void appendStats(BSONObjBuilder& b) const = 0;
 
 private:
@@ -103,6 +110,7 @@ private:
 
 class TicketHolderWithQueueingStats : public TicketHolder {
     friend class ReaderWriterTicketHolder;
+    friend class AdaptiveTicketHolder;
 
 public:
     /**
@@ -140,17 +148,23 @@ public:
 
     Status resize(int newSize);
 
+    /**
+     * Like resize(), but does not wait for operations to give back the tickets a shrink removes.
+     * Tickets which are not available are dropped as they are released instead.
+     */
+    Status resizeWithoutWaiting(int newSize);
+
     virtual int available() const = 0;
 
     virtual int used() const {
-        return outof() - available();
+        return outof() + _pendingReduction.loadRelaxed() - available();
     }
 
     int outof() const {
         return _outof.loadRelaxed();
     }
 
-    virtual int queued() const {
+    int queued() const override {
         auto removed = _totalRemovedQueue.loadRelaxed();
         auto added = _totalAddedQueue.loadRelaxed();
         return std::max(static_cast<int>(added - removed), 0);
@@ -172,6 +186,11 @@ private:
 
     virtual void _releaseQueue(AdmissionContext* admCtx) noexcept = 0;
 
+    /**
+     * Consumes one ticket of a pending reduction, returning false if there is none.
+     */
+    bool _tryConsumePendingReduction() noexcept;
+
     AtomicWord<std::int64_t> _totalAddedQueue{0};
     AtomicWord<std::int64_t> _totalRemovedQueue{0};
     AtomicWord<std::int64_t> _totalFinishedProcessing{0};
@@ -183,6 +202,8 @@ private:
     Mutex _resizeMutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(2),
                                           "TicketHolderWithQueueingStats::_resizeMutex");
     AtomicWord<int> _outof;
+    // Tickets removed by resizeWithoutWaiting() which are still held by operations.
+    AtomicWord<int> _pendingReduction{0};
 
 protected:
     ServiceContext* _serviceContext;
@@ -227,6 +248,8 @@ public:
                                                Date_t until,
                                                WaitMode waitMode) override final;
 
+    int queued() const override final;
+
     void appendStats(BSONObjBuilder& b) const override final;
 
     Status resizeReaders(int newSize);
@@ -440,6 +463,125 @@ private:
     Queue& _getQueueToUse(OperationContext* opCtx, const AdmissionContext* admCtx) override final;
 };
 
+/**
+ * Computes how many tickets a pool should hand out from the average time its operations hold a
+ * ticket, in the style of a gradient concurrency limiter. Since throughput is the number of tickets
+ * out divided by that latency, as long as the latency stays at the lowest one recently observed
+ * more tickets still mean more throughput and the limit grows while operations are queued. Once the
+ * latency rises above it the storage engine is saturated and the limit shrinks in proportion.
+ */
+class GradientConcurrencyController {
+public:
+    explicit GradientConcurrencyController(int initialLimit) : _limit(initialLimit) {}
+
+    /**
+     * Records that 'finished' operations held a ticket for a total of 'processing' since the
+     * previous sample while 'queued' operations were waiting for one, and returns the new limit,
+     * which is kept within ['minLimit', 'maxLimit'].
+     */
+    int sample(std::int64_t finished,
+               Microseconds processing,
+               int queued,
+               int minLimit,
+               int maxLimit);
+
+    int limit() const;
+
+    double latencyMicros() const {
+        return _latencyMicros;
+    }
+
+    double baselineLatencyMicros() const {
+        return _baselineMicros;
+    }
+
+private:
+    double _limit;
+    double _latencyMicros = 0;
+    double _baselineMicros = 0;
+};
+
+/**
+ * A TicketHolder implementation that sizes its pools from the latency their operations observe and
+ * keeps long-running operations from starving short ones. MODE_IS/MODE_S and MODE_IX requests are
+ * directed to the "Readers" and "Writers" pools as in ReaderWriterTicketHolder, except for
+ * operations which have already taken 'longRunningAdmissions' tickets: collection scans, $group and
+ * other long operations give their ticket back and take a new one every time they yield, so they
+ * end up sharing the separate "Long running" pool. Every 'adjustmentInterval' each pool is resized
+ * to the limit computed by its own GradientConcurrencyController.
+ */
+class AdaptiveTicketHolder final : public TicketHolder {
+public:
+    struct Options {
+        int readers = 128;
+        int writers = 128;
+        int longRunning = 16;
+        int minTickets = 5;
+        int maxTickets = 1024;
+        int longRunningAdmissions = 100;
+        Milliseconds adjustmentInterval{100};
+    };
+
+    AdaptiveTicketHolder(const Options& options, ServiceContext* serviceContext);
+    ~AdaptiveTicketHolder() override final;
+
+    boost::optional<Ticket> tryAcquire(AdmissionContext* admCtx) override final;
+
+    Ticket waitForTicket(OperationContext* opCtx,
+                         AdmissionContext* admCtx,
+                         WaitMode waitMode) override final;
+
+    boost::optional<Ticket> waitForTicketUntil(OperationContext* opCtx,
+                                               AdmissionContext* admCtx,
+                                               Date_t until,
+                                               WaitMode waitMode) override final;
+
+    int queued() const override final;
+
+    void appendStats(BSONObjBuilder& b) const override final;
+
+    /**
+     * Samples the latency of every pool since the previous call and resizes them accordingly. Runs
+     * periodically when the ServiceContext has a PeriodicRunner.
+     */
+    void adjustConcurrency();
+
+    void setLongRunningAdmissions(int admissions) {
+        _longRunningAdmissions.store(admissions);
+    }
+
+private:
+    enum class PoolType : unsigned int { kRead = 0, kWrite = 1, kLongRunning = 2, kNumPools = 3 };
+
+    struct Pool {
+        Pool(StringData name, int numTickets, ServiceContext* serviceContext);
+
+        StringData name;
+        std::unique_ptr<TicketHolderWithQueueingStats> holder;
+        GradientConcurrencyController controller;
+        std::int64_t lastFinished = 0;
+        std::int64_t lastTimeProcessingMicros = 0;
+    };
+
+    /**
+     * Tickets are handed out by the pools themselves and are released directly to them.
+     */
+    void _release(AdmissionContext* admCtx) noexcept override final;
+
+    TicketHolderWithQueueingStats* _getPool(const AdmissionContext* admCtx) const;
+
+    const int _minTickets;
+    const int _maxTickets;
+    AtomicWord<int> _longRunningAdmissions;
+
+    // Protects the controllers and the last samples of every pool.
+    mutable Mutex _adjustmentMutex = MONGO_MAKE_LATCH("AdaptiveTicketHolder::_adjustmentMutex");
+    std::array<Pool, static_cast<unsigned int>(PoolType::kNumPools)> _pools;
+
+    // Declared last so that the job is stopped before the pools are destroyed.
+    PeriodicJobAnchor _adjustmentJob;
+};
+
 /**
  * RAII-style movable token that gets generated when a ticket is acquired and is automatically
  * released when going out of scope.
@@ -469,3 +469,141 @@ TEST_F(TicketHolderTest, PriorityTwoNormalOneLowQueuedOperations) {
 }
 
 }  // namespace
+
+TEST(GradientConcurrencyControllerTest, AdjustsLimitToLatency) {
+    GradientConcurrencyController controller(16);
+
+    // Nothing is queued, so there is no reason to add tickets.
+    ASSERT_EQ(controller.sample(100, Microseconds(100 * 100), 0, 5, 1024), 16);
+
+    // Operations are queued while the latency stays at its baseline.
+    int limit = controller.limit();
+    for (int i = 0; i < 10; ++i) {
+        auto newLimit = controller.sample(100, Microseconds(100 * 100), 10, 5, 1024);
+        ASSERT_GTE(newLimit, limit);
+        limit = newLimit;
+    }
+    ASSERT_GT(limit, 16);
+    ASSERT_EQ(controller.baselineLatencyMicros(), 100);
+
+    // The latency quadruples as the storage engine saturates.
+    auto peak = limit;
+    for (int i = 0; i < 10; ++i) {
+        auto newLimit = controller.sample(100, Microseconds(400 * 100), 10, 5, 1024);
+        ASSERT_LTE(newLimit, limit);
+        limit = newLimit;
+    }
+    ASSERT_LT(limit, peak);
+    ASSERT_EQ(controller.latencyMicros(), 400);
+
+    // The limit is kept within bounds even without any new sample.
+    ASSERT_EQ(controller.sample(0, Microseconds(0), 0, 5, 8), 8);
+    ASSERT_EQ(controller.sample(0, Microseconds(0), 0, 10, 1024), 10);
+}
+
+TEST_F(TicketHolderTest, ResizeWithoutWaitingDropsHeldTicketsOnRelease) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    FifoTicketHolder holder(8, &serviceContext);
+    auto stats = [&](StringData field) {
+        BSONObjBuilder bob;
+        holder.appendStats(bob);
+        return bob.obj()[field].numberLong();
+    };
+
+    std::array<AdmissionContext, 7> admCtxs;
+    std::vector<Ticket> tickets;
+    for (auto& admCtx : admCtxs) {
+        auto ticket = holder.tryAcquire(&admCtx);
+        ASSERT(ticket);
+        tickets.push_back(std::move(*ticket));
+    }
+    ASSERT_EQ(stats("startedProcessing"), 7);
+
+    // The available ticket is removed right away and the held ones once they are released, without
+    // waiting for them or counting the removal as processing.
+    ASSERT_OK(holder.resizeWithoutWaiting(5));
+    ASSERT_EQ(holder.outof(), 5);
+    ASSERT_EQ(holder.available(), 0);
+    ASSERT_EQ(holder.used(), 7);
+    ASSERT_EQ(stats("startedProcessing"), 7);
+    ASSERT_EQ(stats("addedToQueue"), 0);
+
+    // Growing again keeps one of the tickets which were still to be dropped.
+    ASSERT_OK(holder.resizeWithoutWaiting(6));
+    ASSERT_EQ(holder.outof(), 6);
+    ASSERT_EQ(holder.used(), 7);
+
+    tickets.pop_back();
+    ASSERT_EQ(holder.used(), 6);
+    ASSERT_EQ(holder.available(), 0);
+    AdmissionContext admCtx;
+    ASSERT_FALSE(holder.tryAcquire(&admCtx));
+
+    tickets.pop_back();
+    ASSERT_EQ(holder.used(), 5);
+    ASSERT_EQ(holder.available(), 1);
+
+    tickets.clear();
+    ASSERT_EQ(holder.used(), 0);
+    ASSERT_EQ(holder.available(), 6);
+    ASSERT_EQ(holder.outof(), 6);
+
+    ASSERT_NOT_OK(holder.resizeWithoutWaiting(4));
+}
+
+TEST_F(TicketHolderTest, AdaptiveSeparatesLongRunningOperations) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    AdaptiveTicketHolder::Options options;
+    options.readers = 5;
+    options.writers = 5;
+    options.longRunning = 5;
+    options.longRunningAdmissions = 2;
+    AdaptiveTicketHolder holder(options, &serviceContext);
+
+    auto poolStats = [&](StringData pool, StringData field) {
+        BSONObjBuilder bob;
+        holder.appendStats(bob);
+        return bob.obj()[pool].Obj()[field].numberLong();
+    };
+
+    // An operation that gives its ticket back and takes a new one every time it yields.
+    AdmissionContext longRunningCtx;
+    longRunningCtx.setLockMode(MODE_IS);
+    for (int i = 0; i < 2; ++i) {
+        ASSERT(holder.tryAcquire(&longRunningCtx));
+    }
+    ASSERT_EQ(poolStats("read", "finishedProcessing"), 2);
+
+    // Short operations take every ticket of the read pool.
+    std::array<AdmissionContext, 5> shortCtxs;
+    std::vector<Ticket> shortTickets;
+    for (auto& admCtx : shortCtxs) {
+        admCtx.setLockMode(MODE_IS);
+        auto ticket = holder.tryAcquire(&admCtx);
+        ASSERT(ticket);
+        shortTickets.push_back(std::move(*ticket));
+    }
+    AdmissionContext readCtx;
+    readCtx.setLockMode(MODE_IS);
+    ASSERT_FALSE(holder.tryAcquire(&readCtx));
+    ASSERT_EQ(poolStats("read", "out"), 5);
+
+    // The long-running operation is not queued behind them, and does not take their tickets.
+    {
+        auto ticket = holder.tryAcquire(&longRunningCtx);
+        ASSERT(ticket);
+        ASSERT_EQ(poolStats("longRunning", "out"), 1);
+        ASSERT_EQ(poolStats("write", "out"), 0);
+    }
+    ASSERT_EQ(poolStats("longRunning", "out"), 0);
+    ASSERT_EQ(poolStats("longRunning", "finishedProcessing"), 1);
+
+    // Nothing was queued and the latency did not change, so the pools keep their sizes.
+    shortTickets.clear();
+    holder.adjustConcurrency();
+    ASSERT_EQ(poolStats("read", "totalTickets"), 5);
+    ASSERT_EQ(poolStats("write", "totalTickets"), 5);
+    ASSERT_EQ(poolStats("longRunning", "totalTickets"), 5);
+}
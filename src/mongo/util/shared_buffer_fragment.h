@@ -127,6 +127,7 @@ public:
             size_t allocSize = std::max(_blockSize, initialSize);
             _buffer = SharedBuffer::allocate(allocSize);
             _offset = 0;
+            ++_blocksAllocated;
         }
         _inUse = true;
         return *this;
@@ -151,6 +152,7 @@ public:
                 memcpy(newBuffer.get(), _buffer.get() + _offset, currentCapacity);
             _buffer = std::move(newBuffer);
             _offset = 0;
+            ++_blocksAllocated;
         }
     }
 
@@ -163,6 +165,7 @@ public:
         SharedBufferFragment fragment(_buffer, _offset, totalSize);
         _offset += totalSize;
         _inUse = false;
+        ++_fragmentsBuilt;
         return fragment;
     }
 
@@ -191,12 +194,24 @@ public:
         return _inUse;
     }
 
+    // Returns the number of underlying buffers allocated so far.
+    size_t blocksAllocated() const {
+        return _blocksAllocated;
+    }
+
+    // Returns the number of memory fragments finished so far.
+    size_t fragmentsBuilt() const {
+        return _fragmentsBuilt;
+    }
+
 private:
     SharedBuffer _buffer;
     ptrdiff_t _offset;
     size_t _blockSize;
     GrowStrategy _growStrategy;
     bool _inUse{false};
+    size_t _blocksAllocated{0};
+    size_t _fragmentsBuilt{0};
 };
 
 
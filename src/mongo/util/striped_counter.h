@@ -0,0 +1,141 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/aligned.h"
+
+namespace mongo {
+
+namespace striped_detail {
+
+/**
+ * Returns the stripe of the calling thread. Stripes are handed out to threads in the order in
+ * which they first ask for one, so that threads started together land on different stripes.
+ */
+inline std::size_t currentThreadStripe() {
+    static AtomicWord<unsigned> nextStripe{0};
+    thread_local const std::size_t stripe = nextStripe.fetchAndAddRelaxed(1);
+    return stripe;
+}
+
+}  // namespace striped_detail
+
+/**
+ * Holds 'kNumStripes' instances of T, each on cache lines of its own, and hands each thread the
+ * instance of its stripe. Threads updating a Striped<T> concurrently therefore rarely write to the
+ * same cache line or contend on the same instance, at the cost of readers having to visit every
+ * stripe. T must be safe to use from the several threads which share a stripe.
+ */
+template <typename T, std::size_t kNumStripes = 16>
+class Striped {
+public:
+    static constexpr std::size_t kStripes = kNumStripes;
+
+    T& forCurrentThread() {
+        return forNeighborOfCurrentThread(0);
+    }
+
+    /**
+     * Returns the index of the calling thread's stripe. Callers which must later update the same
+     * instance from a thread that may have another stripe keep the index and use forStripe().
+     */
+    static std::size_t currentThreadStripeIndex() {
+        return striped_detail::currentThreadStripe() % kNumStripes;
+    }
+
+    T& forStripe(std::size_t index) {
+        return *_stripes[index];
+    }
+
+    /**
+     * Returns the instance of the stripe 'distance' stripes after the calling thread's one, for
+     * callers which fall back to a nearby stripe when their own one can't serve them.
+     */
+    T& forNeighborOfCurrentThread(std::size_t distance) {
+        return *_stripes[(currentThreadStripeIndex() + distance) % kNumStripes];
+    }
+
+    template <typename F>
+    void forEach(F&& f) {
+        for (auto& stripe : _stripes) {
+            f(*stripe);
+        }
+    }
+
+    template <typename F>
+    void forEach(F&& f) const {
+        for (const auto& stripe : _stripes) {
+            f(*stripe);
+        }
+    }
+
+private:
+    std::array<CacheExclusive<T>, kNumStripes> _stripes;
+};
+
+/**
+ * A counter which many threads increment and which is read rarely, such as a server statistic.
+ * Increments only touch the calling thread's stripe, and reads sum all of the stripes, so a read
+ * racing with increments returns a value the counter may never have held at any single instant.
+ */
+class StripedCounter {
+public:
+    void increment(long long n = 1) {
+        _stripes.forCurrentThread().fetchAndAddRelaxed(n);
+    }
+
+    /**
+     * Adds 'n' and returns the value the calling thread's stripe held before, which callers may use
+     * to detect that the counter grew large without summing every stripe.
+     */
+    long long fetchAndAddOnStripe(long long n) {
+        return _stripes.forCurrentThread().fetchAndAddRelaxed(n);
+    }
+
+    long long load() const {
+        long long total = 0;
+        _stripes.forEach(
+            [&](const AtomicWord<long long>& stripe) { total += stripe.loadRelaxed(); });
+        return total;
+    }
+
+    void reset() {
+        _stripes.forEach([](AtomicWord<long long>& stripe) { stripe.store(0); });
+    }
+
+private:
+    Striped<AtomicWord<long long>> _stripes;
+};
+
+}  // namespace mongo
@@ -0,0 +1,82 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/aligned.h"
+#include "mongo/util/processinfo.h"
+#include "mongo/util/striped_counter.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Benchmark increments of a counter which all threads share, as server statistics are. Comparing
+ * the per-thread throughput across thread counts shows how the counter scales with the number of
+ * cores incrementing it.
+ */
+void BM_IncrementCacheExclusiveAtomic(benchmark::State& state) {
+    static CacheExclusive<AtomicWord<long long>> counter;
+    for (auto keepRunning : state) {
+        counter->fetchAndAddRelaxed(1);
+    }
+    if (state.thread_index == 0) {
+        benchmark::DoNotOptimize(counter->loadRelaxed());
+    }
+}
+
+void BM_IncrementStripedCounter(benchmark::State& state) {
+    static StripedCounter counter;
+    for (auto keepRunning : state) {
+        counter.increment();
+    }
+    if (state.thread_index == 0) {
+        benchmark::DoNotOptimize(counter.load());
+    }
+}
+
+/**
+ * Benchmark reads of a striped counter, which sum every stripe.
+ */
+void BM_LoadStripedCounter(benchmark::State& state) {
+    static StripedCounter counter;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(counter.load());
+    }
+}
+
+BENCHMARK(BM_IncrementCacheExclusiveAtomic)->ThreadRange(1, ProcessInfo::getNumAvailableCores());
+BENCHMARK(BM_IncrementStripedCounter)->ThreadRange(1, ProcessInfo::getNumAvailableCores());
+BENCHMARK(BM_LoadStripedCounter);
+
+}  // namespace
+}  // namespace mongo
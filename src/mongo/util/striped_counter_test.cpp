@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2023-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/striped_counter.h"
+
+#include <vector>
+
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(StripedCounterTest, SumsIncrementsFromAllThreads) {
+    constexpr int kThreads = 40;
+    constexpr int kIncrementsPerThread = 10000;
+
+    StripedCounter counter;
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kIncrementsPerThread; ++j) {
+                counter.increment();
+            }
+            counter.increment(2);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(counter.load(), kThreads * (kIncrementsPerThread + 2));
+
+    counter.reset();
+    ASSERT_EQ(counter.load(), 0);
+}
+
+TEST(StripedCounterTest, FetchAndAddOnStripeReturnsTheThreadsPreviousStripeValue) {
+    StripedCounter counter;
+    ASSERT_EQ(counter.fetchAndAddOnStripe(5), 0);
+    ASSERT_EQ(counter.fetchAndAddOnStripe(5), 5);
+
+    stdx::thread([&] { counter.increment(7); }).join();
+    ASSERT_EQ(counter.load(), 17);
+}
+
+TEST(StripedTest, ThreadAlwaysGetsTheSameStripe) {
+    Striped<int> striped;
+    striped.forEach([](int& stripe) { stripe = 0; });
+
+    auto& stripe = striped.forCurrentThread();
+    ASSERT_EQ(&stripe, &striped.forCurrentThread());
+
+    stripe = 1;
+    int total = 0;
+    int stripes = 0;
+    striped.forEach([&](const int& value) {
+        total += value;
+        ++stripes;
+    });
+    ASSERT_EQ(total, 1);
+    ASSERT_EQ(stripes, static_cast<int>(Striped<int>::kStripes));
+}
+
+TEST(StripedTest, NeighborsWrapAroundTheStripes) {
+    Striped<int, 4> striped;
+
+    ASSERT_EQ(&striped.forCurrentThread(), &striped.forNeighborOfCurrentThread(0));
+    ASSERT_EQ(&striped.forCurrentThread(), &striped.forNeighborOfCurrentThread(4));
+    ASSERT_NE(&striped.forCurrentThread(), &striped.forNeighborOfCurrentThread(1));
+    ASSERT_EQ(&striped.forNeighborOfCurrentThread(1), &striped.forNeighborOfCurrentThread(5));
+}
+
+}  // namespace
+}  // namespace mongo